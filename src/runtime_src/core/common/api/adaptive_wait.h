@@ -0,0 +1,187 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+#ifndef XRT_COMMON_API_ADAPTIVE_WAIT_H
+#define XRT_COMMON_API_ADAPTIVE_WAIT_H
+
+#include "core/common/config_reader.h"
+#include "core/include/xrt/xrt_kernel.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#if defined(__x86_64__) || defined(_M_X64)
+# include <immintrin.h>
+#endif
+
+namespace xrt_core {
+
+// class adaptive_wait - Hybrid spin / poll / block waiting
+//
+// Tracks a log2 histogram of observed completion times, time from
+// command submission to observed completion, of one kernel or
+// runlist.  The histogram determines the spin budget for a wait.
+//
+// A hybrid wait first spins on the command packet state for the
+// budget, then polls the command through the hw queue for another
+// budget, and only then falls back to blocking.  Spinning pays off
+// for short running commands, where the cost of the blocking
+// syscall and thread wakeup exceeds the command execution time.
+//
+// The budget is the completion time that covers 90% of recent
+// completions.  If that exceeds Runtime.wait_spin_max_us, spinning
+// is not worth it and the budget is 0.  Until enough completions
+// have been observed, the budget is Runtime.wait_spin_max_us.
+// Samples are aged by halving the histogram periodically, so the
+// budget follows changes in kernel execution time.
+class adaptive_wait
+{
+public:
+  using clock = std::chrono::steady_clock;
+
+private:
+  // bucket idx holds completion times in [2^idx, 2^(idx+1)) ns
+  static constexpr size_t num_buckets = 40;
+  static constexpr uint64_t min_samples = 16;
+  static constexpr uint64_t refresh_interval = 64;
+  static constexpr uint64_t max_samples = 4096;
+  static constexpr uint64_t percentile = 90;
+  static constexpr int64_t unknown_budget = -1;
+
+  std::array<std::atomic<uint64_t>, num_buckets> m_histogram {};
+  std::atomic<uint64_t> m_samples {0};
+  std::atomic<int64_t> m_budget_ns {unknown_budget};
+
+  static std::chrono::nanoseconds
+  max_spin()
+  {
+    static std::chrono::nanoseconds value =
+      std::chrono::microseconds(xrt_core::config::get_wait_spin_max_us());
+    return value;
+  }
+
+  static size_t
+  bucket(uint64_t ns)
+  {
+    size_t idx = 0;
+    while (ns >>= 1)
+      ++idx;
+    return std::min(idx, num_buckets - 1);
+  }
+
+  static void
+  cpu_relax()
+  {
+#if defined(__x86_64__) || defined(_M_X64)
+    _mm_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+  }
+
+  // Recompute budget from histogram and age the samples.  Racing
+  // updates from concurrent waiters can lose a sample, which is
+  // harmless for the purpose of estimating a budget.
+  void
+  refresh()
+  {
+    std::array<uint64_t, num_buckets> hist {};
+    uint64_t total = 0;
+    for (size_t idx = 0; idx < num_buckets; ++idx)
+      total += (hist[idx] = m_histogram[idx].load(std::memory_order_relaxed));
+
+    if (total < min_samples)
+      return;
+
+    uint64_t sum = 0;
+    size_t idx = 0;
+    for (; idx < num_buckets; ++idx) {
+      sum += hist[idx];
+      if (sum * 100 >= total * percentile)
+        break;
+    }
+
+    auto covering = std::chrono::nanoseconds(uint64_t(2) << idx);
+    m_budget_ns = (covering > max_spin()) ? 0 : covering.count();
+
+    if (total < max_samples)
+      return;
+
+    for (auto& count : m_histogram)
+      count.store(count.load(std::memory_order_relaxed) / 2, std::memory_order_relaxed);
+  }
+
+public:
+  // resolve() - Resolve ini mode to the configured wait mode
+  static xrt::run::wait_mode
+  resolve(xrt::run::wait_mode mode)
+  {
+    if (mode != xrt::run::wait_mode::ini)
+      return mode;
+
+    static auto value = (xrt_core::config::get_wait_mode() == "hybrid")
+      ? xrt::run::wait_mode::hybrid
+      : xrt::run::wait_mode::block;
+    return value;
+  }
+
+  // record() - Record time from submission to observed completion
+  void
+  record(clock::time_point start)
+  {
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start);
+    m_histogram[bucket(static_cast<uint64_t>(elapsed.count()))].fetch_add(1, std::memory_order_relaxed);
+    if ((m_samples.fetch_add(1, std::memory_order_relaxed) + 1) % refresh_interval == 0)
+      refresh();
+  }
+
+  // budget() - Current spin budget
+  std::chrono::nanoseconds
+  budget() const
+  {
+    auto ns = m_budget_ns.load(std::memory_order_relaxed);
+    return ns == unknown_budget ? max_spin() : std::chrono::nanoseconds(ns);
+  }
+
+  // spin() - Spin, then poll, for command completion
+  //
+  // @start: Time at which the command was submitted
+  // @done: Callable returning true when command has completed
+  // @poll: Callable polling the command through the hw queue
+  // Return: true if the command completed within the budget
+  //
+  // The spin phase ends at start + budget, the poll phase at
+  // start + 2 * budget.  A command that has been running longer
+  // than that goes straight to blocking.
+  template <typename Done, typename Poll>
+  bool
+  spin(clock::time_point start, Done&& done, Poll&& poll) const
+  {
+    auto spin_budget = budget();
+    if (spin_budget.count() == 0)
+      return done();
+
+    auto spin_end = start + spin_budget;
+    while (!done()) {
+      if (clock::now() >= spin_end)
+        break;
+      cpu_relax();
+    }
+
+    auto poll_end = spin_end + spin_budget;
+    while (!done()) {
+      if (clock::now() >= poll_end)
+        return false;
+      poll();
+      std::this_thread::yield();
+    }
+
+    return true;
+  }
+};
+
+} // xrt_core
+
+#endif
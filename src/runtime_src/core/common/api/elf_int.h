@@ -23,6 +23,7 @@
 #include <cstring>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <unordered_set>
@@ -32,13 +33,70 @@
 
 namespace xrt {
 
+////////////////////////////////////////////////////////////////
+// section_cache - decompressed data of ELF sections
+//
+// Owned by elf_impl and shared by all bufs of the ELF.  A
+// compressed section is decompressed once, on first use or when
+// the ELF is loaded, rather than every time a module_run copies
+// the section into a buffer object.  Uncompressed sections are
+// not cached, they are copied directly from ELFIO.
+//
+// Sections are registered while the ELF is parsed, after which
+// the set of sections is fixed.  Decompression of a section is
+// thread safe and sections decompress independently.
+////////////////////////////////////////////////////////////////
+class section_cache
+{
+  struct entry
+  {
+    std::once_flag once;
+    std::size_t size = 0;
+    std::vector<uint8_t> data;
+  };
+
+  const ELFIO::elfio& m_elf;
+  bool m_enabled;
+  std::map<const ELFIO::section*, std::unique_ptr<entry>> m_entries;
+
+  // Decompress section into entry if not already done
+  const std::vector<uint8_t>&
+  get(const ELFIO::section* sec, entry& e) const;
+
+public:
+  explicit
+  section_cache(const ELFIO::elfio& elf);
+
+  const ELFIO::elfio&
+  get_elfio() const
+  {
+    return m_elf;
+  }
+
+  // add() - Register section, return its uncompressed size
+  std::size_t
+  add(const ELFIO::section* sec);
+
+  // copy() - Copy uncompressed data of section to dst
+  void
+  copy(const ELFIO::section* sec, uint8_t* dst, std::size_t size) const;
+
+  // decompress() - Decompress all registered sections
+  //
+  // Sections are decompressed in parallel by up to the specified
+  // number of threads.
+  void
+  decompress(unsigned int threads) const;
+};
+
 ////////////////////////////////////////////////////////////////
 // buf - wrapper for holding ELF section data
 //
 // Stores non-owning pointers to ELFIO section objects.
 // Compression is fully abstracted — aiebu determines whether
 // decompression is needed via get_section_uncompressed_size() /
-// copy_section_uncompressed_data().
+// copy_section_uncompressed_data().  Decompressed data is
+// owned by the section_cache of the ELF.
 // Padding stored separately to avoid copying section data.
 ////////////////////////////////////////////////////////////////
 struct buf
@@ -46,14 +104,15 @@ struct buf
   template <typename T> using span = xrt_core::span<T>;
 private:
   // A view into ELFIO section data, possibly compressed.
-  // For section-backed views, section and elf are non-null.
+  // For section-backed views, section and cache are non-null.
   // For padding views, section is null and padding holds the zero buffer.
   //
-  // Lifetime of section/elf pointers:
-  //   section points into m_elfio's internal section array; elf points to
-  //   m_elfio itself (stored as &elf in append_section_data).  Both m_elfio
-  //   and the buf objects (m_instr_buf_map, m_ctrl_packet_map, etc.) are
-  //   members of the same elf_impl instance (m_elfio in the base class,
+  // Lifetime of section/cache pointers:
+  //   section points into m_elfio's internal section array; cache points
+  //   to the section_cache of the ELF (stored as &cache in
+  //   append_section_data).  m_elfio, the section cache, and the buf
+  //   objects (m_instr_buf_map, m_ctrl_packet_map, etc.) are members of
+  //   the same elf_impl instance (m_elfio and cache in the base class,
   //   buf maps in the derived classes elf_aie_gen2 / elf_aie_gen2_plus).
   //   This is why the raw pointers are safe: a buf cannot outlive its
   //   owning elf_impl because it is a member of it, so m_elfio is
@@ -63,7 +122,7 @@ private:
   //
   struct view_entry {
     const ELFIO::section* section = nullptr;   // section-backed view (may be compressed)
-    const ELFIO::elfio* elf = nullptr;         // ELFIO owning the section (see lifetime note above)
+    const section_cache* cache = nullptr;      // cache of ELF owning the section (see lifetime note above)
     span<uint8_t> padding;                     // for zero-padding, points into m_padding_buffer
     std::size_t data_size = 0;                 // effective size (uncompressed if compressed)
   };
@@ -80,27 +139,27 @@ public:
 
   // Append section data from an ELFIO section.
   // Compression handling is delegated to aiebu — XRT does not inspect
-  // SHF_COMPRESSED or Chdr headers directly.  Decompression is deferred
-  // until copy_to().
+  // Chdr headers directly.  Decompression is deferred until the section
+  // is first copied and is done once per ELF by the section cache.
   void
-  append_section_data(const ELFIO::section* sec, const ELFIO::elfio& elf)
+  append_section_data(const ELFIO::section* sec, section_cache& cache)
   {
     if (!sec || sec->get_size() == 0)
       return;
 
     view_entry entry;
     entry.section = sec;
-    entry.elf = &elf;
-    entry.data_size = aiebu::get_section_uncompressed_size(sec, elf);
+    entry.cache = &cache;
+    entry.data_size = cache.add(sec);
     m_views.push_back(entry);
   }
 
   // Overload for smart pointers (from ELFIO range-based for loops)
   void
   append_section_data(const std::unique_ptr<ELFIO::section>& sec,
-                      const ELFIO::elfio& elf)
+                      section_cache& cache)
   {
-    append_section_data(sec.get(), elf);
+    append_section_data(sec.get(), cache);
   }
 
   // Add padding to reach target size (for AIE2PS/AIE4 page alignment)
@@ -133,8 +192,9 @@ public:
   }
 
   // Copy all views to destination buffer.
-  // Compressed sections are decompressed directly into dest via aiebu.
-  // Uncompressed sections and padding are memcpy'd.
+  // Compressed sections are copied from the section cache, which
+  // decompresses them on first use.  Uncompressed sections and
+  // padding are memcpy'd.
   void
   copy_to(xrt_core::span<uint8_t> dest) const
   {
@@ -146,7 +206,7 @@ public:
     auto* dst = dest.data();
     for (const auto& v : m_views) {
       if (v.section)
-        aiebu::copy_section_uncompressed_data(v.section, *v.elf, dst, v.data_size);
+        v.cache->copy(v.section, dst, v.data_size);
       else
         std::memcpy(dst, v.padding.data(), v.data_size);
 
@@ -295,6 +355,7 @@ protected:
   // getters code
   // NOLINTBEGIN
   ELFIO::elfio m_elfio;
+  section_cache m_section_cache{m_elfio};
   xrt::elf::platform m_platform;
   std::string m_path; // file path from which elf was loaded, empty if loaded from stream/buffer
 
@@ -355,6 +416,12 @@ protected:
   void
   parse_sections();
 
+  // Decompress compressed sections in parallel per xrt.ini
+  // elf_decompress_threads, otherwise sections are decompressed
+  // on first use
+  void
+  decompress_sections() const;
+
 private:
   ////////////////////////////////////////////////////////////////
   // Private helper structures and methods
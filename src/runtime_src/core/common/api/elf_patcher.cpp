@@ -6,12 +6,50 @@
 #include "elf_patcher.h"
 #include "core/common/error.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <cstring>
 #include <stdexcept>
 
 namespace xrt_core::elf_patcher {
 
+static std::atomic<uint64_t> s_patches {0}; // NOLINT
+static std::atomic<uint64_t> s_syncs {0};   // NOLINT
+
+patch_stats
+get_patch_stats()
+{
+  return {s_patches.load(), s_syncs.load()};
+}
+
+void
+sync_ranges::
+sync(xrt::bo& bo)
+{
+  if (m_ranges.empty())
+    return;
+
+  std::sort(m_ranges.begin(), m_ranges.end());
+  auto begin = m_ranges.front().first;
+  auto end = m_ranges.front().second;
+  auto flush = [&bo](size_t from, size_t to) {
+    bo.sync(XCL_BO_SYNC_BO_TO_DEVICE, to - from, from);
+    ++s_syncs;
+  };
+
+  for (const auto& [rbegin, rend] : m_ranges) {
+    if (rbegin > end + coalesce_gap) {
+      flush(begin, end);
+      begin = rbegin;
+    }
+    end = std::max(end, rend);
+  }
+
+  flush(begin, end);
+  m_ranges.clear();
+}
+
 // Return the minimum number of bytes required past bd_data_ptr for a given symbol type.
 // Used to bounds-check the patch offset before any pointer arithmetic.
 static size_t
@@ -214,7 +252,7 @@ patch_pl_ddr64(uint32_t* bd_data_ptr, uint64_t patch)
 
 void
 symbol_patcher::
-patch_symbol(xrt::bo bo, uint64_t value, bool first, bool is_arg)
+patch_symbol(xrt::bo bo, uint64_t value, bool first, bool is_arg, sync_ranges* deferred)
 {
   if (!m_config)
     throw std::runtime_error("symbol_patcher: config not set");
@@ -263,13 +301,24 @@ patch_symbol(xrt::bo bo, uint64_t value, bool first, bool is_arg)
       }
     }
 
-    // Sync the patched words back to device.  patch_bytes bytes from offset covers
-    // exactly the words touched by each patch function — same value used for
-    // the bounds check above, so no size argument is needed here.
+    // Sync the patched words back to device, or record them for a
+    // deferred sync.  By default patch_bytes bytes from offset covers
+    // exactly the words touched by each patch function — same value used
+    // for the bounds check above.
+    auto sync_range = [&](size_t bytes, size_t from) {
+      if (deferred) {
+        deferred->add(from, bytes);
+        return;
+      }
+      bo.sync(XCL_BO_SYNC_BO_TO_DEVICE, bytes, from);
+      ++s_syncs;
+    };
     auto sync = [&]() {
-      bo.sync(XCL_BO_SYNC_BO_TO_DEVICE, patch_bytes, offset);
+      sync_range(patch_bytes, offset);
     };
 
+    ++s_patches;
+
     switch (m_config->m_symbol_type) {
     case symbol_type::address_64:
       patch64(bd_data_ptr, value);
@@ -318,7 +367,7 @@ patch_symbol(xrt::bo bo, uint64_t value, bool first, bool is_arg)
       // the bounds check above (patch_bytes= 10 words) already covers this sub-range.
       patch_pl_ddr64(bd_data_ptr, value + config.offset_to_base_bo_addr);
       if (!first)
-        bo.sync(XCL_BO_SYNC_BO_TO_DEVICE, 2 * sizeof(uint32_t), offset + 8 * sizeof(uint32_t)); // NOLINT
+        sync_range(2 * sizeof(uint32_t), offset + 8 * sizeof(uint32_t)); // NOLINT
       break;
     default:
       throw std::runtime_error("Unsupported symbol type");
@@ -11,6 +11,7 @@
 #include <stdexcept>
 #include <string_view>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 // This file contains the patching logic related to xrt::elf
@@ -125,6 +126,59 @@ struct patcher_config
   add_patch(const patch_config& pc);
 };
 
+// struct patch_stats - Process wide counters of symbol patching
+//
+// @patches: Number of patched locations
+// @syncs: Number of partial buffer syncs issued for patched locations
+//
+// Syncs of entire buffers on first run are not counted.
+struct patch_stats
+{
+  uint64_t patches = 0;
+  uint64_t syncs = 0;
+};
+
+// get_patch_stats() - Current patch counters
+patch_stats
+get_patch_stats();
+
+// class sync_ranges - Dirty byte ranges of a patched buffer
+//
+// Used for deferred patching where patched locations are recorded
+// rather than synced individually.  Overlapping ranges and ranges
+// separated by at most coalesce_gap bytes are merged when the buffer
+// is synced, such that typically one sync covers all patches.
+class sync_ranges
+{
+  std::vector<std::pair<size_t, size_t>> m_ranges; // [begin, end)
+
+public:
+  static constexpr size_t coalesce_gap = 64;
+
+  // add() - Record a dirty range
+  void
+  add(size_t offset, size_t size)
+  {
+    m_ranges.emplace_back(offset, offset + size);
+  }
+
+  bool
+  empty() const
+  {
+    return m_ranges.empty();
+  }
+
+  void
+  clear()
+  {
+    m_ranges.clear();
+  }
+
+  // sync() - Sync merged dirty ranges of bo to device and clear
+  void
+  sync(xrt::bo& bo);
+};
+
 // struct symbol_patcher - runtime patcher for a symbol
 //
 // Created by module_run, references shared config from elf_impl,
@@ -140,9 +194,13 @@ struct symbol_patcher
   // Constructor - takes pointer to shared config, initializes state
   explicit symbol_patcher(const patcher_config* config);
 
-  // Function to patch a symbol in the buffer.
+  // Function to patch a symbol in the buffer.  Patched locations
+  // are synced to device immediately unless first is true, or
+  // deferred is specified in which case the locations are recorded
+  // for a later coalesced sync.
   void
-  patch_symbol(xrt::bo bo, uint64_t value, bool first, bool is_arg = true);
+  patch_symbol(xrt::bo bo, uint64_t value, bool first, bool is_arg = true,
+               sync_ranges* deferred = nullptr);
 
   // static method for patching raw buffers passed by shim tests
   // where the caller handles sync themselves
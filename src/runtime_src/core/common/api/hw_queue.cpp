@@ -21,12 +21,15 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cassert>
 #include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 using namespace std::chrono_literals;
 
@@ -79,11 +82,106 @@ notify_host(xrt_core::command* cmd)
   notify_host(cmd, get_command_state(cmd));
 }
 
+// class submission_ring - lock-free multi-producer single-consumer ring
+//
+// @m_cells: Ring storage, size is a power of 2
+// @m_mask: Index mask for ring storage
+// @m_enqueue_pos: Next position to be claimed by a producer
+// @m_dequeue_pos: Next position to be consumed, owned by consumer
+//
+// Bounded ring based on per-cell sequence numbers.  Producers claim a
+// position with a single CAS and publish the command by updating the
+// cell sequence.  The consumer (command monitor thread) never blocks
+// producers.  A producer that finds the ring full is told so and
+// must fall back to some other means of handing over the command.
+class submission_ring
+{
+  struct cell
+  {
+    std::atomic<size_t> seq {0};
+    xrt_core::command* cmd = nullptr;
+  };
+
+  static constexpr size_t cache_line_size = 64;
+
+  std::vector<cell> m_cells;
+  size_t m_mask;
+  alignas(cache_line_size) std::atomic<size_t> m_enqueue_pos {0};
+  alignas(cache_line_size) size_t m_dequeue_pos {0};
+
+public:
+  explicit submission_ring(size_t size)
+    : m_cells(size)
+    , m_mask(size - 1)
+  {
+    assert((size & m_mask) == 0);
+    for (size_t idx = 0; idx < size; ++idx)
+      m_cells[idx].seq.store(idx, std::memory_order_relaxed);
+  }
+
+  // push() - Producer side, thread safe
+  //
+  // Return false if the ring is full
+  bool
+  push(xrt_core::command* cmd)
+  {
+    auto pos = m_enqueue_pos.load(std::memory_order_relaxed);
+    while (true) {
+      auto& c = m_cells[pos & m_mask];
+      auto seq = c.seq.load(std::memory_order_acquire);
+      auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+      if (diff == 0) {
+        if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          c.cmd = cmd;
+          c.seq.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      }
+      else if (diff < 0) {
+        return false;
+      }
+      else {
+        pos = m_enqueue_pos.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // pop() - Consumer side, must be called by one thread only
+  //
+  // Return nullptr if there is no published command.
+  xrt_core::command*
+  pop()
+  {
+    auto& c = m_cells[m_dequeue_pos & m_mask];
+    if (c.seq.load(std::memory_order_acquire) != m_dequeue_pos + 1)
+      return nullptr;
+
+    auto cmd = c.cmd;
+    c.seq.store(m_dequeue_pos + m_mask + 1, std::memory_order_release);
+    ++m_dequeue_pos;
+    return cmd;
+  }
+
+  // empty() - Consumer side, check if any command is published
+  bool
+  empty() const
+  {
+    auto& c = m_cells[m_dequeue_pos & m_mask];
+    return c.seq.load(std::memory_order_acquire) != m_dequeue_pos + 1;
+  }
+};
+
 // class command_manager - managed command executuon
 //
-// @m_qimpl: The hw queue used for command submission
-// @work_mutex: Syncrhonize monitor thread with launched commands
+// @m_impl: The hw queue used for command submission
+// @m_submitted: Lock-free ring of launched commands
+// @m_running: Commands owned by monitor thread, in order of launch
+// @work_mutex: Synchronize monitor thread sleep with launched commands
 // @work_cond: Kick off monitor thread when there are new commands
+// @m_sleeping: True when monitor thread is (about to be) blocked on work_cond
+// @m_overflow: Commands launched while the ring was full
+// @m_cancelled: Commands that were launched but failed submission, until drained
+// @m_slow_path: Count of entries in m_overflow and m_cancelled
 // @monitor_thread: Thread for asynchronous monitoring of command execution
 // @stop: Stop the monitor thread
 //
@@ -93,6 +191,11 @@ notify_host(xrt_core::command* cmd)
 // completion.  This is the OpenCL model but is also supported by
 // native XRT APIs.
 //
+// Launching a command never takes a lock unless the monitor thread
+// is asleep or the submission ring is full.  The monitor thread is
+// the only consumer of the ring and the sole owner of the running
+// command list, which is compacted in place as commands complete.
+//
 // The command manager requires submission and wait APIs to be implemented
 // by which ever object (hw queue) uses the manager.
 class command_manager
@@ -115,15 +218,76 @@ public:
   };
 
 private:
+  static constexpr size_t ring_size = 1024;
+
   executor* m_impl;
+  submission_ring m_submitted {ring_size};
+  command_queue_type m_running;
   std::mutex work_mutex;
   std::condition_variable work_cond;
-  command_queue_type submitted_cmds;
+  std::atomic<bool> m_sleeping {false};
+  command_queue_type m_overflow;
+  command_queue_type m_cancelled;
+  std::atomic<size_t> m_slow_path {0};
   bool stop = false;
 
   // thread can be constructed only after data members are initialized
   std::thread monitor_thread;
 
+  // Check for pending work, must be called with work_mutex held
+  bool
+  has_work() const
+  {
+    return stop || !m_running.empty() || !m_submitted.empty() || !m_overflow.empty();
+  }
+
+  // Move launched commands to the running list.  Commands are
+  // moved in order of launch except when the ring has overflowed.
+  void
+  drain_submitted()
+  {
+    while (auto cmd = m_submitted.pop())
+      m_running.push_back(cmd);
+
+    if (m_slow_path.load() == 0)
+      return;
+
+    std::lock_guard lk(work_mutex);
+    std::copy(m_overflow.begin(), m_overflow.end(), std::back_inserter(m_running));
+    m_slow_path -= m_overflow.size();
+    m_overflow.clear();
+
+    // A cancelled command can be in a ring cell behind a cell that
+    // another producer has claimed but not yet published, in which
+    // case it is not running yet.  Keep the cancellation until the
+    // command is drained.
+    auto pending = std::remove_if(m_cancelled.begin(), m_cancelled.end(), [this](auto cmd) {
+      auto itr = std::find(m_running.begin(), m_running.end(), cmd);
+      if (itr == m_running.end())
+        return false;
+      m_running.erase(itr);
+      return true;
+    });
+    m_slow_path -= std::distance(pending, m_cancelled.end());
+    m_cancelled.erase(pending, m_cancelled.end());
+  }
+
+  // Notify completed commands and compact the running list in place.
+  // Only commands that have changed state are touched beyond the
+  // state check, and the relative order of busy commands is preserved.
+  void
+  notify_completed()
+  {
+    auto busy = m_running.begin();
+    for (auto cmd : m_running) {
+      if (completed(cmd))
+        notify_host(cmd);
+      else
+        *busy++ = cmd;
+    }
+    m_running.erase(busy, m_running.end());
+  }
+
   // monitor_loop() - Manage running commands and notify on completion
   //
   // The monitor thread services managed command and asynchronously
@@ -134,16 +298,19 @@ private:
   void
   monitor_loop()
   {
-    std::vector<xrt_core::command*> busy_cmds;
-    std::vector<xrt_core::command*> running_cmds;
-
     while (true) {
 
-      // Larger wait synchronized with launch()
-      {
+      // Larger wait synchronized with launch().  The sleeping flag
+      // is published before the ring is checked, launch() publishes
+      // the command before checking the flag, so at least one side
+      // observes the other.
+      if (m_running.empty() && m_submitted.empty()) {
         std::unique_lock<std::mutex> lk(work_mutex);
-        while (!stop && running_cmds.empty() && submitted_cmds.empty())
+        m_sleeping.store(true);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        while (!has_work())
           work_cond.wait(lk);
+        m_sleeping.store(false);
       }
 
       if (stop)
@@ -153,38 +320,23 @@ private:
       m_impl->wait(0);
 
       // Drain submitted commands.  It is important that this comes
-      // after exec_wait and is synchronized with launch() that added
-      // to submitted_cmds.
+      // after exec_wait.
       //
       // Scenario if before exec_wait is that a new command was added
-      // to submitted_cmds and exec_buf immediately after the critical
-      // section above and that the command completion happens in the
-      // exec_wait call. If submitted_cmds was drained, in for example
-      // above critical section, before the call to exec_wait it would
-      // not be in running_cmds and would not be notified of
-      // completion.
+      // to the ring and exec_buf immediately after the ring was
+      // drained and that the command completion happens in the
+      // exec_wait call. If the ring was drained before the call to
+      // exec_wait the command would not be in m_running and would
+      // not be notified of completion.
       //
       // The sequence is very important.  It must be guaranteed that
       // exec_wait will never return for a command that is not yet
-      // in either running_cmds or submitted_cmds.
-      {
-        std::lock_guard<std::mutex> lk(work_mutex);
-        std::copy(submitted_cmds.begin(), submitted_cmds.end(), std::back_inserter(running_cmds));
-        submitted_cmds.clear();
-      }
-      // At this point running_cmds is guaranteed to contain the
-      // command(s) for which exec_wait returned.
-
-      // Preserve order of processing
-      for (auto cmd : running_cmds) {
-        if (completed(cmd))
-          notify_host(cmd);
-        else
-          busy_cmds.push_back(cmd);
-      }
+      // in either m_running or m_submitted.
+      drain_submitted();
 
-      running_cmds.swap(busy_cmds);
-      busy_cmds.clear();
+      // At this point m_running is guaranteed to contain the
+      // command(s) for which exec_wait returned.
+      notify_completed();
     } // while (1)
   }
 
@@ -206,6 +358,19 @@ private:
     }
   }
 
+  // Wake up the monitor thread if it is asleep.  The fence pairs
+  // with the fence in monitor_loop().
+  void
+  wakeup()
+  {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!m_sleeping.load())
+      return;
+
+    std::lock_guard<std::mutex> lk(work_mutex);
+    work_cond.notify_one();
+  }
+
 public:
   // Constructor starts monitor thread
   explicit command_manager(executor* impl)
@@ -261,9 +426,10 @@ public:
     // Store command so completion can be tracked.  Make sure this is
     // done prior to exec_buf as exec_wait can otherwise be missed.
     // See detailed explanation in monitor loop.
-    {
+    if (!m_submitted.push(cmd)) {
       std::lock_guard<std::mutex> lk(work_mutex);
-      submitted_cmds.push_back(cmd);
+      m_overflow.push_back(cmd);
+      ++m_slow_path;
     }
 
     // Submit the command
@@ -271,17 +437,18 @@ public:
       m_impl->submit(cmd);
     }
     catch (...) {
-      // Remove the pending command
+      // The command cannot be pulled back from the ring, let the
+      // monitor thread remove it from its running list.
       std::lock_guard<std::mutex> lk(work_mutex);
       assert(get_command_state(cmd)==ERT_CMD_STATE_NEW);
-      if (!submitted_cmds.empty())
-        submitted_cmds.pop_back();
+      m_cancelled.push_back(cmd);
+      ++m_slow_path;
       throw;
     }
 
     // This is somewhat expensive, it is better to have this after the
     // exec_buf call so that actual execution doesn't have to wait.
-    work_cond.notify_one();
+    wakeup();
   }
 };
 
@@ -24,6 +24,10 @@ namespace xrt_core::xdp {
 struct xrt_kernel_data;
 }
 
+namespace xrt_core {
+struct bo_cache_stats;
+}
+
 namespace xrt_core::kernel_int {
 
 // Provide access to kdma command based BO copy Used by xrt::bo::copy.
@@ -139,6 +143,13 @@ XRT_CORE_COMMON_EXPORT
 void
 set_dtrace_control_file(xrt::run_impl* run_impl, const std::string& path);
 
+// get_exec_buffer_cache_stats() - Counters of the exec buffer cache
+// shared by all kernel commands on the device.  Used to size the
+// cache through xrt.ini Runtime.exec_buffer_cache_size.
+XRT_CORE_COMMON_EXPORT
+xrt_core::bo_cache_stats
+get_exec_buffer_cache_stats(const xrt::device& device);
+
 } // xrt_core::kernel_int
 
 #endif
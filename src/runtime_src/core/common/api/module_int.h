@@ -82,6 +82,13 @@ XRT_CORE_COMMON_EXPORT
 void
 sync(const xrt::module&);
 
+// Process wide counters of patched locations and partial syncs of
+// patched buffers.  Compare with Runtime.deferred_patch_sync enabled
+// and disabled to measure the effect of coalescing patch syncs.
+XRT_CORE_COMMON_EXPORT
+xrt_core::elf_patcher::patch_stats
+get_patch_stats();
+
 // Check if dtrace is enabled
 XRT_CORE_COMMON_EXPORT
 bool
@@ -12,6 +12,7 @@
 #include "core/include/xrt/xrt_hw_context.h"
 #include "core/include/xrt/detail/xrt_mem.h"
 #include "core/include/xrt/experimental/xrt_ext.h"
+#include "core/include/xrt/experimental/xrt_queue.h"
 
 #include "native_profile.h"
 #include "bo.h"
@@ -36,7 +37,12 @@
 #include "core/common/shim/shared_handle.h"
 
 #include <cstdlib>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <future>
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
 #include <vector>
@@ -252,6 +258,8 @@ protected:
   mutable uint32_t grpid = no_group;               // NOLINT memory group index
   mutable bo::flags flags = no_flags;              // NOLINT flags per bo properties
   mutable std::unique_ptr<xrt_core::shared_handle> shared_handle; // NOLINT
+  mutable size_t dma_channels = 0;                 // NOLINT number of device DMA channels, 0 if not queried
+  mutable std::once_flag dma_channels_once;        // NOLINT dma_channels is queried once
 
 public:
   // No handle
@@ -495,6 +503,19 @@ public:
   xrt::bo::async_handle
   async(xrt::bo& bo, xclBOSyncDirection dir, size_t sz, size_t offset);
 
+  // Number of DMA channels that can transfer concurrently.  Queried
+  // once per buffer, devices without the query have one channel.
+  // Concurrent async syncs of the buffer may query concurrently.
+  size_t
+  get_dma_channels() const
+  {
+    std::call_once(dma_channels_once, [this] {
+      dma_channels = std::max<size_t>(1, xrt_core::device_query_default<xrt_core::query::dma_threads_raw>(device.get_core_device(), {}).size());
+    });
+
+    return dma_channels;
+  }
+
   virtual void
   sync(xclBOSyncDirection dir, size_t sz, size_t offset)
   {
@@ -549,14 +570,33 @@ public:
   virtual bool   is_imported()   const { return false;   }
 };
 
+// Queue on which completion of asynchronous operations without a
+// completion future is waited for, see bo::async_handle_impl.
+static xrt::queue&
+get_async_wait_queue()
+{
+  static xrt::queue queue;
+  return queue;
+}
+
 // class bo::async_handle_impl - Base class for asynchronous buffer DMA handle
 //
 // Derived classes:
 // [aie::b ::async_handle_impl]: For AIE BOs
+// [sync_async_handle_impl]: For chunked asynchronous syncs
 //
 // Impl Class associated with async bo which allows to wait for completion
-class bo::async_handle_impl
+//
+// Derived classes must implement wait().  By default, ready() and
+// get_future() are implemented with a completion future that runs the
+// completion task on a queue the first time either is called.  The
+// task must wait for the operation even if the handle is destroyed
+// before it runs.
+class bo::async_handle_impl : public std::enable_shared_from_this<bo::async_handle_impl>
 {
+  std::once_flag m_completion_once;
+  std::shared_future<void> m_completion;
+
 public:
   xrt::bo m_bo;
 
@@ -580,6 +620,92 @@ public:
   {
     throw std::runtime_error("Unsupported feature");
   }
+
+  // ready() - Check if async has completed
+  virtual bool
+  ready()
+  {
+    return get_future().wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+  }
+
+  // completion_task() - Task that waits for completion of async
+  //
+  // The default task owns the handle until it has waited.  The task
+  // is held by the future stored in the handle, so the reference is
+  // released when the task runs rather than when the task is
+  // destroyed, which would otherwise never happen.
+  virtual std::function<void()>
+  completion_task()
+  {
+    auto self = std::make_shared<std::shared_ptr<async_handle_impl>>(shared_from_this());
+    return [self] {
+      auto hdl = std::move(*self);
+      hdl->wait();
+    };
+  }
+
+  // get_future() - Future for completion of async
+  virtual std::shared_future<void>
+  get_future()
+  {
+    std::call_once(m_completion_once, [this] {
+      m_completion = get_async_wait_queue().enqueue(completion_task());
+    });
+
+    return m_completion;
+  }
+};
+
+// class sync_async_handle_impl - Asynchronous sync of a buffer object
+//
+// The sync is split into chunks that are transferred concurrently,
+// the handle tracks the completion of all chunks.
+class sync_async_handle_impl : public bo::async_handle_impl
+{
+  std::vector<std::shared_future<void>> m_chunks;
+
+public:
+  sync_async_handle_impl(xrt::bo bo, std::vector<std::shared_future<void>> chunks)
+    : bo::async_handle_impl(std::move(bo))
+    , m_chunks(std::move(chunks))
+  {}
+
+  // wait() - Wait for all chunks, rethrow error of first failed chunk
+  void
+  wait() override
+  {
+    for (auto& chunk : m_chunks)
+      chunk.get();
+  }
+
+  bool
+  ready() override
+  {
+    return std::all_of(m_chunks.begin(), m_chunks.end(), [](const auto& chunk) {
+      return chunk.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    });
+  }
+
+  // completion_task() - Wait for copies of the chunk futures, the
+  // task does not depend on the handle
+  std::function<void()>
+  completion_task() override
+  {
+    return [chunks = m_chunks] {
+      for (auto& chunk : chunks)
+        chunk.get();
+    };
+  }
+
+  // get_future() - A single chunk is its own completion future
+  std::shared_future<void>
+  get_future() override
+  {
+    if (m_chunks.size() == 1)
+      return m_chunks.front();
+
+    return bo::async_handle_impl::get_future();
+  }
 };
 
 class aie::bo::async_handle_impl : public xrt::bo::async_handle_impl
@@ -627,6 +753,8 @@ class aie::bo::async_handle_impl : public xrt::bo::async_handle_impl
     mutable std::mutex async_bo_hdls_mutex;// Mutex for use with above map
   };
 
+  std::mutex m_wait_mutex; // Serialize wait() from user and completion future
+
 public:
   size_t m_bd_num; // For future use
   std::string m_gmio_name;
@@ -646,6 +774,8 @@ public:
   void
   wait() override
   {
+    std::lock_guard lk(m_wait_mutex);
+
     // DMA has already finished if not found
     if(!async_info.found(m_gmio_name, this))
       return;
@@ -674,17 +804,53 @@ async(xrt::bo& bo, const std::string& port, xclBOSyncDirection dir, size_t sz, s
   return xrt::bo::async_handle{a_bo_impl};
 }
 
+// Queues transferring chunks of asynchronous syncs.  The queues
+// share an executor with one worker per queue.  Consecutive chunks of
+// a sync are enqueued on different queues starting at a round robin
+// index, such that chunks of one sync are transferred concurrently
+// and concurrent syncs are spread over the queues.
+static xrt::queue&
+get_async_sync_queue(size_t idx)
+{
+  static constexpr size_t max_queues = 8;
+  static xrt::queue::executor executor{max_queues};
+  static std::vector<xrt::queue> queues = [] {
+    std::vector<xrt::queue> qs;
+    qs.reserve(max_queues);
+    for (size_t i = 0; i < max_queues; ++i)
+      qs.emplace_back(executor);
+    return qs;
+  }();
+
+  return queues[idx % max_queues];
+}
+
 xrt::bo::async_handle
 bo_impl::
-async(xrt::bo&, xclBOSyncDirection, size_t, size_t)
+async(xrt::bo& bo, xclBOSyncDirection dir, size_t sz, size_t offset)
 {
-  throw std::runtime_error("Unsupported feature");
+  // Smallest chunk worth a separate transfer
+  static constexpr size_t min_chunk_size = 1024 * 1024; // NOLINT
+  static std::atomic<size_t> next_queue {0};
 
-#if 0
-  //TODO for Alveo; base xrt::bo class
-  auto a_bo_impl = std::make_shared<xrt::bo::async_handle_impl>(bo);
-  return xrt::bo::async_handle{a_bo_impl};
-#endif
+  if (offset > get_size() || sz > get_size() - offset)
+    throw xrt_core::error(-EINVAL, "Invalid offset and size when syncing buffer asynchronously");
+
+  // One chunk per DMA channel, page aligned
+  auto chunks = std::min(get_dma_channels(), std::max<size_t>(1, sz / min_chunk_size));
+  auto chunk_size = (sz / chunks + get_alignment() - 1) & ~(get_alignment() - 1);
+
+  std::vector<std::shared_future<void>> futures;
+  futures.reserve(chunks);
+  auto qidx = next_queue.fetch_add(chunks);
+  for (size_t off = 0; off < sz; off += chunk_size) {
+    auto len = std::min(chunk_size, sz - off);
+    futures.push_back(get_async_sync_queue(qidx++).enqueue([bo, dir, len, off = offset + off] {
+      bo.get_handle()->sync(dir, len, off);
+    }));
+  }
+
+  return xrt::bo::async_handle{std::make_shared<sync_async_handle_impl>(bo, std::move(futures))};
 }
 
 // class buffer_ubuf - User provide host side buffer
@@ -1405,6 +1571,20 @@ wait()
   handle->wait();
 }
 
+bool
+bo::async_handle::
+ready() const
+{
+  return handle->ready();
+}
+
+std::shared_future<void>
+bo::async_handle::
+get_future() const
+{
+  return handle->get_future();
+}
+
 bo::
 bo(const xrt::device& device, void* userptr, size_t sz, bo::flags flags, memory_group grp)
   : handle(xdp::native::profiling_wrapper("xrt::bo::bo",
@@ -1731,6 +1911,313 @@ bo(const xrt::hw_context& hwctx, pid_type pid, xrt::bo::export_handle ehdl)
   : xrt::bo::bo{alloc_import_from_pid(device_type{hwctx}, pid, ehdl)}
 {}
 
+////////////////////////////////////////////////////////////////
+// xrt::ext::bo_pool implementation
+////////////////////////////////////////////////////////////////
+// class bo_pool_impl - Size class sub-allocator of arena buffers
+//
+// Arenas are reserved per memory group on demand.  Blocks are
+// carved from the top of an arena and recycled through per size
+// class free lists.  A block is identified by its arena id and
+// offset such that free lists of a released arena can be purged.
+//
+// Sub-buffers reference the pool weakly and return their block
+// when destructed, they participate in ownership of the arena
+// buffer through buffer_sub.
+class bo_pool_impl : public std::enable_shared_from_this<bo_pool_impl>
+{
+  static constexpr size_t min_block = 4096;
+  static constexpr size_t min_arena_size = 16 * min_block;
+  static constexpr size_t max_idle_arenas = 1;
+
+  struct arena
+  {
+    xrt::bo bo;
+    size_t top = 0;     // next unused offset
+    size_t in_use = 0;  // blocks handed out
+  };
+
+  struct block
+  {
+    uint64_t arena;
+    size_t offset;
+  };
+
+  struct group
+  {
+    std::map<uint64_t, arena> arenas;
+    std::vector<std::vector<block>> free;  // per size class
+  };
+
+  xrt::device m_device;
+  xrt::hw_context m_hwctx;
+  xrt::bo::flags m_flags;
+  size_t m_arena_size;
+  size_t m_classes;
+
+  mutable std::mutex m_mutex;
+  std::map<xrt::memory_group, group> m_groups;
+  uint64_t m_arena_id = 0;
+  bo_pool::stats m_stats;
+
+  static size_t
+  validate_arena_size(size_t sz)
+  {
+    if (sz < min_arena_size || (sz & (sz - 1)))
+      throw xrt_core::error(-EINVAL, "bo_pool arena size must be a power of two of at least 64KB");
+    return sz;
+  }
+
+  size_t
+  block_size(size_t cls) const
+  {
+    return min_block << cls;
+  }
+
+  size_t
+  size_class(size_t sz) const
+  {
+    size_t cls = 0;
+    while (block_size(cls) < sz)
+      ++cls;
+    return cls;
+  }
+
+  xrt::bo
+  alloc_bo(size_t sz, xrt::memory_group grp) const
+  {
+    return m_hwctx
+      ? xrt::bo{m_hwctx, sz, m_flags, grp}
+      : xrt::bo{m_device, sz, m_flags, grp};
+  }
+
+  // Carve a block of class cls from an arena with room for it,
+  // reserve a new arena if none has room.
+  block
+  carve(group& g, xrt::memory_group grp, size_t cls)
+  {
+    auto bsz = block_size(cls);
+    for (auto& [id, a] : g.arenas) {
+      if (m_arena_size - a.top >= bsz) {
+        block blk {id, a.top};
+        a.top += bsz;
+        return blk;
+      }
+    }
+
+    auto id = m_arena_id++;
+    g.arenas.emplace(id, arena{alloc_bo(m_arena_size, grp)});
+    ++m_stats.arena_allocs;
+    ++m_stats.arenas;
+    m_stats.reserved_bytes += m_arena_size;
+
+    auto& a = g.arenas.at(id);
+    a.top = bsz;
+    return {id, 0};
+  }
+
+  // Purge the blocks of an arena from the free lists
+  static void
+  purge_arena(group& g, uint64_t id)
+  {
+    for (auto& fl : g.free)
+      fl.erase(std::remove_if(fl.begin(), fl.end(), [id](const block& b) { return b.arena == id; }), fl.end());
+  }
+
+  // Release an unused arena and purge its blocks from the free lists.
+  // The arena buffer is freed when the pool's reference is dropped.
+  void
+  release_arena(group& g, std::map<uint64_t, arena>::iterator itr)
+  {
+    purge_arena(g, itr->first);
+    g.arenas.erase(itr);
+    ++m_stats.arena_frees;
+    --m_stats.arenas;
+    m_stats.reserved_bytes -= m_arena_size;
+  }
+
+public:
+  bo_pool_impl(xrt::device device, xrt::hw_context hwctx, xrt::bo::flags flags, size_t arena_size)
+    : m_device(std::move(device))
+    , m_hwctx(std::move(hwctx))
+    , m_flags(flags)
+    , m_arena_size(validate_arena_size(arena_size))
+    , m_classes(size_class(m_arena_size / 16) + 1) // NOLINT
+  {}
+
+  xrt::bo
+  alloc(size_t sz, xrt::memory_group grp);
+
+  // Return a block to its size class free list, called when a pooled
+  // sub-buffer is destructed.
+  void
+  release(xrt::memory_group grp, uint64_t id, size_t cls, size_t offset)
+  {
+    std::lock_guard lk(m_mutex);
+    auto& g = m_groups.at(grp);
+    auto itr = g.arenas.find(id);
+    if (itr == g.arenas.end())
+      return;
+
+    g.free[cls].push_back({id, offset});
+    m_stats.used_bytes -= block_size(cls);
+    if (--itr->second.in_use)
+      return;
+
+    auto idle = std::count_if(g.arenas.begin(), g.arenas.end(), [](const auto& a) { return a.second.in_use == 0; });
+    if (static_cast<size_t>(idle) > max_idle_arenas) {
+      release_arena(g, itr);
+      return;
+    }
+
+    // Kept idle arena is reset such that blocks of any size class
+    // can be carved from it
+    purge_arena(g, id);
+    itr->second.top = 0;
+  }
+
+  bo_pool::stats
+  get_stats() const
+  {
+    std::lock_guard lk(m_mutex);
+    return m_stats;
+  }
+
+  size_t
+  trim()
+  {
+    std::lock_guard lk(m_mutex);
+    size_t released = 0;
+    for (auto& [grp, g] : m_groups) {
+      for (auto itr = g.arenas.begin(); itr != g.arenas.end();) {
+        auto curr = itr++;
+        if (curr->second.in_use)
+          continue;
+
+        release_arena(g, curr);
+        released += m_arena_size;
+      }
+    }
+    return released;
+  }
+};
+
+// class buffer_pooled - Sub buffer of a bo_pool arena
+//
+// Returns its block to the pool when destructed, unless the pool
+// has been destructed first.
+class buffer_pooled : public xrt::buffer_sub
+{
+  std::weak_ptr<bo_pool_impl> m_pool;
+  xrt::memory_group m_grp;
+  uint64_t m_arena;
+  size_t m_cls;
+
+public:
+  buffer_pooled(std::shared_ptr<bo_impl> par, size_t size, size_t off,
+                std::weak_ptr<bo_pool_impl> pool, xrt::memory_group grp, uint64_t arena, size_t cls)
+    : buffer_sub(std::move(par), size, off)
+    , m_pool(std::move(pool))
+    , m_grp(grp)
+    , m_arena(arena)
+    , m_cls(cls)
+  {}
+
+  ~buffer_pooled() override
+  {
+    try {
+      if (auto pool = m_pool.lock())
+        pool->release(m_grp, m_arena, m_cls, get_offset());
+    }
+    catch (...) {
+    }
+  }
+
+  buffer_pooled(const buffer_pooled&) = delete;
+  buffer_pooled(buffer_pooled&&) = delete;
+  buffer_pooled& operator=(const buffer_pooled&) = delete;
+  buffer_pooled& operator=(buffer_pooled&&) = delete;
+};
+
+xrt::bo
+bo_pool_impl::
+alloc(size_t sz, xrt::memory_group grp)
+{
+  XRT_TRACE_POINT_SCOPE(xrt_bo_pool_alloc);
+  auto cls = size_class(sz);
+  if (cls >= m_classes) {
+    {
+      std::lock_guard lk(m_mutex);
+      ++m_stats.fallback_allocs;
+    }
+    return alloc_bo(sz, grp);
+  }
+
+  block blk {};
+  std::shared_ptr<xrt::bo_impl> parent;
+  {
+    std::lock_guard lk(m_mutex);
+    auto& g = m_groups[grp];
+    if (g.free.empty())
+      g.free.resize(m_classes);
+
+    auto& fl = g.free[cls];
+    if (!fl.empty()) {
+      blk = fl.back();
+      fl.pop_back();
+      ++m_stats.reuses;
+    }
+    else {
+      blk = carve(g, grp, cls);
+    }
+
+    auto& a = g.arenas.at(blk.arena);
+    ++a.in_use;
+    parent = a.bo.get_handle();
+    ++m_stats.allocs;
+    m_stats.used_bytes += block_size(cls);
+  }
+
+  try {
+    return xrt::bo{std::make_shared<buffer_pooled>(std::move(parent), sz, blk.offset, weak_from_this(), grp, blk.arena, cls)};
+  }
+  catch (...) {
+    release(grp, blk.arena, cls, blk.offset);
+    throw;
+  }
+}
+
+bo_pool::
+bo_pool(const xrt::device& device, xrt::bo::flags flags, size_t arena_size)
+  : detail::pimpl<bo_pool_impl>(std::make_shared<bo_pool_impl>(device, xrt::hw_context{}, flags, arena_size))
+{}
+
+bo_pool::
+bo_pool(const xrt::hw_context& hwctx, xrt::bo::flags flags, size_t arena_size)
+  : detail::pimpl<bo_pool_impl>(std::make_shared<bo_pool_impl>(hwctx.get_device(), hwctx, flags, arena_size))
+{}
+
+xrt::bo
+bo_pool::
+alloc(size_t sz, xrt::memory_group grp)
+{
+  return handle->alloc(sz, grp);
+}
+
+bo_pool::stats
+bo_pool::
+get_stats() const
+{
+  return handle->get_stats();
+}
+
+size_t
+bo_pool::
+trim()
+{
+  return handle->trim();
+}
+
 } // xrt::ext
 
 ////////////////////////////////////////////////////////////////
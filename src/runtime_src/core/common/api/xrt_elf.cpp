@@ -15,17 +15,23 @@
 #include "core/common/trace.h"
 #include "core/common/xclbin_parser.h"
 #include "core/common/runner/capture.h"
+#include "core/common/runner/repo.h"
+#include "core/common/runner/detail/mmap.h"
 
 #include <boost/interprocess/streams/bufferstream.hpp>
 #include <elfio/elfio.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
+#include <exception>
 #include <map>
 #include <memory>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -199,12 +205,32 @@ construct_kernel_args(const std::string& signature)
 // of template to display specific error messages
 ///////////////////////////////////////////////////////////////
 
+// Load ELFIO from a read-only mapping of file.  ELFIO copies the
+// section data it loads, so the mapping is released after loading.
+static bool
+load_elfio_mmap(ELFIO::elfio& elfio, const std::string& fnm)
+{
+  try {
+    xrt_core::artifacts::detail::mmap_artifact map{fnm};
+    auto data = map.get_span();
+    boost::interprocess::ibufferstream istr(data.data(), data.size());
+    return elfio.load(istr);
+  }
+  catch (const std::exception&) {
+    return false;
+  }
+}
+
 // Load ELFIO from file path
 static ELFIO::elfio
 load_elfio(const std::string& fnm)
 {
   ELFIO::elfio elfio;
-  if (!elfio.load(fnm))
+  auto loaded = xrt_core::config::get_elf_mmap()
+    ? load_elfio_mmap(elfio, fnm)
+    : elfio.load(fnm);
+
+  if (!loaded)
     throw std::runtime_error(fnm + " is not found or is not a valid ELF file");
 
   if (xrt_core::config::get_xrt_debug()) {
@@ -325,6 +351,104 @@ public:
   }
 };
 
+////////////////////////////////////////////////////////////////
+// section_cache method implementations
+// (class declaration is in elf_int.h)
+////////////////////////////////////////////////////////////////
+section_cache::
+section_cache(const ELFIO::elfio& elf)
+  : m_elf{elf}
+  , m_enabled{xrt_core::config::get_elf_section_cache()}
+{}
+
+std::size_t
+section_cache::
+add(const ELFIO::section* sec)
+{
+  auto size = aiebu::get_section_uncompressed_size(sec, m_elf);
+
+  // Only compressed sections are worth caching, uncompressed
+  // sections are copied directly from ELFIO section data
+  if (m_enabled && (sec->get_flags() & ELFIO::SHF_COMPRESSED)) {
+    auto& e = m_entries[sec];
+    if (!e) {
+      e = std::make_unique<entry>();
+      e->size = size;
+    }
+  }
+
+  return size;
+}
+
+const std::vector<uint8_t>&
+section_cache::
+get(const ELFIO::section* sec, entry& e) const
+{
+  std::call_once(e.once, [this, sec, &e] {
+    XRT_TRACE_POINT_SCOPE(xrt_elf_section_decompress);
+    e.data.resize(e.size);
+    aiebu::copy_section_uncompressed_data(sec, m_elf, e.data.data(), e.size);
+  });
+  return e.data;
+}
+
+void
+section_cache::
+copy(const ELFIO::section* sec, uint8_t* dst, std::size_t size) const
+{
+  auto itr = m_entries.find(sec);
+  if (itr == m_entries.end()) {
+    aiebu::copy_section_uncompressed_data(sec, m_elf, dst, size);
+    return;
+  }
+
+  const auto& data = get(sec, *itr->second);
+  std::memcpy(dst, data.data(), std::min(size, data.size()));
+}
+
+void
+section_cache::
+decompress(unsigned int threads) const
+{
+  std::vector<std::pair<const ELFIO::section*, entry*>> work;
+  work.reserve(m_entries.size());
+  for (const auto& [sec, e] : m_entries)
+    work.emplace_back(sec, e.get());
+
+  // Largest sections first for better balance across threads
+  std::sort(work.begin(), work.end(), [](const auto& a, const auto& b) {
+    return a.second->size > b.second->size;
+  });
+
+  std::atomic<size_t> next{0};
+  std::exception_ptr eptr;
+  std::mutex mutex;
+  auto worker = [this, &work, &next, &eptr, &mutex] {
+    for (auto idx = next++; idx < work.size(); idx = next++) {
+      try {
+        get(work[idx].first, *work[idx].second);
+      }
+      catch (...) {
+        std::lock_guard lk(mutex);
+        if (!eptr)
+          eptr = std::current_exception();
+      }
+    }
+  };
+
+  auto num_threads = std::min<size_t>(threads, work.size());
+  std::vector<std::thread> workers;
+  for (size_t t = 1; t < num_threads; ++t)
+    workers.emplace_back(worker);
+
+  worker();
+  for (auto& t : workers)
+    t.join();
+
+  if (eptr)
+    std::rethrow_exception(eptr);
+}
+
 ////////////////////////////////////////////////////////////////
 // elf_impl method implementations
 // (class declaration is in elf_int.h)
@@ -338,6 +462,15 @@ elf_impl(ELFIO::elfio&& elfio, elf::platform platform, std::string path)
   , m_path{std::move(path)}
 {}
 
+// Decompress cached sections up front if so configured
+void
+elf_impl::
+decompress_sections() const
+{
+  if (auto threads = xrt_core::config::get_elf_decompress_threads())
+    m_section_cache.decompress(threads);
+}
+
 // Get symbol information from .symtab at given index
 elf_impl::symbol_info
 elf_impl::
@@ -699,7 +832,7 @@ class elf_aie_gen2 : public elf_impl
         continue;
 
       auto grp_idx = m_section_to_group_map[sec->get_index()];
-      buf_map[grp_idx].append_section_data(sec, m_elfio);
+      buf_map[grp_idx].append_section_data(sec, m_section_cache);
     }
   }
 
@@ -719,11 +852,11 @@ class elf_aie_gen2 : public elf_impl
         auto name = sec->get_name();
 
         if (name.find(save_pattern) != std::string::npos) {
-          m_save_buf_map[grp_id].append_section_data(sec, m_elfio);
+          m_save_buf_map[grp_id].append_section_data(sec, m_section_cache);
           has_save = true;
         }
         else if (name.find(restore_pattern) != std::string::npos) {
-          m_restore_buf_map[grp_id].append_section_data(sec, m_elfio);
+          m_restore_buf_map[grp_id].append_section_data(sec, m_section_cache);
           has_restore = true;
         }
       }
@@ -750,7 +883,7 @@ class elf_aie_gen2 : public elf_impl
       if (name.find(pdi_pattern) == std::string::npos)
         continue;
 
-      m_pdi_buf_map[name].append_section_data(sec, m_elfio);
+      m_pdi_buf_map[name].append_section_data(sec, m_section_cache);
     }
   }
 
@@ -764,7 +897,7 @@ class elf_aie_gen2 : public elf_impl
       if (name.find(pm_pattern) == std::string::npos)
         continue;
 
-      m_ctrlpkt_pm_bufs[name].append_section_data(sec, m_elfio);
+      m_ctrlpkt_pm_bufs[name].append_section_data(sec, m_section_cache);
     }
   }
 
@@ -926,6 +1059,8 @@ public:
     initialize_section_buffer_maps();
     // Initialize argument patchers from relocation sections
     initialize_arg_patchers();
+    // Optionally decompress compressed sections in parallel
+    decompress_sections();
   }
 
   // AIE2P: uses group sections if version >= 1.0 (for 1.0 and 2.0 + versions)
@@ -1170,17 +1305,17 @@ class elf_aie_gen2_plus : public elf_impl
           // embedded, meaning elf_sects contains only .ctrltext section
           const auto& page_sec = elf_sects.begin()->second;
           if (page_sec.ctrltext)
-            m_ctrlcodes_map[id][ucidx].append_section_data(page_sec.ctrltext, m_elfio);
+            m_ctrlcodes_map[id][ucidx].append_section_data(page_sec.ctrltext, m_section_cache);
         }
         else {
           // Per-page format: each page has separate ctrltext + ctrldata sections;
           // pad each page up to page boundary.
           for (auto& [page, page_sec] : elf_sects) {
             if (page_sec.ctrltext)
-              m_ctrlcodes_map[id][ucidx].append_section_data(page_sec.ctrltext, m_elfio);
+              m_ctrlcodes_map[id][ucidx].append_section_data(page_sec.ctrltext, m_section_cache);
 
             if (page_sec.ctrldata)
-              m_ctrlcodes_map[id][ucidx].append_section_data(page_sec.ctrldata, m_elfio);
+              m_ctrlcodes_map[id][ucidx].append_section_data(page_sec.ctrldata, m_section_cache);
 
             auto current_size = m_ctrlcodes_map[id][ucidx].size();
             auto target_size = (page + 1) * elf_page_size;
@@ -1200,7 +1335,7 @@ class elf_aie_gen2_plus : public elf_impl
         if (name.find(pad_pattern) == std::string::npos)
           continue;
         auto [col, page] = get_column_and_page(name, is_merged_format());
-        m_ctrlcodes_map[id][col].append_section_data(sec, m_elfio);
+        m_ctrlcodes_map[id][col].append_section_data(sec, m_section_cache);
       }
     }
   }
@@ -1217,7 +1352,7 @@ class elf_aie_gen2_plus : public elf_impl
         continue;
 
       buf ctrlpkt_buf;
-      ctrlpkt_buf.append_section_data(sec, m_elfio);
+      ctrlpkt_buf.append_section_data(sec, m_section_cache);
       auto grp_idx = m_section_to_group_map[sec->get_index()];
       m_ctrlpkt_buf_map[grp_idx][name] = std::move(ctrlpkt_buf);
     }
@@ -1235,7 +1370,7 @@ class elf_aie_gen2_plus : public elf_impl
         continue;
 
       auto ctrl_id = m_section_to_group_map[sec->get_index()];
-      m_dump_buf_map[ctrl_id].append_section_data(sec, m_elfio);
+      m_dump_buf_map[ctrl_id].append_section_data(sec, m_section_cache);
     }
   }
 
@@ -1370,6 +1505,8 @@ public:
     parse_sections();
     // Initialize all section buffer maps
     initialize_section_buffer_maps();
+    // Optionally decompress compressed sections in parallel
+    decompress_sections();
   }
 
   // AIE2PS/AIE4: uses group sections if version >= 0.3 (for 0.3 and 2.0 + versions)
@@ -23,6 +23,7 @@
 #include "core/include/xrt/detail/span.h"
 #include "core/include/ert_fa.h"
 
+#include "adaptive_wait.h"
 #include "bo.h"
 #include "command.h"
 #include "context_mgr.h"
@@ -72,6 +73,7 @@
 #include <memory>
 #include <mutex>
 #include <stdexcept>
+#include <sstream>
 #include <fstream>
 #include <type_traits>
 #include <utility>
@@ -525,8 +527,6 @@ struct device_type
   xrt_core::bo_cache exec_buffer_cache;
   uint32_t uid; // internal unique id for debug
 
-  static constexpr unsigned int cache_size = 128;
-
   static uint32_t
   create_uid()
   {
@@ -537,7 +537,7 @@ struct device_type
   explicit
   device_type(xrtDeviceHandle dhdl)
     : core_device(xrt_core::device_int::get_core_device(dhdl))
-    , exec_buffer_cache(core_device->get_device_handle(), cache_size)
+    , exec_buffer_cache(core_device->get_device_handle(), xrt_core::config::get_exec_buffer_cache_size())
     , uid(create_uid())
   {
     XRT_DEBUGF("device_type::device_type(%d)\n", uid);
@@ -546,16 +546,26 @@ struct device_type
   explicit
   device_type(std::shared_ptr<xrt_core::device> cdev)
     : core_device(std::move(cdev))
-    , exec_buffer_cache(core_device->get_device_handle(), cache_size)
+    , exec_buffer_cache(core_device->get_device_handle(), xrt_core::config::get_exec_buffer_cache_size())
     , uid(create_uid())
   {
     XRT_DEBUGF("device_type::device_type(%d)\n", uid);
   }
 
-  // NOLINTNEXTLINE(modernize-use-equals-default)
+  // Report the exec buffer cache counters at info verbosity, so
+  // Runtime.exec_buffer_cache_size can be sized from an application log
   ~device_type()
   {
     XRT_DEBUGF("device_type::~device_type(%d)\n", uid);
+    try {
+      auto stats = exec_buffer_cache.get_stats();
+      std::ostringstream msg;
+      msg << "exec buffer cache: hits(" << stats.hits << ") misses(" << stats.misses
+          << ") high_water(" << stats.high_water << ") max_size(" << stats.max_size << ")";
+      xrt_core::message::send(xrt_core::message::severity_level::info, "XRT", msg.str());
+    }
+    catch (...) {
+    }
   }
 
   device_type(const device_type&) = delete;
@@ -1048,6 +1058,8 @@ public:
       m_done = false;
     }
 
+    m_start_time = xrt_core::adaptive_wait::clock::now();
+
     try {
       if (m_managed)
         m_hwqueue.managed_start(this);
@@ -1063,10 +1075,34 @@ public:
     }
   }
 
-  // Wait for command completion
+  // Spin and poll for completion of an unmanaged command within the
+  // adaptive budget.  Return true if the command completed, in which
+  // case the command has been marked done.
+  bool
+  spin_wait(xrt_core::adaptive_wait* aw) const
+  {
+    if (!aw || m_managed)
+      return false;
+
+    auto done = [this] { return get_state_raw() >= ERT_CMD_STATE_COMPLETED; };
+    auto poll = [this] { m_hwqueue.poll(this); };
+    if (!aw->spin(m_start_time, done, poll))
+      return false;
+
+    notify(get_state_raw());
+    return true;
+  }
+
+  // Wait for command completion.  If an adaptive wait object is
+  // specified, then spin and poll before blocking.
   ert_cmd_state
-  wait() const
+  wait(xrt_core::adaptive_wait* aw = nullptr) const
   {
+    if (spin_wait(aw)) {
+      aw->record(m_start_time);
+      return get_state_raw();
+    }
+
     if (m_managed) {
       std::unique_lock<std::mutex> lk(m_mutex);
       while (!m_done)
@@ -1076,12 +1112,20 @@ public:
       m_hwqueue.wait(this);
     }
 
+    if (aw)
+      aw->record(m_start_time);
+
     return get_state_raw(); // state wont change after wait
   }
 
   std::pair<ert_cmd_state, std::cv_status>
-  wait(const std::chrono::milliseconds& timeout_ms) const
+  wait(const std::chrono::milliseconds& timeout_ms, xrt_core::adaptive_wait* aw = nullptr) const
   {
+    if (spin_wait(aw)) {
+      aw->record(m_start_time);
+      return {get_state_raw(), std::cv_status::no_timeout};
+    }
+
     if (m_managed) {
       std::unique_lock<std::mutex> lk(m_mutex);
       while (!m_done)
@@ -1093,6 +1137,9 @@ public:
         return {get_state_raw(), std::cv_status::timeout};
     }
 
+    if (aw)
+      aw->record(m_start_time);
+
     return {get_state_raw(), std::cv_status::no_timeout};
   }
 
@@ -1158,6 +1205,21 @@ public:
     auto off = xrt_core::bo_int::get_offset(bo);
     auto sz = bo.size();
     get_exec_bo()->bind_at(index, bh, off, sz);
+
+    // Record binding for exec buffers that shadow this command
+    auto itr = std::find_if(m_bound_args.begin(), m_bound_args.end(),
+                            [index](const auto& arg) { return arg.first == index; });
+    if (itr != m_bound_args.end())
+      itr->second = bo;
+    else
+      m_bound_args.emplace_back(index, bo);
+  }
+
+  // Buffers bound to the exec buffer by argument index
+  const std::vector<std::pair<size_t, xrt::bo>>&
+  get_bound_args() const
+  {
+    return m_bound_args;
   }
 
 private:
@@ -1165,9 +1227,11 @@ private:
   xrt_core::hw_queue m_hwqueue;  // hwqueue for command submission
   xrt::hw_context m_hwctx;       // hw_context for command
   execbuf_type m_execbuf;        // underlying execution buffer
+  std::vector<std::pair<size_t, xrt::bo>> m_bound_args;
   unsigned int m_uid = 0;
   bool m_managed = false;
   mutable bool m_done = false;
+  xrt_core::adaptive_wait::clock::time_point m_start_time;
 
   mutable std::mutex m_mutex;
   mutable std::condition_variable m_exec_done;
@@ -1605,6 +1669,8 @@ private:
                                               // buffer pool/cache of this ctrlpkt to reduce this overhead
   std::shared_ptr<xrt_core::usage_metrics::base_logger> m_usage_logger =
       xrt_core::usage_metrics::get_usage_metrics_logger();
+  mutable xrt_core::adaptive_wait m_adaptive_wait;
+                                              // Completion times of runs for hybrid wait
 
   // Open context of a specific compute unit.
   //
@@ -2223,6 +2289,15 @@ public:
     return hwctx;
   }
 
+  // Adaptive wait object if wait mode is hybrid, nullptr otherwise
+  xrt_core::adaptive_wait*
+  get_adaptive_wait(xrt::run::wait_mode mode) const
+  {
+    return (xrt_core::adaptive_wait::resolve(mode) == xrt::run::wait_mode::hybrid)
+      ? &m_adaptive_wait
+      : nullptr;
+  }
+
   xrt_core::hw_queue
   get_hw_queue() const
   {
@@ -2637,6 +2712,7 @@ class run_impl : public std::enable_shared_from_this<run_impl>
   bool encode_cumasks = false;            // indicate if cmd cumasks must be re-encoded
   std::shared_ptr<xrt_core::usage_metrics::base_logger> m_usage_logger =
       xrt_core::usage_metrics::get_usage_metrics_logger();
+  mutable xrt_core::usage_metrics::run_metrics m_usage_metrics; // usage metrics of this run
   std::atomic<uint64_t> m_runlist_counter{0}; // number of runlists containing this run
   std::mutex m_mutex;                     // mutex synchronization
   // Run-level dtrace ct file: stored so clone inherits it
@@ -3045,11 +3121,9 @@ public:
     xrt_core::xdp::run_start(this);
 
     // log kernel start info
-    // This is in critical path, we need to reduce log overhead
-    // as much as possible, passing kernel impl pointer instead of
-    // constructing args in place
-    // sending state as ERT_CMD_STATE_NEW for kernel start
-    m_usage_logger->log_kernel_run_info(kernel.get(), this, ERT_CMD_STATE_NEW);
+    // This is in critical path, the kernel's run counters are
+    // looked up on first start and cached in m_usage_metrics
+    m_usage_metrics.start(m_usage_logger.get(), kernel.get());
     cmd->run();
   }
 
@@ -3130,9 +3204,10 @@ public:
   virtual ert_cmd_state
   wait(const std::chrono::milliseconds& timeout_ms) const
   {
+    auto aw = kernel->get_adaptive_wait(xrt::run::wait_mode::ini);
     ert_cmd_state state {ERT_CMD_STATE_NEW}; // initial value doesn't matter
     if (timeout_ms.count()) {
-      auto [ert_state, cv_status] = cmd->wait(timeout_ms);
+      auto [ert_state, cv_status] = cmd->wait(timeout_ms, aw);
       if (cv_status == std::cv_status::timeout) {
         dump_logs(false);
 
@@ -3142,7 +3217,7 @@ public:
       state = ert_state;
     }
     else {
-      state = cmd->wait();
+      state = cmd->wait(aw);
     }
 
     // XDP profiling hook - called after wait completes
@@ -3211,11 +3286,12 @@ public:
   // Return std::cv_status::no_timeout on successful completion
   // Throw on abnormal command termination
   virtual std::cv_status
-  wait_throw_on_error(const std::chrono::milliseconds& timeout_ms) const
+  wait_throw_on_error(const std::chrono::milliseconds& timeout_ms, xrt::run::wait_mode mode) const
   {
+    auto aw = kernel->get_adaptive_wait(mode);
     ert_cmd_state state {ERT_CMD_STATE_NEW}; // initial value doesn't matter
     if (timeout_ms.count()) {
-      auto [ert_state, cv_status] = cmd->wait(timeout_ms);
+      auto [ert_state, cv_status] = cmd->wait(timeout_ms, aw);
       if (cv_status == std::cv_status::timeout) {
         // dump required logs before throwing error
         dump_logs(false);
@@ -3225,7 +3301,7 @@ public:
       state = ert_state;
     }
     else {
-      state = cmd->wait();
+      state = cmd->wait(aw);
     }
 
     // XDP profiling hook - called after wait completes
@@ -3299,7 +3375,7 @@ private:
       xrt_core::hw_context_int::dump_uc_log_buffer(kernel->get_hw_context());
     else
       // update usage logger in success cases
-      m_usage_logger->log_kernel_run_info(kernel.get(), this, ERT_CMD_STATE_COMPLETED);
+      m_usage_metrics.complete();
   }
 }; // class run_impl
 
@@ -3585,9 +3661,9 @@ class run_impl_debug : public RunImplType
   }
 
   std::cv_status
-  wait_throw_on_error(const std::chrono::milliseconds& timeout_ms) const override
+  wait_throw_on_error(const std::chrono::milliseconds& timeout_ms, xrt::run::wait_mode mode) const override
   {
-    auto status = RunImplType::wait_throw_on_error(timeout_ms);
+    auto status = RunImplType::wait_throw_on_error(timeout_ms, mode);
     XRT_REPLAY_CAPTURE(run_wait, this); // TODO: revisit for timeout
     return status;
   }
@@ -3738,6 +3814,16 @@ public:
 // submissions of chained ert commands.  The size
 // of a chain is currently hardwired, but at some
 // point will be dyanmic.
+//
+// A runlist has one or more execution slots.  Each slot holds the
+// chained commands for one execution of the runlist, such that a
+// pipelined runlist (depth > 1) can be executed again while prior
+// executions are still running.  Slots are used and retired in
+// order.  With a single slot (the default), the chained commands
+// refer to the exec buffers of the run objects.  With multiple
+// slots, each slot has its own shadow copy of the run object exec
+// buffers, which is refreshed from the run objects when the slot
+// is executed.
 class runlist_impl
 {
   friend class runlist_impl_debug;
@@ -3756,19 +3842,42 @@ class runlist_impl
   enum class state { idle, closed, running, error };
   mutable state m_state = state::idle;
 
-  xrt::hw_context m_hwctx;
-  xrt_core::hw_queue m_hwqueue;
-  std::vector<xrt::run> m_runlist;
-  std::vector<xrt_core::buffer_handle*> m_bos;
+  // struct shadow - Copy of a run object exec buffer
+  struct shadow
+  {
+    std::unique_ptr<xrt_core::buffer_handle> bo;
+    cmd_type* pkt = nullptr;
+    size_t size = 0;
+  };
 
+  // struct slot - Chained commands of one runlist execution
+  //
   // Commands are submitted in chained ert commands where the number
   // of chained commands in less than 'submit_size'. The ert chained
   // commands are created when run objects are added to the runlist.
-  // The created commands are owned by m_cmds, but passed around as
+  // The created commands are owned by cmds, but passed around as
   // pointers. Successfully submitted chained commands are added to
-  // m_submitted_cmds only after the runlist is closed.
-  std::vector<execbuf_type> m_cmds;
-  std::vector<execbuf_type*> m_submitted_cmds;
+  // submitted_cmds only after the runlist is closed.
+  struct slot
+  {
+    std::vector<execbuf_type> cmds;
+    std::vector<execbuf_type*> submitted_cmds;
+    std::vector<shadow> shadows; // one per run, empty if single slot
+    xrt_core::adaptive_wait::clock::time_point start_time;
+  };
+
+  xrt::hw_context m_hwctx;
+  xrt_core::hw_queue m_hwqueue;
+  std::vector<xrt::run> m_runlist;
+  std::vector<xrt_core::buffer_handle*> m_bos;
+
+  // Execution slots, m_head is the oldest running slot if any
+  std::vector<slot> m_slots;
+  mutable size_t m_head = 0;
+  mutable size_t m_running = 0;
+
+  // Completion times of runlist executions for hybrid wait
+  mutable xrt_core::adaptive_wait m_adaptive_wait;
 
   static const std::string&
   state_to_string(state st)
@@ -3794,6 +3903,19 @@ class runlist_impl
     return unpack(*execbuf);
   }
 
+  bool
+  is_pipelined() const
+  {
+    return m_slots.size() > 1;
+  }
+
+  // Oldest running slot, pre: m_running > 0
+  const slot&
+  head() const
+  {
+    return m_slots[m_head];
+  }
+
   // Execution buffers are cached and reused within this runlist
   // This function creates or gets an execbuf from the cache
   // and initializes the command in prep for add chained commands.
@@ -3809,19 +3931,47 @@ class runlist_impl
     return execbuf;
   }
 
+  // Create a shadow exec buffer of specified size, the content is
+  // copied from the run object when the shadow is executed
+  shadow
+  create_shadow(size_t size)
+  {
+    auto bo = m_hwctx.get_device().get_handle()->alloc_bo(size, XCL_BO_FLAGS_EXECBUF);
+    auto pkt = static_cast<cmd_type*>(bo->map(xrt_core::buffer_handle::map_type::write));
+    return {std::move(bo), pkt, size};
+  }
+
+  // Refresh shadow exec buffers of a slot from the run objects.  This
+  // copies the command packet prepared by run::prep_start() and binds
+  // the argument buffers of the run to the shadow.
+  void
+  refresh_shadows(slot& slt) const
+  {
+    for (size_t idx = 0; idx < slt.shadows.size(); ++idx) {
+      auto& shd = slt.shadows[idx];
+      auto run_cmd = m_runlist[idx].get_handle()->get_cmd();
+      auto pkt = run_cmd->get_ert_packet();
+      auto bytes = std::min(shd.size, sizeof(pkt->header) + pkt->count * word_size);
+      std::memcpy(shd.pkt, pkt, bytes);
+      for (const auto& [argidx, bo] : run_cmd->get_bound_args())
+        shd.bo->bind_at(argidx, xrt_core::bo_int::get_buffer_handle(bo),
+                        xrt_core::bo_int::get_offset(bo), bo.size());
+    }
+  }
+
   // The chained command execbufs are created as needed
   // when commands are added to the runlist.  Here we
   // get the cmd that chains the run at specified index.
   execbuf_type*
-  get_cmd_chain_for_run_at_index(size_t runidx)
+  get_cmd_chain_for_run_at_index(slot& slt, size_t runidx)
   {
     auto idx = runidx / submit_size;
-    if (idx < m_cmds.size())
-      return &m_cmds[idx];
+    if (idx < slt.cmds.size())
+      return &slt.cmds[idx];
 
-    m_cmds.push_back(create_exec_buf());
-    m_submitted_cmds.reserve(m_cmds.size());
-    return &m_cmds.at(idx);
+    slt.cmds.push_back(create_exec_buf());
+    slt.submitted_cmds.reserve(slt.cmds.size());
+    return &slt.cmds.at(idx);
   }
 
   void
@@ -3860,23 +4010,37 @@ class runlist_impl
     return static_cast<ert_cmd_state>(pkt->state);
   }
 
-  // Wait for the last succesfully submitted command to complete.  If
-  // the last submitted command has completed (error or not), then
-  // in-order execution guarantees that all prior commands have
-  // completed (error or not).
+  // Wait for the last succesfully submitted command of a slot to
+  // complete.  If the last submitted command has completed (error or
+  // not), then in-order execution guarantees that all prior commands
+  // have completed (error or not).
+  //
+  // With hybrid wait mode, spin and poll the last command before
+  // blocking.
   std::cv_status
-  wait_last_cmd(const std::chrono::milliseconds& timeout) const
+  wait_last_cmd(const slot& slt, const std::chrono::milliseconds& timeout, xrt::run::wait_mode mode) const
   {
-    if (m_submitted_cmds.empty())
+    if (slt.submitted_cmds.empty())
       return std::cv_status::no_timeout;
 
-    auto [cmd, pkt] = unpack(m_submitted_cmds.back());
-    return m_hwqueue.wait(cmd, timeout);
+    auto [cmd, pkt] = unpack(slt.submitted_cmds.back());
+    if (xrt_core::adaptive_wait::resolve(mode) != xrt::run::wait_mode::hybrid)
+      return m_hwqueue.wait(cmd, timeout);
+
+    auto done = [pkt = pkt] { return pkt->state >= ERT_CMD_STATE_COMPLETED; };
+    auto poll = [this, cmd = cmd] { m_hwqueue.poll(cmd); };
+    if (!m_adaptive_wait.spin(slt.start_time, done, poll)
+        && m_hwqueue.wait(cmd, timeout) == std::cv_status::timeout)
+      return std::cv_status::timeout;
+
+    m_adaptive_wait.record(slt.start_time);
+    return std::cv_status::no_timeout;
   }
 
-  // Poll the last command for completion.  If the last submitted
-  // command has comleted (error or not), then in-order execution
-  // guarantees that all prior command have completed (error or not).
+  // Poll the last command of the oldest running slot for completion.
+  // If the last submitted command has comleted (error or not), then
+  // in-order execution guarantees that all prior command have
+  // completed (error or not).
   //
   // This funtion returns the ert command packet state of the last
   // command or ERT_CMD_STATE_COMPLETED if no commands have been
@@ -3885,10 +4049,10 @@ class runlist_impl
   poll_last_cmd() const
   {
     // Treat empty runlist as completed
-    if (m_submitted_cmds.empty())
+    if (!m_running || head().submitted_cmds.empty())
       return ERT_CMD_STATE_COMPLETED;
 
-    auto [cmd, pkt] = unpack(m_submitted_cmds.back());
+    auto [cmd, pkt] = unpack(head().submitted_cmds.back());
 
     // For lazy state update the command must be polled. Polling
     // is a no-op on platforms where command state is live.
@@ -3935,25 +4099,67 @@ class runlist_impl
       xrt_core::hw_context_int::dump_uc_log_buffer(m_hwctx);
   }
 
-  // Wait for runlist to complete, then check each chained command
-  // submitted to determine potential error within chunk.  Locate the
-  // first failing command if any and mark all subsequent commands as
-  // aborted. Throw a runlist exception with first failing command if
-  // any.
+  // Copy state and results of the shadow exec buffers of a completed
+  // slot back to the run objects.  Arguments of the run objects are
+  // not copied back, they may already be set for a later execution.
+  // A failed command is copied in full, its payload may hold context
+  // health data.
+  void
+  copy_back_shadows(const slot& slt) const
+  {
+    for (size_t idx = 0; idx < slt.shadows.size(); ++idx) {
+      const auto& shd = slt.shadows[idx];
+      auto pkt = m_runlist[idx].get_ert_packet();
+      auto state = static_cast<ert_cmd_state>(shd.pkt->state);
+      if (state != ERT_CMD_STATE_COMPLETED) {
+        auto bytes = std::min(shd.size, sizeof(shd.pkt->header) + shd.pkt->count * word_size);
+        std::memcpy(pkt, shd.pkt, bytes);
+        continue;
+      }
+
+      if (shd.pkt->opcode == ERT_SK_START) {
+        uint32_t ret = 0;
+        ert_read_return_code(shd.pkt, ret);  // NOLINT
+        ert_write_return_code(pkt, ret);     // NOLINT
+      }
+      pkt->state = state;
+    }
+  }
+
+  // Retire the oldest running slot, a pipelined runlist copies the
+  // results of the slot back to the run objects
+  void
+  retire() const
+  {
+    if (is_pipelined())
+      copy_back_shadows(head());
+
+    m_head = (m_head + 1) % m_slots.size();
+    if (--m_running == 0)
+      m_state = state::idle;
+  }
+
+  // Wait for the oldest running slot to complete, then check each
+  // chained command submitted to determine potential error within
+  // chunk.  Locate the first failing command if any and mark all
+  // subsequent commands as aborted. Throw a runlist exception with
+  // first failing command if any.
   std::cv_status
-  wait(const std::chrono::milliseconds& timeout) const
+  wait(const std::chrono::milliseconds& timeout, xrt::run::wait_mode mode) const
   {
+    const auto& slt = head();
+
     // Wait on last chained command that was submitted; this implies
     // all have finished.
-    if (wait_last_cmd(timeout) == std::cv_status::timeout)
+    if (wait_last_cmd(slt, timeout, mode) == std::cv_status::timeout)
       return std::cv_status::timeout;
 
     // All submitted commands have completed (error or not).  If any
     // command failed to complete successfully, then all subsequent
     // commands are marked aborted including any unsubmitted commands.
     size_t runidx = 0;
-    for (auto execbuf : m_submitted_cmds) {
-      auto state = (execbuf == m_submitted_cmds.back())
+    for (auto execbuf : slt.submitted_cmds) {
+      auto state = (execbuf == slt.submitted_cmds.back())
         ? get_ert_state(execbuf)              // - already waited on in wait_last_cmd
         : get_completed_state(execbuf, 1ms);  // - involves calling wait()
       if (state == ERT_CMD_STATE_COMPLETED) {
@@ -3961,10 +4167,10 @@ class runlist_impl
         continue;
       }
 
-      // The runlist is idle now but an exception will be thrown
-      // with the first run object that failed.  The application
-      // must handle the exception and decide what to do next.
-      m_state = state::idle;
+      // The slot is retired but an exception will be thrown with
+      // the first run object that failed.  The application must
+      // handle the exception and decide what to do next.
+      retire();
 
       // Get the index of the first failing run object in the chained
       // command structure.  The index in chain_data is relative to
@@ -3988,23 +4194,24 @@ class runlist_impl
     return std::cv_status::no_timeout;
   }
 
-  // Submit runlist in chunks of submit size.  Make a note of last
-  // submitted command; in case of submit failure at least the last
-  // successfully submitted command must be waited for before the list
-  // can be reset. Pre-condition ensured by execute() is that size of
-  // runlist is greater than 0.
+  // Submit runlist slot in chunks of submit size.  Make a note of
+  // last submitted command; in case of submit failure at least the
+  // last successfully submitted command must be waited for before the
+  // list can be reset. Pre-condition ensured by execute() is that
+  // size of runlist is greater than 0.
   virtual void
-  submit()
+  submit(slot& slt)
   {
-    m_submitted_cmds.clear();
-    for (auto& execbuf : m_cmds) {
+    slt.submitted_cmds.clear();
+    slt.start_time = xrt_core::adaptive_wait::clock::now();
+    for (auto& execbuf : slt.cmds) {
       auto [cmd, pkt] = unpack(execbuf);
       pkt->state = ERT_CMD_STATE_NEW;
       // m_submitted commands reflect what has been successfully
       // submitted to the hwqueue. Resize to avoid exception during
       // emplace_back after hwqueue::submit.
       m_hwqueue.submit(cmd); // can throw
-      m_submitted_cmds.emplace_back(&execbuf); // no throw reserved size
+      slt.submitted_cmds.emplace_back(&execbuf); // no throw reserved size
     }
   }
 
@@ -4017,11 +4224,11 @@ public:
   }
 
 public:
-  explicit
-  runlist_impl(xrt::hw_context hwctx)
+  runlist_impl(xrt::hw_context hwctx, size_t depth)
     : m_exec_buffer_cache{hwctx.get_device().get_handle(), 128}
     , m_hwctx{std::move(hwctx)}
     , m_hwqueue{m_hwctx}
+    , m_slots(std::max<size_t>(depth, 1))
   {}
 
   virtual
@@ -4047,22 +4254,36 @@ public:
     m_runlist.reserve(runidx + 1);
     m_bos.reserve(runidx + 1);
 
-    auto execbuf = get_cmd_chain_for_run_at_index(runidx);
-    auto [cmd, pkt] = unpack(execbuf);
-    auto chain_data = get_ert_cmd_chain_data(pkt);
-
     auto run_impl = run.get_handle();
     auto run_cmd = run_impl->get_cmd();
     auto run_bo = run_cmd->get_exec_bo();
     auto run_bo_props = run_bo->get_properties();
 
-    auto data_idx = chain_data->command_count;
-    chain_data->data[data_idx] = run_bo_props.kmhdl;
+    // Pipelined runlist chains shadow exec buffers in all slots
+    std::vector<shadow> shadows;
+    if (is_pipelined()) {
+      shadows.reserve(m_slots.size());
+      for (auto& slt : m_slots) {
+        shadows.push_back(create_shadow(run_bo_props.size));
+        slt.shadows.reserve(runidx + 1);
+      }
+    }
+
+    for (size_t sidx = 0; sidx < m_slots.size(); ++sidx) {
+      auto execbuf = get_cmd_chain_for_run_at_index(m_slots[sidx], runidx);
+      auto [cmd, pkt] = unpack(execbuf);
+      auto chain_data = get_ert_cmd_chain_data(pkt);
+      auto bo = is_pipelined() ? shadows[sidx].bo.get() : run_bo;
+      auto bo_props = is_pipelined() ? bo->get_properties() : run_bo_props;
+
+      auto data_idx = chain_data->command_count;
+      chain_data->data[data_idx] = bo_props.kmhdl;
 
-    // Let shim handle binding of run_bo arguments to the command
-    // that cahins the run_bo.  This allows pinning if necessary.
-    // May throw, but so far no state change, so still safe.
-    cmd->bind_at(data_idx, run_bo, 0, run_bo_props.size);
+      // Let shim handle binding of run_bo arguments to the command
+      // that cahins the run_bo.  This allows pinning if necessary.
+      // May throw, but so far no state change, so still safe.
+      cmd->bind_at(data_idx, bo, 0, bo_props.size);
+    }
 
     // Once a run object is added to a list it will be in a state that
     // makes it impossible to start the run explicitly.  A run can be
@@ -4073,8 +4294,15 @@ public:
     run_impl->set_runlist(this);  // throws or changes state of run
 
     // Non throwing state change
-    chain_data->command_count++;
-    pkt->count += sizeof(uint64_t) / word_size; // account for added command
+    for (size_t sidx = 0; sidx < m_slots.size(); ++sidx) {
+      auto& slt = m_slots[sidx];
+      auto [cmd, pkt] = unpack(get_cmd_chain_for_run_at_index(slt, runidx));
+      auto chain_data = get_ert_cmd_chain_data(pkt);
+      chain_data->command_count++;
+      pkt->count += sizeof(uint64_t) / word_size; // account for added command
+      if (is_pipelined())
+        slt.shadows.push_back(std::move(shadows[sidx])); // reserved noexcept
+    }
     m_runlist.push_back(std::move(run));  // move of shared_ptr is noexcept
     m_bos.push_back(run_bo);              // ptr noexcept
   }
@@ -4082,8 +4310,10 @@ public:
   void
   execute(const xrt::runlist& rl)
   {
-    if (m_state != state::idle)
-      throw xrt_core::error("runlist must be idle before submitting for execution, current state: " + state_to_string(m_state));
+    if (m_state == state::closed || m_running == m_slots.size())
+      throw xrt_core::error(is_pipelined()
+        ? "runlist has no idle execution slot, wait() must be called before submitting for execution"
+        : "runlist must be idle before submitting for execution, current state: " + state_to_string(m_state));
 
     if (m_runlist.empty())
       return;
@@ -4092,6 +4322,10 @@ public:
     for (auto& run : m_runlist)
       run.get_handle()->prep_start();
 
+    auto& slt = m_slots[(m_head + m_running) % m_slots.size()];
+    if (is_pipelined())
+      refresh_shadows(slt);
+
     // Close the command list.
     m_state = state::closed;
 
@@ -4101,28 +4335,30 @@ public:
     // error properly while at least giving some hint as to where
     // things failed.
     try {
-      submit();
+      submit(slt);
     }
     catch (const std::exception&) {
+      ++m_running;
       m_state = state::running;
       throw;
     }
 
-    // The command list is now submitted (running).  It cannot be reset
-    // until wait() has been called and state changed to idle or error.
+    // The slot is now submitted (running).  The runlist cannot be
+    // reset until wait() has been called for all running slots.
+    ++m_running;
     m_state = state::running;
   }
 
-  // Wait for runlist completion.  Throw exception with first failing
-  // command if any.
+  // Wait for completion of oldest running execution.  Throw
+  // exception with first failing command if any.
   virtual std::cv_status
-  wait_throw_on_error(const std::chrono::milliseconds& timeout) const
+  wait_throw_on_error(const std::chrono::milliseconds& timeout, xrt::run::wait_mode mode) const
   {
     if (m_state != state::running)
       return std::cv_status::no_timeout;
 
     // Wait throws on error. On timeout just return
-    if (wait(timeout) == std::cv_status::timeout) {
+    if (wait(timeout, mode) == std::cv_status::timeout) {
       // dump required logs before returning timeout
       dump_logs(false);
       return std::cv_status::timeout;
@@ -4130,8 +4366,9 @@ public:
 
     dump_logs(true);
 
-    // On succesful wait, the runlist becomes idle
-    m_state = state::idle;
+    // On succesful wait, the slot is retired and the runlist becomes
+    // idle if no other slots are running
+    retire();
     return std::cv_status::no_timeout;
   }
 
@@ -4147,7 +4384,7 @@ public:
       return 0;
 
     // All commands have completed.  Handle errors.
-    wait_throw_on_error(std::chrono::milliseconds(0));
+    wait_throw_on_error(std::chrono::milliseconds(0), xrt::run::wait_mode::block);
     return 1;
   }
 
@@ -4161,7 +4398,7 @@ public:
     // All chained commands have completed.  Handle errors in
     // any of the submitted chained commands.
     try {
-      wait_throw_on_error(std::chrono::milliseconds(0));
+      wait_throw_on_error(std::chrono::milliseconds(0), xrt::run::wait_mode::block);
       return ERT_CMD_STATE_COMPLETED;
     }
     catch (const xrt::runlist::command_error& err) {
@@ -4181,8 +4418,13 @@ public:
 
     m_runlist.clear();
     m_bos.clear();
-    m_submitted_cmds.clear();
-    m_cmds.clear();
+    for (auto& slt : m_slots) {
+      slt.submitted_cmds.clear();
+      slt.cmds.clear();
+      slt.shadows.clear();
+    }
+    m_head = 0;
+    m_running = 0;
     m_state = state::idle;
   }
 }; // class runlist_impl
@@ -4194,9 +4436,9 @@ public:
 class runlist_impl_debug : public runlist_impl
 {
   void
-  submit() override
+  submit(slot& slt) override
   {
-    runlist_impl::submit();
+    runlist_impl::submit(slt);
     XRT_REPLAY_CAPTURE(runlist_start, this);
   }
 
@@ -4208,9 +4450,9 @@ class runlist_impl_debug : public runlist_impl
   }
 
   std::cv_status
-  wait_throw_on_error(const std::chrono::milliseconds& timeout) const override
+  wait_throw_on_error(const std::chrono::milliseconds& timeout, xrt::run::wait_mode mode) const override
   {
-    auto status = runlist_impl::wait_throw_on_error(timeout);
+    auto status = runlist_impl::wait_throw_on_error(timeout, mode);
     XRT_REPLAY_CAPTURE(runlist_wait, this); // TODO: revisit for tiemout
     return status;
   }
@@ -4390,12 +4632,12 @@ get_mailbox_impl(const xrt::run& run)
 }
 
 static std::shared_ptr<xrt::runlist_impl>
-alloc_runlist(const xrt::hw_context& hwctx)
+alloc_runlist(const xrt::hw_context& hwctx, size_t depth)
 {
   if (xrt_core::config::get_capture_frames())
-    return std::make_shared<xrt::runlist_impl_debug>(hwctx);
+    return std::make_shared<xrt::runlist_impl_debug>(hwctx, depth);
 
-  return std::make_shared<xrt::runlist_impl>(hwctx);
+  return std::make_shared<xrt::runlist_impl>(hwctx, depth);
 }
 
 ////////////////////////////////////////////////////////////////
@@ -4628,6 +4870,12 @@ get_kernel(const xrt::run& run)
   return run.get_handle()->get_kernel()->get_shared_ptr();
 }
 
+xrt_core::bo_cache_stats
+get_exec_buffer_cache_stats(const xrt::device& device)
+{
+  return get_device(device)->exec_buffer_cache.get_stats();
+}
+
 xrt::kernel
 get_kernel_from_impl(const xrt::kernel_impl* kernel_impl)
 {
@@ -4736,7 +4984,18 @@ wait2(const std::chrono::milliseconds& timeout_ms) const
   XRT_TRACE_POINT_SCOPE(xrt_run_wait2);
   return xdp::native::profiling_wrapper("xrt::run::wait",
     [this, &timeout_ms] {
-      return handle->wait_throw_on_error(timeout_ms);
+      return handle->wait_throw_on_error(timeout_ms, wait_mode::ini);
+    });
+}
+
+std::cv_status
+run::
+wait2(const std::chrono::milliseconds& timeout_ms, wait_mode mode) const
+{
+  XRT_TRACE_POINT_SCOPE(xrt_run_wait2);
+  return xdp::native::profiling_wrapper("xrt::run::wait",
+    [this, &timeout_ms, mode] {
+      return handle->wait_throw_on_error(timeout_ms, mode);
     });
 }
 
@@ -4965,7 +5224,12 @@ set_read_range(const xrt::kernel& kernel, uint32_t start, uint32_t size)
 
 runlist::
 runlist(const xrt::hw_context& hwctx)
-  : detail::pimpl<runlist_impl>(alloc_runlist(hwctx))
+  : detail::pimpl<runlist_impl>(alloc_runlist(hwctx, 1))
+{}
+
+runlist::
+runlist(const xrt::hw_context& hwctx, size_t depth)
+  : detail::pimpl<runlist_impl>(alloc_runlist(hwctx, depth))
 {}
 
 runlist::
@@ -5008,7 +5272,15 @@ runlist::
 wait(const std::chrono::milliseconds& timeout) const
 {
   XRT_TRACE_POINT_SCOPE(xrt_runlist_wait);
-  return handle->wait_throw_on_error(timeout);
+  return handle->wait_throw_on_error(timeout, xrt::run::wait_mode::ini);
+}
+
+std::cv_status
+runlist::
+wait(const std::chrono::milliseconds& timeout, xrt::run::wait_mode mode) const
+{
+  XRT_TRACE_POINT_SCOPE(xrt_runlist_wait);
+  return handle->wait_throw_on_error(timeout, mode);
 }
 
 ert_cmd_state
@@ -221,6 +221,10 @@ protected:
 
   // First patch flag - buffers are synced fully on first run
   bool m_first_patch = true;
+
+  // Dirty ranges per patched buffer when patch syncs are deferred
+  // until sync_if_dirty(), see Runtime.deferred_patch_sync
+  std::vector<std::pair<xrt::bo, xrt_core::elf_patcher::sync_ranges>> m_sync_ranges;
   // NOLINTEND
 
 private:
@@ -265,6 +269,34 @@ protected:
       bo.sync(XCL_BO_SYNC_BO_TO_DEVICE);
   }
 
+  // Dirty ranges of bo if patch syncs are deferred, nullptr otherwise
+  xrt_core::elf_patcher::sync_ranges*
+  get_sync_ranges(const xrt::bo& bo)
+  {
+    static bool deferred = xrt_core::config::get_deferred_patch_sync();
+    if (!deferred)
+      return nullptr;
+
+    for (auto& [rbo, ranges] : m_sync_ranges)
+      if (rbo == bo)
+        return &ranges;
+
+    return &m_sync_ranges.emplace_back(bo, xrt_core::elf_patcher::sync_ranges{}).second;
+  }
+
+  // Sync the dirty ranges of all patched buffers.  On first run the
+  // entire buffers are synced, so the ranges are simply dropped.
+  void
+  sync_patched_ranges()
+  {
+    for (auto& [bo, ranges] : m_sync_ranges) {
+      if (m_first_patch)
+        ranges.clear();
+      else
+        ranges.sync(bo);
+    }
+  }
+
   // Helper function for patching buffer with argument name or index
   bool
   patch_helper(xrt::bo& bo, uint64_t patch, xrt_core::elf_patcher::buf_type type,
@@ -298,7 +330,7 @@ protected:
     }
 
     // Call patch - symbol_patcher owns its state internally
-    patcher_it->second.patch_symbol(bo, patch, m_first_patch, is_arg);
+    patcher_it->second.patch_symbol(bo, patch, m_first_patch, is_arg, get_sync_ranges(bo));
 
     if (xrt_core::config::get_xrt_debug()) {
       if (not_found_use_argument_name) {
@@ -619,6 +651,7 @@ public:
 
     // sync full buffer only if its first time
     // For subsequent runs only part of buffer that is patched is synced
+    sync_patched_ranges();
     if (m_first_patch)
       m_instr_bo.sync(XCL_BO_SYNC_BO_TO_DEVICE);
 
@@ -1108,6 +1141,7 @@ public:
 
     // sync full buffer only if its first time
     // For subsequent runs only part of buffer that is patched is synced
+    sync_patched_ranges();
     if (m_first_patch)
       m_buffer.sync(XCL_BO_SYNC_BO_TO_DEVICE);
 
@@ -1293,6 +1327,12 @@ sync(const xrt::module& module)
   module.get_handle()->sync_if_dirty();
 }
 
+xrt_core::elf_patcher::patch_stats
+get_patch_stats()
+{
+  return xrt_core::elf_patcher::get_patch_stats();
+}
+
 bool
 is_dtrace_enabled(const xrt::module& module)
 {
@@ -8,10 +8,16 @@
 #define XRT_CORE_COMMON_SOURCE // in same dll as core_common
 #include "core/include/xrt/experimental/xrt_queue.h"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <queue>
 #include <thread>
+#include <vector>
 
 #ifdef _WIN32
 # pragma warning( disable : 4244 )
@@ -19,13 +25,258 @@
 
 namespace xrt {
 
+// class executor_impl - worker threads shared by many queues
+//
+// Each worker has a ready list of strands per priority.  A strand
+// that becomes ready is added to the ready list of the worker that
+// made it ready, or round-robin if it was made ready by a thread
+// that is not a worker of this executor.  A worker picks strands
+// from its own ready lists and steals from other workers when its
+// own lists are empty.  Higher priority strands are always picked
+// before lower priority strands.
+//
+// Once picked, a worker executes up to batch tasks of the strand
+// before rescheduling it at the end of its own ready list.
+class executor_impl
+{
+public:
+  // struct strand - tasks of one queue executed by an executor
+  //
+  // A strand is scheduled on the executor when it has tasks to
+  // execute and is not already scheduled.  At most one worker executes
+  // the tasks of a strand at any time, which preserves the in-order
+  // execution of tasks within a queue.
+  struct strand
+  {
+    std::mutex mutex;
+    std::queue<xrt::queue::task> tasks;
+    std::condition_variable idle;
+    size_t prio;
+    bool scheduled = false;         // in a ready list or being executed
+    bool running = false;           // worker is executing tasks
+    std::atomic<bool> stop {false}; // queue is being destructed
+
+    explicit
+    strand(xrt::queue::priority p)
+      : prio(static_cast<size_t>(p))
+    {}
+  };
+
+private:
+  static constexpr size_t num_priorities = 3;
+
+  struct worker
+  {
+    std::mutex mutex;
+    std::array<std::deque<std::shared_ptr<strand>>, num_priorities> ready;
+    std::vector<xrt::queue::task> batch;
+    std::thread thread;
+  };
+
+  // Identifies the executor and worker of the calling thread,
+  // zero-initialized for threads that are not workers
+  struct worker_id
+  {
+    const executor_impl* executor;
+    size_t idx;
+  };
+  static inline thread_local worker_id t_worker;
+
+  std::vector<std::unique_ptr<worker>> m_workers;
+  size_t m_batch;
+
+  std::atomic<size_t> m_pending {0};  // strands in ready lists
+  std::atomic<size_t> m_sleepers {0}; // workers waiting for work
+  std::atomic<size_t> m_next {0};     // round-robin for non-workers
+  std::mutex m_mutex;
+  std::condition_variable m_work;
+  bool m_stop = false;
+
+  // Add a ready strand to a worker's ready list.  Sleeping workers
+  // are notified only if any.  The sequentially consistent order of
+  // m_pending and m_sleepers ensures a worker about to sleep either
+  // sees the pending strand or is notified.
+  void
+  schedule(std::shared_ptr<strand> s)
+  {
+    auto idx = (t_worker.executor == this)
+      ? t_worker.idx
+      : m_next.fetch_add(1, std::memory_order_relaxed) % m_workers.size();
+    auto& w = *m_workers[idx];
+    auto prio = s->prio;
+    {
+      std::lock_guard lk(w.mutex);
+      w.ready[prio].push_back(std::move(s));
+    }
+
+    m_pending.fetch_add(1);
+    if (m_sleepers.load() > 0) {
+      std::lock_guard lk(m_mutex);
+      m_work.notify_one();
+    }
+  }
+
+  // Pick the highest priority ready strand, preferring own ready
+  // lists in order of scheduling, then stealing most recently
+  // scheduled strands from other workers.
+  std::shared_ptr<strand>
+  take(size_t idx)
+  {
+    if (m_pending.load() == 0)
+      return nullptr;
+
+    auto size = m_workers.size();
+    for (size_t prio = num_priorities; prio-- > 0;) {
+      for (size_t count = 0; count < size; ++count) {
+        auto& w = *m_workers[(idx + count) % size];
+        std::lock_guard lk(w.mutex);
+        auto& ready = w.ready[prio];
+        if (ready.empty())
+          continue;
+
+        std::shared_ptr<strand> s;
+        if (count == 0) {
+          s = std::move(ready.front());
+          ready.pop_front();
+        }
+        else {
+          s = std::move(ready.back());
+          ready.pop_back();
+        }
+        m_pending.fetch_sub(1);
+        return s;
+      }
+    }
+    return nullptr;
+  }
+
+  // Execute a batch of tasks from a strand, reschedule the strand
+  // if more tasks were enqueued meanwhile
+  void
+  execute(worker& w, const std::shared_ptr<strand>& s)
+  {
+    {
+      std::lock_guard lk(s->mutex);
+      while (!s->tasks.empty() && w.batch.size() < m_batch) {
+        w.batch.push_back(std::move(s->tasks.front()));
+        s->tasks.pop();
+      }
+      s->running = true;
+    }
+
+    // allow enqueue while executing
+    for (auto& task : w.batch) {
+      if (s->stop)
+        break;
+      task.execute();
+    }
+    w.batch.clear();
+
+    bool reschedule = false;
+    {
+      std::lock_guard lk(s->mutex);
+      s->running = false;
+      reschedule = !s->stop && !s->tasks.empty();
+      s->scheduled = reschedule;
+      if (s->stop)
+        s->idle.notify_all();
+    }
+
+    if (reschedule)
+      schedule(s);
+  }
+
+  // worker thread, executes strands as they become ready
+  void
+  run(size_t idx)
+  {
+    t_worker = {this, idx};
+    auto& w = *m_workers[idx];
+    w.batch.reserve(m_batch);
+    while (true) {
+      if (auto s = take(idx)) {
+        execute(w, s);
+        continue;
+      }
+
+      std::unique_lock lk(m_mutex);
+      m_sleepers.fetch_add(1);
+      m_work.wait(lk, [this] { return m_stop || m_pending.load() > 0; });
+      m_sleepers.fetch_sub(1);
+      if (m_stop)
+        return;
+    }
+  }
+
+public:
+  executor_impl(unsigned int threads, unsigned int batch)
+    : m_batch(std::max(batch, 1U))
+  {
+    if (threads == 0)
+      threads = std::max(std::thread::hardware_concurrency(), 1U);
+
+    for (unsigned int idx = 0; idx < threads; ++idx)
+      m_workers.push_back(std::make_unique<worker>());
+
+    for (size_t idx = 0; idx < m_workers.size(); ++idx)
+      m_workers[idx]->thread = std::thread([this, idx] { run(idx); });
+  }
+
+  // Shut down worker threads
+  ~executor_impl()
+  {
+    {
+      std::lock_guard lk(m_mutex);
+      m_stop = true;
+      m_work.notify_all();
+    }
+    for (auto& w : m_workers)
+      w->thread.join();
+  }
+
+  executor_impl(const executor_impl&) = delete;
+  executor_impl(executor_impl&&) = delete;
+  executor_impl& operator=(const executor_impl&) = delete;
+  executor_impl& operator=(executor_impl&&) = delete;
+
+  // Enqueue a task on a strand, schedule the strand if idle
+  void
+  enqueue(const std::shared_ptr<strand>& s, queue::task&& t)
+  {
+    bool idle = false;
+    {
+      std::lock_guard lk(s->mutex);
+      s->tasks.push(std::move(t));
+      idle = !s->scheduled;
+      s->scheduled = true;
+    }
+
+    if (idle)
+      schedule(s);
+  }
+
+  // Discard pending tasks of a strand and wait for a worker that
+  // is executing tasks of the strand to finish.
+  void
+  cancel(const std::shared_ptr<strand>& s)
+  {
+    std::queue<xrt::queue::task> discard;
+    std::unique_lock lk(s->mutex);
+    s->stop = true;
+    std::swap(discard, s->tasks);
+    s->idle.wait(lk, [&s] { return !s->running; });
+  }
+};
+
 // class queue_impl - insulated implemention of an xrt::queue
 //
 // Manages and executes enqueued tasks.
 // Tasks are executed and completed in order of enqueuing.
 //
-// A queue is associated with exactly one handler thread that executes
-// the task asynchronously to the enqueuer.
+// By default a queue is associated with exactly one handler thread
+// that executes the task asynchronously to the enqueuer.  A queue
+// constructed from an executor has no thread of its own, its tasks
+// are executed by the shared workers of the executor.
 class queue_impl
 {
   std::queue<xrt::queue::task> m_queue;  // task queue
@@ -36,6 +287,10 @@ class queue_impl
   // single worker thread to run the tasks
   std::thread m_worker;
 
+  // shared workers to run the tasks
+  std::shared_ptr<executor_impl> m_executor;
+  std::shared_ptr<executor_impl::strand> m_strand;
+
   // worker thread, executes tasks as they become ready
   void
   run()
@@ -65,9 +320,19 @@ public:
     : m_worker([this] { run(); })
   {}
 
+  queue_impl(std::shared_ptr<executor_impl> executor, queue::priority prio)
+    : m_executor(std::move(executor))
+    , m_strand(std::make_shared<executor_impl::strand>(prio))
+  {}
+
   // Shut down worker thread
   ~queue_impl()
   {
+    if (m_executor) {
+      m_executor->cancel(m_strand);
+      return;
+    }
+
     {
       std::lock_guard lk(m_mutex);
       m_stop = true;
@@ -85,6 +350,11 @@ public:
   void
   enqueue(queue::task&& t)
   {
+    if (m_executor) {
+      m_executor->enqueue(m_strand, std::move(t));
+      return;
+    }
+
     std::lock_guard lk(m_mutex);
     m_queue.push(std::move(t));
     m_work.notify_one();
@@ -98,11 +368,21 @@ public:
 ////////////////////////////////////////////////////////////////
 namespace xrt {
 
+queue::executor::
+executor(unsigned int threads, unsigned int batch)
+  : m_impl(std::make_shared<executor_impl>(threads, batch))
+{}
+
 queue::
 queue()
   : m_impl(std::make_shared<queue_impl>())
 {}
 
+queue::
+queue(const executor& exec, priority prio)
+  : m_impl(std::make_shared<queue_impl>(exec.m_impl, prio))
+{}
+
 void
 queue::
 add_task(task&& t)
@@ -391,7 +391,10 @@ class xclbin_impl
   // Also adds some computed data that is used by XRT core implementation.
   struct xclbin_info
   {
+    using xml_metadata = xrt_core::xclbin::xml_metadata;
+
     const xclbin_impl* m_ximpl;
+    std::shared_ptr<const xml_metadata> m_xml; // parsed XML meta data, shared
     std::string m_project_name;           // <project name="foo">
     std::string m_fpga_device_name;       // <device fpgaDevice="foo">
     std::vector<xclbin::mem> m_mems;
@@ -478,29 +481,43 @@ class xclbin_impl
       return ips;
     }
 
+    // init_xml() - get XML meta data
+    //
+    // The XML is parsed once per xclbin and memoized across xclbin
+    // objects with the same meta data.
+    static std::shared_ptr<const xml_metadata>
+    init_xml(const xclbin_impl* ximpl)
+    {
+      if (!ximpl->get_axlf_section(EMBEDDED_METADATA).first)
+        return nullptr;
+
+      return xrt_core::xclbin::get_xml_metadata(ximpl->get_axlf());
+    }
+
     // init_kernels() - populate m_kernels with xclbin::kernel objects
     //
-    // Iterate the XML meta data section and collect kernel meta data along
+    // Iterate the XML meta data and collect kernel meta data along
     // with compute units grouped by the kernel.
     //
     // Pre-condition for this function is that init_mems() and init_ips()
     // have been called.
     static std::vector<xclbin::kernel>
-    init_kernels(const xclbin_impl* ximpl, const std::vector<xclbin::ip>& ips)
+    init_kernels(const xml_metadata* xml, const std::vector<xclbin::ip>& ips)
     {
-      auto xml = ximpl->get_axlf_section(EMBEDDED_METADATA);
-      if (!xml.first)
+      if (!xml)
         return {};
 
       // get kernel CUs from xclbin meta data
       std::vector<xclbin::kernel> kernels;
-      for (auto& kernel : xrt_core::xclbin::get_kernels(xml.first, xml.second)) {
-        auto props = xrt_core::xclbin::get_kernel_properties(xml.first, xml.second, kernel.name);
+      for (const auto& kernel : xml->kernels) {
+        auto name = kernel.properties.name;
+        auto props = kernel.properties;
+        auto args = kernel.args;
         std::vector<xclbin::ip> cus;
-        copy_if_name_match(ips.begin(), ips.end(), std::back_inserter(cus), kernel.name);
+        copy_if_name_match(ips.begin(), ips.end(), std::back_inserter(cus), name);
         kernels.emplace_back
           (std::make_shared<xclbin::kernel_impl>
-           (std::move(kernel.name), std::move(props), std::move(cus), std::move(kernel.args)));
+           (std::move(name), std::move(props), std::move(cus), std::move(args)));
       }
 
       return kernels;
@@ -519,21 +536,15 @@ class xclbin_impl
     }
 
     static std::string
-    init_project_name(const xclbin_impl* ximpl)
+    init_project_name(const xml_metadata* xml)
     {
-      auto xml = ximpl->get_axlf_section(EMBEDDED_METADATA);
-      return xml.first
-        ? xrt_core::xclbin::get_project_name(xml.first, xml.second)
-        : "";
+      return xml ? xml->project_name : "";
     }
 
     static std::string
-    init_fpga_device_name(const xclbin_impl* ximpl)
+    init_fpga_device_name(const xml_metadata* xml)
     {
-      auto xml = ximpl->get_axlf_section(EMBEDDED_METADATA);
-      return xml.first
-        ? xrt_core::xclbin::get_fpga_device_name(xml.first, xml.second)
-        : "";
+      return xml ? xml->fpga_device_name : "";
     }
 
     // init_mem_encoding() - compress memory indices
@@ -610,11 +621,12 @@ class xclbin_impl
     explicit
     xclbin_info(const xrt::xclbin_impl* impl)
       : m_ximpl(impl)
-      , m_project_name(init_project_name(m_ximpl))
-      , m_fpga_device_name(init_fpga_device_name(m_ximpl))
+      , m_xml(init_xml(m_ximpl))
+      , m_project_name(init_project_name(m_xml.get()))
+      , m_fpga_device_name(init_fpga_device_name(m_xml.get()))
       , m_mems(init_mems(m_ximpl))
       , m_ips(init_ips(m_ximpl, m_mems))
-      , m_kernels(init_kernels(m_ximpl, m_ips))
+      , m_kernels(init_kernels(m_xml.get(), m_ips))
       , m_aie_partitions(init_aie_partitions(m_ximpl))
       , m_gmio_name_to_mem_index(init_gmio_connectivity(m_ximpl, m_kernels))
       , m_membank_encoding(init_mem_encoding(m_mems))
@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright (C) 2019 Xilinx, Inc
-// Copyright (C) 2022-2024 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc. All rights reserved.
 
 #ifndef core_common_bo_cache_h_
 #define core_common_bo_cache_h_
@@ -10,9 +10,14 @@
 #include "core/common/shim/buffer_handle.h"
 #include "core/include/xrt/detail/ert.h"
 
-#include <vector>
-#include <utility>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
 #include <mutex>
+#include <set>
+#include <utility>
+#include <vector>
 
 #ifdef _WIN32
 # pragma warning( push )
@@ -21,8 +26,38 @@
 
 namespace xrt_core {
 
+// struct bo_cache_stats - Counters for sizing a bo_cache
+//
+// @hits: Allocations served from the cache
+// @misses: Allocations that required a new BO from the driver
+// @high_water: Max number of BOs owned by the cache at any one time,
+//   both in use and cached
+// @cached: Current number of BOs in the shared depot
+// @max_size: Configured max number of BOs cached, in the shared depot
+//   and the per-thread magazines together
+struct bo_cache_stats
+{
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+  uint64_t high_water = 0;
+  uint64_t cached = 0;
+  uint64_t max_size = 0;
+};
+
 // Create a cache of CMD BO objects -- for now only used for M2M -- to reduce
 // the overhead of BO life cycle management.
+//
+// The cache is two-level.  Each thread that uses the cache gets its
+// own small magazine of BOs, which is used without any locking or
+// atomic read-modify-write operations.  An empty magazine is refilled
+// from, and a full magazine is partially flushed to, a shared depot
+// protected by a mutex.
+//
+// The depot and the magazines together hold at most max_size BOs.  A
+// magazine holds at most the capacity it has reserved out of max_size.
+// The magazines share half of max_size, the per-magazine target is
+// adjusted as threads come and go and is picked up by a magazine on its
+// next trip to the depot.
 template <size_t BoSize>
 class bo_cache_t
 {
@@ -35,33 +70,146 @@ public:
   static constexpr size_t bo_size = BoSize; // NOLINT
 
 private:
+  // Max number of BOs in a per-thread magazine
+  static constexpr unsigned int max_magazine_size = 16;
+
+  // struct magazine - Per thread cache of BOs
+  //
+  // Only the owning thread modifies a magazine, except when the
+  // magazine is retired.  The hit counter is atomic only so that it
+  // can be read by get_stats(), it is never updated with a locked
+  // instruction.  The reserved capacity is changed by the owning
+  // thread with the cache mutex held.
+  struct magazine
+  {
+    std::vector<cmd_bo<void>> bos;
+    std::atomic<uint64_t> hits {0};
+    unsigned int reserved = 0;
+  };
+
+  // struct thread_magazines - Magazines owned by a thread
+  //
+  // A thread can use multiple caches.  Entries are keyed by both
+  // cache address and a unique cache id, because a cache can be
+  // destructed and another constructed at the same address.  Magazines
+  // of caches that are still alive when the thread exits are returned
+  // to the owning cache.
+  struct thread_magazines
+  {
+    struct entry
+    {
+      bo_cache_t* cache;
+      uint64_t id;
+      magazine* mag;
+    };
+    std::vector<entry> entries;
+
+    thread_magazines() = default;
+    thread_magazines(const thread_magazines&) = delete;
+    thread_magazines(thread_magazines&&) = delete;
+    thread_magazines& operator=(const thread_magazines&) = delete;
+    thread_magazines& operator=(thread_magazines&&) = delete;
+
+    ~thread_magazines()
+    {
+      try {
+        std::lock_guard lk(live_mutex());
+        for (auto& e : entries)
+          if (live_caches().count(e.id))
+            e.cache->retire(e.mag);
+      }
+      catch (...) {
+      }
+    }
+  };
+
+  static std::mutex&
+  live_mutex()
+  {
+    static std::mutex mutex;
+    return mutex;
+  }
+
+  // Ids of constructed caches, guarded by live_mutex()
+  static std::set<uint64_t>&
+  live_caches()
+  {
+    static std::set<uint64_t> ids;
+    return ids;
+  }
+
+  static thread_magazines&
+  get_thread_magazines()
+  {
+    static thread_local thread_magazines tm;
+    return tm;
+  }
+
+  static uint64_t
+  create_id()
+  {
+    static std::atomic<uint64_t> count {0};
+    auto id = count++;
+    std::lock_guard lk(live_mutex());
+    live_caches().insert(id);
+    return id;
+  }
+
   std::shared_ptr<device> m_device;
   // Maximum number of BOs that can be cached in the pool. Value of 0 indicates
   // caching should be disabled.
   const unsigned int m_cache_max_size;
+  const uint64_t m_id;
   std::vector<cmd_bo<void>> m_cmd_bo_cache;
+  std::vector<std::unique_ptr<magazine>> m_magazines;
+  // Target capacity of each magazine, read by owners without the lock
+  std::atomic<unsigned int> m_magazine_limit {0};
+  // Sum of capacity reserved by magazines
+  unsigned int m_reserved = 0;
+  uint64_t m_hits = 0;
+  uint64_t m_misses = 0;
+  uint64_t m_allocated = 0;
+  uint64_t m_high_water = 0;
   std::mutex m_mutex;
 
 public:
   bo_cache_t(std::shared_ptr<xrt_core::device> device, unsigned int max_size)
-    : m_device(std::move(device)), m_cache_max_size(max_size)
+    : m_device(std::move(device))
+    , m_cache_max_size(max_size)
+    , m_id(create_id())
   {}
 
   bo_cache_t(xclDeviceHandle handle, unsigned int max_size)
-    : m_device(get_userpf_device(handle)), m_cache_max_size(max_size)
+    : m_device(get_userpf_device(handle))
+    , m_cache_max_size(max_size)
+    , m_id(create_id())
   {}
 
   ~bo_cache_t()
   {
     try {
+      // Prevent exiting threads from returning their magazines
+      {
+        std::lock_guard lk(live_mutex());
+        live_caches().erase(m_id);
+      }
+
       std::lock_guard<std::mutex> lock(m_mutex);
       for (auto& bo : m_cmd_bo_cache)
         destroy(bo);
+      for (auto& mag : m_magazines)
+        for (auto& bo : mag->bos)
+          destroy(bo);
     }
     catch (...) {
     }
   }
 
+  bo_cache_t(const bo_cache_t&) = delete;
+  bo_cache_t(bo_cache_t&&) = delete;
+  bo_cache_t& operator=(const bo_cache_t&) = delete;
+  bo_cache_t& operator=(bo_cache_t&&) = delete;
+
   template<typename T>
   cmd_bo<T>
   alloc()
@@ -77,37 +225,216 @@ public:
     release_impl(std::make_pair(std::move(bo.first), static_cast<void *>(bo.second)));
   }
 
+  bo_cache_stats
+  get_stats()
+  {
+    std::lock_guard lock(m_mutex);
+    bo_cache_stats stats;
+    stats.hits = m_hits;
+    for (auto& mag : m_magazines)
+      stats.hits += mag->hits.load(std::memory_order_relaxed);
+    stats.misses = m_misses;
+    stats.high_water = m_high_water;
+    stats.cached = m_cmd_bo_cache.size();
+    stats.max_size = m_cache_max_size;
+    return stats;
+  }
+
 private:
+  // Get the calling thread's magazine for this cache, create
+  // and register a new magazine on first use.
+  magazine*
+  get_magazine()
+  {
+    auto& tm = get_thread_magazines();
+    for (auto& e : tm.entries)
+      if (e.cache == this && e.id == m_id)
+        return e.mag;
+
+    // Drop entries for caches that no longer exist
+    {
+      std::lock_guard lk(live_mutex());
+      auto& live = live_caches();
+      tm.entries.erase(std::remove_if(tm.entries.begin(), tm.entries.end(),
+                                      [&live](const auto& e) { return live.count(e.id) == 0; }),
+                       tm.entries.end());
+    }
+
+    std::lock_guard lock(m_mutex);
+    m_magazines.push_back(std::make_unique<magazine>());
+    auto mag = m_magazines.back().get();
+    mag->bos.reserve(max_magazine_size);
+    tm.entries.push_back({this, m_id, mag});
+    update_magazine_limit();
+    return mag;
+  }
+
+  // Share half of the cache among the magazines, must be called
+  // with m_mutex held
+  void
+  update_magazine_limit()
+  {
+    auto count = static_cast<unsigned int>(m_magazines.size());
+    auto limit = count ? std::min(max_magazine_size, m_cache_max_size / (2 * count)) : 0;
+    m_magazine_limit.store(limit, std::memory_order_relaxed);
+  }
+
+  // Move a BO to the depot if the cache has room for it, otherwise to
+  // excess for the caller to destroy outside the lock.  Must be called
+  // with m_mutex held.
+  void
+  stash(cmd_bo<void>&& bo, std::vector<cmd_bo<void>>& excess)
+  {
+    if (m_cmd_bo_cache.size() + m_reserved < m_cache_max_size)
+      m_cmd_bo_cache.push_back(std::move(bo));
+    else
+      excess.push_back(std::move(bo));
+  }
+
+  // Adjust the capacity reserved by a magazine to the current target.
+  // Capacity is given back first, BOs beyond it are stashed.  Capacity
+  // is only taken if the cache has room.  Must be called by the owning
+  // thread with m_mutex held.
+  void
+  resize(magazine* mag, std::vector<cmd_bo<void>>& excess)
+  {
+    auto limit = m_magazine_limit.load(std::memory_order_relaxed);
+    if (mag->reserved > limit) {
+      std::vector<cmd_bo<void>> trimmed;
+      while (mag->bos.size() > limit) {
+        trimmed.push_back(std::move(mag->bos.back()));
+        mag->bos.pop_back();
+      }
+      m_reserved -= mag->reserved - limit;
+      mag->reserved = limit;
+      for (auto& bo : trimmed)
+        stash(std::move(bo), excess);
+    }
+    else if (mag->reserved < limit) {
+      auto used = m_reserved + m_cmd_bo_cache.size();
+      auto room = used < m_cache_max_size ? m_cache_max_size - used : 0;
+      auto grow = static_cast<unsigned int>(std::min<size_t>(limit - mag->reserved, room));
+      m_reserved += grow;
+      mag->reserved += grow;
+    }
+  }
+
+  // Return a magazine from an exiting thread to the depot
+  void
+  retire(magazine* mag)
+  {
+    std::vector<cmd_bo<void>> excess;
+    {
+      std::lock_guard lock(m_mutex);
+      m_hits += mag->hits.load(std::memory_order_relaxed);
+      m_reserved -= mag->reserved;
+      mag->reserved = 0;
+      for (auto& bo : mag->bos)
+        stash(std::move(bo), excess);
+      mag->bos.clear();
+      m_allocated -= excess.size();
+      auto itr = std::find_if(m_magazines.begin(), m_magazines.end(),
+                              [mag](const auto& m) { return m.get() == mag; });
+      if (itr != m_magazines.end())
+        m_magazines.erase(itr);
+      update_magazine_limit();
+    }
+
+    for (auto& bo : excess)
+      destroy(bo);
+  }
+
+  cmd_bo<void>
+  alloc_bo()
+  {
+    auto execHandle = m_device->alloc_bo(bo_size, XCL_BO_FLAGS_EXECBUF);
+    auto map = execHandle->map(buffer_handle::map_type::write);
+    return std::make_pair(std::move(execHandle), map);
+  }
+
   cmd_bo<void>
   alloc_impl()
   {
-    if (m_cache_max_size) {
-      // If caching is enabled first look up in the BO cache
+    if (!m_cache_max_size)
+      return alloc_bo();
+
+    // Common case, no locking
+    auto mag = get_magazine();
+    if (!mag->bos.empty()) {
+      auto bo = std::move(mag->bos.back());
+      mag->bos.pop_back();
+      mag->hits.store(mag->hits.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+      return bo;
+    }
+
+    // Refill half the magazine from the depot, leaving room for
+    // released BOs before the magazine must be flushed.
+    std::vector<cmd_bo<void>> excess;
+    {
       std::lock_guard lock(m_mutex);
+      resize(mag, excess);
+      m_allocated -= excess.size();
       if (!m_cmd_bo_cache.empty()) {
         auto bo = std::move(m_cmd_bo_cache.back());
         m_cmd_bo_cache.pop_back();
+        for (unsigned int i = 1; i < mag->reserved / 2 && !m_cmd_bo_cache.empty(); ++i) {
+          mag->bos.push_back(std::move(m_cmd_bo_cache.back()));
+          m_cmd_bo_cache.pop_back();
+        }
+        ++m_hits;
+        for (auto& ebo : excess)
+          destroy(ebo);
         return bo;
       }
     }
+    for (auto& ebo : excess)
+      destroy(ebo);
 
-    auto execHandle = m_device->alloc_bo(bo_size, XCL_BO_FLAGS_EXECBUF);
-    auto map = execHandle->map(buffer_handle::map_type::write);
-    return std::make_pair(std::move(execHandle), map);
+    auto bo = alloc_bo();
+    std::lock_guard lock(m_mutex);
+    ++m_misses;
+    m_high_water = std::max(m_high_water, ++m_allocated);
+    return bo;
   }
 
   void
   release_impl(cmd_bo<void>&& bo)
   {
-    if (m_cache_max_size) {
-      // If caching is enabled and BO cache is not fully populated add this the cache
+    if (!m_cache_max_size) {
+      destroy(bo);
+      return;
+    }
+
+    // Common case, no locking
+    auto mag = get_magazine();
+    if (mag->bos.size() < mag->reserved &&
+        mag->reserved <= m_magazine_limit.load(std::memory_order_relaxed)) {
+      mag->bos.push_back(std::move(bo));
+      return;
+    }
+
+    // Flush half of the full magazine to the depot.  BOs that do not
+    // fit in the cache are destroyed outside the lock.
+    std::vector<cmd_bo<void>> excess;
+    {
       std::lock_guard lock(m_mutex);
-      if (m_cmd_bo_cache.size() < m_cache_max_size) {
-        m_cmd_bo_cache.push_back(std::move(bo));
-        return;
+      resize(mag, excess);
+      if (!mag->bos.empty() && mag->bos.size() >= mag->reserved) {
+        auto count = std::max(1U, mag->reserved / 2);
+        for (unsigned int i = 0; i < count && !mag->bos.empty(); ++i) {
+          stash(std::move(mag->bos.back()), excess);
+          mag->bos.pop_back();
+        }
       }
+      if (mag->bos.size() < mag->reserved)
+        mag->bos.push_back(std::move(bo));
+      else
+        stash(std::move(bo), excess);
+      m_allocated -= excess.size();
     }
-    destroy(bo);
+
+    for (auto& ebo : excess)
+      destroy(ebo);
   }
 
   void
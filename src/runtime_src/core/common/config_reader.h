@@ -367,6 +367,16 @@ get_xdp_json()
   return value;
 }
 
+// Cache results of device queries that declare a cache policy,
+// e.g. static PCIe properties and sensor telemetry.  Disable to
+// always read from driver.
+inline bool
+get_query_cache()
+{
+  static bool value = detail::get_bool_value("Runtime.query_cache", true);
+  return value;
+}
+
 inline bool
 get_api_checks()
 {
@@ -381,6 +391,16 @@ get_use_xclbin_group_sections()
   return value;
 }
 
+// Directory for on-disk cache of xclbin XML meta data (kernel
+// properties and arguments) parsed by previous processes.  Empty
+// disables the cache.
+inline std::string
+get_xclbin_metadata_cache()
+{
+  static std::string value = detail::get_string_value("Runtime.xclbin_metadata_cache","");
+  return value;
+}
+
 inline std::string
 get_logging()
 {
@@ -388,6 +408,26 @@ get_logging()
   return value;
 }
 
+// Format and write console and file log messages from a background
+// thread.  Messages are queued in per-thread rings and dropped (and
+// counted) if a ring is full, errors and worse are never dropped and
+// flush the log before returning.
+inline bool
+get_logging_async()
+{
+  static bool value = detail::get_bool_value("Runtime.runtime_log_async", false);
+  return value;
+}
+
+// Number of messages each thread can queue with runtime_log_async
+// before messages are dropped, rounded up to a power of two.
+inline unsigned int
+get_logging_async_ring_size()
+{
+  static unsigned int value = detail::get_uint_value("Runtime.runtime_log_async_ring", 4096);
+  return value;
+}
+
 inline bool
 get_trace_logging()
 {
@@ -634,6 +674,92 @@ get_cmdbo_cache()
   return value;
 }
 
+/**
+ * Default wait mode for xrt::run and xrt::runlist wait calls.
+ * "block" waits in the driver, "hybrid" spins and polls for an
+ * adaptive budget before blocking.
+ */
+inline std::string
+get_wait_mode()
+{
+  static std::string value = detail::get_string_value("Runtime.wait_mode", "block");
+  return value;
+}
+
+/**
+ * Upper bound in microseconds of the adaptive spin budget used by
+ * hybrid wait.  Kernels that typically run longer do not spin.
+ */
+inline unsigned int
+get_wait_spin_max_us()
+{
+  static constexpr unsigned int default_spin_max_us = 50;
+  static unsigned int value = detail::get_uint_value("Runtime.wait_spin_max_us", default_spin_max_us);
+  return value;
+}
+
+/**
+ * Max number of exec BOs cached per device for kernel commands.
+ * Hit, miss, and high-water counts for sizing this value are logged
+ * at info verbosity when the device is closed, and are returned by
+ * xrt_core::kernel_int::get_exec_buffer_cache_stats().
+ */
+inline unsigned int
+get_exec_buffer_cache_size()
+{
+  static constexpr unsigned int default_cache_size = 128;
+  static unsigned int value = detail::get_uint_value("Runtime.exec_buffer_cache_size", default_cache_size);
+  return value;
+}
+
+/**
+ * Defer syncing of patched control code locations to device until
+ * the run is started, where dirty ranges are merged into as few
+ * syncs as possible.  If false, each patched location is synced
+ * when patched.
+ */
+inline bool
+get_deferred_patch_sync()
+{
+  static bool value = detail::get_bool_value("Runtime.deferred_patch_sync", true);
+  return value;
+}
+
+/**
+ * Load ELF files through a read-only memory mapping of the file
+ * rather than through a file stream.
+ */
+inline bool
+get_elf_mmap()
+{
+  static bool value = detail::get_bool_value("Runtime.elf_mmap", false);
+  return value;
+}
+
+/**
+ * Cache decompressed data of compressed ELF sections per xrt::elf,
+ * such that a section is decompressed once and shared by all runs
+ * of the ELF.  If false, sections are decompressed on each use.
+ */
+inline bool
+get_elf_section_cache()
+{
+  static bool value = detail::get_bool_value("Runtime.elf_section_cache", true);
+  return value;
+}
+
+/**
+ * Number of threads used to decompress all compressed sections of
+ * an ELF when it is loaded.  With 0, sections are decompressed on
+ * first use.  Only used with elf_section_cache.
+ */
+inline unsigned int
+get_elf_decompress_threads()
+{
+  static unsigned int value = detail::get_uint_value("Runtime.elf_decompress_threads", 0);
+  return value;
+}
+
 /**
  * Enable QDMA AIO (Asynchronous I/O) support.
  * Default is false.
@@ -719,6 +845,36 @@ get_capture_dir()
   return value;
 }
 
+// Capture mode for buffer data, "full" or "chunked".  In chunked mode
+// buffer data is dumped as content addressed chunks written by a
+// background thread, such that unchanged regions of large buffers
+// are not dumped again.
+inline std::string
+get_capture_mode()
+{
+  static auto value = detail::get_string_value("Runtime.capture_mode", "full");
+  return value;
+}
+
+// Capture output format, "files" or "pack".  In pack format all
+// captured artifacts are written to a single memory mappable file
+// artifacts.pack in the capture directory.
+inline std::string
+get_capture_format()
+{
+  static auto value = detail::get_string_value("Runtime.capture_format", "files");
+  return value;
+}
+
+// Max MB of captured data queued for background writing in chunked
+// capture mode.  Capturing blocks while the queue is full.
+inline unsigned int
+get_capture_writer_queue_mb()
+{
+  static auto value = detail::get_uint_value("Runtime.capture_writer_queue_mb", 256);
+  return value;
+}
+
 // Enable residency trim in xrt core.  This is used to trim down the
 // residency of buffers in the system when the buffers are unused
 // since last trim notification.  Affects Winndows MCDM UMD only.  If
@@ -843,6 +999,16 @@ get_flag_sw_emu_kernel_debug()
   return value;
 }
 
+// sw_emu buffer transfers copy directly to and from the device memory
+// file shared with the device process instead of sending the data over
+// the RPC socket.
+inline bool
+get_flag_sw_emu_shared_memory()
+{
+  static bool value = detail::get_bool_value("Emulation.sw_emu_shared_memory", false);
+  return value;
+}
+
 // This flag is added to exit device offline status check loop forcibly.
 // By default, device offline status loop runs for 320 seconds.
 inline unsigned int
@@ -84,6 +84,53 @@ get_ex_error_support() const
   return *m_ex_error_support;
 }
 
+std::any
+device::
+cached_query(query::key_type query_key, const query::cache_policy& policy) const
+{
+  static bool enabled = config::get_query_cache();
+  if (!enabled)
+    return lookup_query(query_key).get(this);
+
+  auto now = std::chrono::steady_clock::now();
+  {
+    std::lock_guard lk(m_query_cache_mutex);
+    auto itr = m_query_cache.find(query_key);
+    if (itr != m_query_cache.end()) {
+      auto& entry = (*itr).second;
+      if (entry.vol != query::cache_policy::volatility::ttl || now < entry.expires)
+        return entry.value;
+    }
+  }
+
+  // Query without lock held, concurrent misses may query twice but
+  // store the same value.  Errors propagate and are not cached.
+  auto value = lookup_query(query_key).get(this);
+
+  std::lock_guard lk(m_query_cache_mutex);
+  m_query_cache[query_key] =
+    {value, policy.vol, now + std::chrono::milliseconds(policy.ttl_ms)};
+  return value;
+}
+
+void
+device::
+invalidate_query_cache(bool reset) const
+{
+  std::lock_guard lk(m_query_cache_mutex);
+  if (reset) {
+    m_query_cache.clear();
+    return;
+  }
+
+  for (auto itr = m_query_cache.begin(); itr != m_query_cache.end();) {
+    if ((*itr).second.vol == query::cache_policy::volatility::static_value)
+      ++itr;
+    else
+      itr = m_query_cache.erase(itr);
+  }
+}
+
 uuid
 device::
 get_xclbin_uuid() const
@@ -279,6 +326,9 @@ register_axlf(const axlf* top)
 {
   xrt::uuid xid{top->m_header.uuid};
 
+  // Drop query results that depend on the loaded xclbin
+  invalidate_query_cache(false);
+
   // Update xclbin caching from [slot, xclbin_uuid]+ data
   update_xclbin_info();
 
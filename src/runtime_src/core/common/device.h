@@ -20,6 +20,7 @@
 #include "core/include/xrt/experimental/xrt_xclbin.h"
 
 #include <any>
+#include <chrono>
 #include <cstdint>
 #include <vector>
 #include <string>
@@ -222,6 +223,23 @@ public:
   virtual const query::request&
   lookup_query(query::key_type query_key) const = 0;
 
+  // Query through cache of query results per cache policy
+  XRT_CORE_COMMON_EXPORT
+  std::any
+  cached_query(query::key_type query_key, const query::cache_policy& policy) const;
+
+public:
+  /**
+   * invalidate_query_cache() - Drop cached query results
+   *
+   * @reset: Device was reset, drop also static values
+   *
+   * Called when an xclbin is loaded and when the device is reset.
+   */
+  XRT_CORE_COMMON_EXPORT
+  void
+  invalidate_query_cache(bool reset) const;
+
 public:
   /**
    * query() - Query the device for specific property
@@ -233,6 +251,10 @@ public:
   std::any
   query() const
   {
+    constexpr auto policy = query::cache_policy_of<QueryRequestType>::value;
+    if constexpr (policy.vol != query::cache_policy::volatility::none)
+      return cached_query(QueryRequestType::key, policy);
+
     auto& qr = lookup_query(QueryRequestType::key);
     return qr.get(this);
   }
@@ -518,6 +540,17 @@ public:
   xrt::xclbin m_xclbin;                       // currently loaded xclbin  (single-slot, default)
   xclbin_map m_xclbins;                       // currently loaded xclbins (multi-slot)
   mutable std::mutex m_mutex;
+
+  // Cached query results, see query::cache_policy
+  struct query_cache_entry
+  {
+    std::any value;
+    query::cache_policy::volatility vol;
+    std::chrono::steady_clock::time_point expires;
+  };
+  mutable std::mutex m_query_cache_mutex;
+  mutable std::map<query::key_type, query_cache_entry> m_query_cache;
+
   std::shared_ptr<usage_metrics::base_logger> m_usage_logger = usage_metrics::get_usage_metrics_logger();
   std::shared_ptr<context_mgr> m_ctx_mgr; // per device context manager
 };
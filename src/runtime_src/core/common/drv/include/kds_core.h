@@ -100,6 +100,7 @@ struct kds_cu_mgmt {
 	u32			  cu_refs[MAX_CUS];
 	struct cu_stats __percpu *cu_stats;
 	int			  rw_shared;
+	u32			  cu_policy; /* enum kds_cu_policy */
 };
 
 #define cu_stat_read(cu_mgmt, field) \
@@ -149,6 +150,7 @@ struct cmdmem_info {
  * @cu_intr: CU or ERT interrupt. 1 for CU, 0 for ERT.
  * @anon_client: driver own kds client used with driver generated command
  * @polling_thread: poll CUs when ERT is disabled
+ * @ert_policy_warned: ERT fallback of CU policy has been reported
  */
 #define KDS_SYSFS_SETTING_BIT	(1 << 31)
 #define KDS_SET_SYSFS_BIT(val)	(val | KDS_SYSFS_SETTING_BIT)
@@ -173,6 +175,7 @@ struct kds_sched {
 	bool			ert_disable;
 	bool                    force_polling;
 	u32			cu_intr;
+	bool			ert_policy_warned;
 
 	/* APU Timestamp Set Flag */
 	bool			timestamp_set;
@@ -231,6 +234,8 @@ int kds_ip_layout2scu_info(struct ip_layout *ip_layout, struct xrt_cu_info cu_in
 int store_kds_echo(struct kds_sched *kds, const char *buf, size_t count,
 		   int *echo);
 ssize_t show_kds_stat(struct kds_sched *kds, char *buf);
+int store_kds_cu_policy(struct kds_sched *kds, const char *buf, size_t count);
+ssize_t show_kds_cu_policy(struct kds_sched *kds, char *buf);
 ssize_t show_kds_custat_raw(struct kds_sched *kds, char *buf, size_t buf_size, loff_t offset);
 ssize_t show_kds_scustat_raw(struct kds_sched *kds, char *buf, size_t buf_size, loff_t offset);
 ssize_t kds_create_cu_string(struct xrt_cu *xcu, char (*buf)[MAX_CU_STAT_LINE_LENGTH],
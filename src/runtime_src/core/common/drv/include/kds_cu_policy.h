@@ -0,0 +1,125 @@
+/* SPDX-License-Identifier: GPL-2.0 OR Apache-2.0 */
+/*
+ * Xilinx Kernel Driver Scheduler - CU selection policy
+ *
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * This file is dual-licensed; you may select either the GNU General Public
+ * License version 2 or Apache License, Version 2.0.
+ *
+ * The policy functions only depend on plain integer types so the same
+ * code is used by KDS and by the user space CU simulator in drv/test.
+ */
+
+#ifndef _KDS_CU_POLICY_H
+#define _KDS_CU_POLICY_H
+
+#if defined(__KERNEL__)
+#include <linux/types.h>
+#include <linux/string.h>
+#else
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+typedef uint32_t u32;
+typedef uint64_t u64;
+#endif
+
+/* How KDS picks a CU when a command's CU mask has more than one CU
+ *
+ * KDS_CU_POLICY_USAGE: Fewest commands dispatched over the lifetime of
+ *   the CU. This is the historic behavior and the default.
+ * KDS_CU_POLICY_OUTSTANDING: Fewest commands dispatched but not yet
+ *   completed, i.e. the shortest queue.
+ * KDS_CU_POLICY_LATENCY: Lowest expected completion latency, estimated
+ *   as queue length times the CU's EWMA of command execution time.
+ *
+ * Queue length and latency are only known when KDS executes commands on
+ * the CUs, commands executed by ERT firmware are dispatched per usage.
+ */
+enum kds_cu_policy {
+	KDS_CU_POLICY_USAGE = 0,
+	KDS_CU_POLICY_OUTSTANDING,
+	KDS_CU_POLICY_LATENCY,
+	KDS_CU_POLICY_MAX,
+};
+
+/* EWMA weight of a new sample is 1/(1 << KDS_CU_EWMA_SHIFT) */
+#define KDS_CU_EWMA_SHIFT	3
+
+static inline const char *kds_cu_policy_name(u32 policy)
+{
+	switch (policy) {
+	case KDS_CU_POLICY_USAGE:	return "usage";
+	case KDS_CU_POLICY_OUTSTANDING:	return "outstanding";
+	case KDS_CU_POLICY_LATENCY:	return "latency";
+	default:			return "unknown";
+	}
+}
+
+/**
+ * kds_cu_policy_parse - Convert policy name to policy
+ *
+ * @buf: Policy name, optionally terminated by '\n'
+ * @count: Length of buf
+ *
+ * Returns: Policy or negative value if name is unknown
+ */
+static inline int kds_cu_policy_parse(const char *buf, size_t count)
+{
+	u32 policy;
+	size_t len;
+
+	if (count && buf[count - 1] == '\n')
+		--count;
+
+	for (policy = 0; policy < KDS_CU_POLICY_MAX; ++policy) {
+		len = strlen(kds_cu_policy_name(policy));
+		if (len == count && !strncmp(buf, kds_cu_policy_name(policy), len))
+			return policy;
+	}
+
+	return -1;
+}
+
+/**
+ * kds_cu_ewma_update - Fold a latency sample into an EWMA
+ *
+ * @ewma: Current average, 0 if there is no sample yet
+ * @sample: New sample
+ *
+ * Returns: Updated average
+ */
+static inline u64 kds_cu_ewma_update(u64 ewma, u64 sample)
+{
+	if (!ewma)
+		return sample ? sample : 1;
+
+	return ewma - (ewma >> KDS_CU_EWMA_SHIFT) + (sample >> KDS_CU_EWMA_SHIFT);
+}
+
+/**
+ * kds_cu_policy_score - Load of a CU according to policy
+ *
+ * @policy: Selection policy
+ * @usage: Commands dispatched to the CU since it was added
+ * @outstanding: Commands dispatched to the CU and not yet completed
+ * @ewma: EWMA of command execution time on the CU, 0 if unknown
+ *
+ * The CU with the lowest score is selected. A CU without latency samples
+ * is scored as if commands take 1ns, such that it is tried early and
+ * otherwise falls back to the shortest queue.
+ */
+static inline u64 kds_cu_policy_score(u32 policy, u64 usage, u32 outstanding, u64 ewma)
+{
+	switch (policy) {
+	case KDS_CU_POLICY_OUTSTANDING:
+		return outstanding;
+	case KDS_CU_POLICY_LATENCY:
+		return ((u64)outstanding + 1) * (ewma ? ewma : 1);
+	default:
+		return usage;
+	}
+}
+
+#endif
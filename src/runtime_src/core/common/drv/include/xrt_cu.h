@@ -23,6 +23,7 @@
 #include <linux/kthread.h>
 #include <linux/circ_buf.h>
 #include "kds_command.h"
+#include "kds_cu_policy.h"
 
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 6, 0)
 #define ioremap_nocache         ioremap
@@ -387,6 +388,15 @@ struct xrt_cu {
 	u32			   sleep_cnt;
 	u32			   max_running;
 
+	/* Load tracking for KDS CU selection policy.
+	 * outstanding: submitted but not yet completed commands
+	 * ewma_latency: EWMA of command execution time in ns, only
+	 *   updated if track_latency is set since ktime_get is not free
+	 */
+	atomic_t		   outstanding;
+	u32			   track_latency;
+	u64			   ewma_latency;
+
 	/* support user management CU interrupt */
 	DECLARE_BITMAP(is_ucu, 1);
 	wait_queue_head_t	   ucu_waitq;
@@ -400,6 +410,16 @@ struct xrt_cu {
 	struct circ_buf		   crc_buf;
 };
 
+static inline u32 xrt_cu_outstanding(struct xrt_cu *xcu)
+{
+	return atomic_read(&xcu->outstanding);
+}
+
+static inline u64 xrt_cu_ewma_latency(struct xrt_cu *xcu)
+{
+	return READ_ONCE(xcu->ewma_latency);
+}
+
 static inline char *prot2str(enum CU_PROTOCOL prot)
 {
 	switch (prot) {
@@ -45,6 +45,44 @@ int store_kds_echo(struct kds_sched *kds, const char *buf, size_t count,
 	return count;
 }
 
+static void kds_set_cu_policy(struct kds_cu_mgmt *cu_mgmt, u32 policy)
+{
+	int i;
+
+	mutex_lock(&cu_mgmt->lock);
+	cu_mgmt->cu_policy = policy;
+	for (i = 0; i < MAX_CUS; i++) {
+		if (!cu_mgmt->xcus[i])
+			continue;
+
+		cu_mgmt->xcus[i]->track_latency = (policy == KDS_CU_POLICY_LATENCY);
+	}
+	mutex_unlock(&cu_mgmt->lock);
+}
+
+int store_kds_cu_policy(struct kds_sched *kds, const char *buf, size_t count)
+{
+	int policy;
+
+	policy = kds_cu_policy_parse(buf, count);
+	if (policy < 0)
+		return -EINVAL;
+
+	/* Switching policy with live clients is safe. Commands in flight
+	 * stay on their CU, new commands are dispatched using the new policy.
+	 */
+	kds_set_cu_policy(&kds->cu_mgmt, policy);
+	kds_set_cu_policy(&kds->scu_mgmt, policy);
+	kds->ert_policy_warned = false;
+
+	return count;
+}
+
+ssize_t show_kds_cu_policy(struct kds_sched *kds, char *buf)
+{
+	return sprintf(buf, "%s\n", kds_cu_policy_name(kds->cu_mgmt.cu_policy));
+}
+
 ssize_t kds_create_cu_string(struct xrt_cu *xcu,
 		char (*buf)[MAX_CU_STAT_LINE_LENGTH],
 		int slot, int idx, u64 usage_count,
@@ -406,11 +444,13 @@ kds_client_set_cu_refs_zero(struct kds_client *client, int domain)
  * acquire_cu_idx - Get ready CU index
  *
  * @xcmd: Command
+ * @policy: CU selection policy
  *
  * Returns: Negative value for error. 0 or positive value for index
  */
 static int
-acquire_cu_idx(struct kds_cu_mgmt *cu_mgmt, int domain, struct kds_command *xcmd)
+acquire_cu_idx(struct kds_cu_mgmt *cu_mgmt, int domain, struct kds_command *xcmd,
+	       u32 policy)
 {
 	struct kds_client *client = xcmd->client;
 	/* User marked CUs */
@@ -421,8 +461,9 @@ acquire_cu_idx(struct kds_cu_mgmt *cu_mgmt, int domain, struct kds_command *xcmd
 	uint8_t valid_cus[MAX_CUS];
 	int num_valid = 0;
 	int8_t index;
-	u64 usage;
-	u64 min_usage;
+	struct xrt_cu *xcu;
+	u64 score;
+	u64 min_score;
 	int cu_set;
 	int i;
 
@@ -451,12 +492,19 @@ acquire_cu_idx(struct kds_cu_mgmt *cu_mgmt, int domain, struct kds_command *xcmd
 		return -EINVAL;
 	}
 
-	/* Find out the CU with minimum usage */
-	for (i = 1, index = valid_cus[0]; i < num_valid; ++i) {
-		usage = cu_stat_read(cu_mgmt, usage[valid_cus[i]]);
-		min_usage = cu_stat_read(cu_mgmt, usage[index]);
-		if (usage < min_usage)
+	/* Find out the CU with minimum load. The queue length and latency
+	 * are read without lock, a slightly stale value is good enough.
+	 */
+	for (i = 0, index = valid_cus[0], min_score = U64_MAX; i < num_valid; ++i) {
+		xcu = cu_mgmt->xcus[valid_cus[i]];
+		score = kds_cu_policy_score(policy,
+					    cu_stat_read(cu_mgmt, usage[valid_cus[i]]),
+					    xrt_cu_outstanding(xcu),
+					    xrt_cu_ewma_latency(xcu));
+		if (score < min_score) {
+			min_score = score;
 			index = valid_cus[i];
+		}
 	}
 
 out:
@@ -500,7 +548,8 @@ kds_cu_dispatch(struct kds_cu_mgmt *cu_mgmt, int domain, struct kds_command *xcm
 	int cu_idx = 0;
 
 	do {
-		cu_idx = acquire_cu_idx(cu_mgmt, domain, xcmd);
+		cu_idx = acquire_cu_idx(cu_mgmt, domain, xcmd,
+					READ_ONCE(cu_mgmt->cu_policy));
 	} while (cu_idx == -EAGAIN);
 	if (cu_idx < 0)
 		return cu_idx;
@@ -581,6 +630,29 @@ kds_submit_cu(struct kds_sched *kds, int domain, struct kds_command *xcmd)
 	return ret;
 }
 
+/**
+ * kds_ert_cu_policy - CU selection policy of ERT commands
+ *
+ * ERT firmware executes and completes commands, the outstanding commands
+ * and latency of a CU are not tracked in ERT mode. The policies which
+ * depend on them fall back to usage.
+ */
+static u32
+kds_ert_cu_policy(struct kds_sched *kds, struct kds_command *xcmd)
+{
+	u32 policy = READ_ONCE(kds->cu_mgmt.cu_policy);
+
+	if (policy == KDS_CU_POLICY_USAGE)
+		return policy;
+
+	if (!kds->ert_policy_warned) {
+		kds->ert_policy_warned = true;
+		kds_warn(xcmd->client, "CU policy %s is not supported with ERT, using usage",
+			 kds_cu_policy_name(policy));
+	}
+	return KDS_CU_POLICY_USAGE;
+}
+
 static int
 kds_submit_ert(struct kds_sched *kds, struct kds_command *xcmd)
 {
@@ -594,7 +666,8 @@ kds_submit_ert(struct kds_sched *kds, struct kds_command *xcmd)
 	case OP_START:
 		/* KDS should select a CU and set it in cu_mask */
 		do {
-			cu_idx = acquire_cu_idx(&kds->cu_mgmt, DOMAIN_PL, xcmd);
+			cu_idx = acquire_cu_idx(&kds->cu_mgmt, DOMAIN_PL, xcmd,
+						kds_ert_cu_policy(kds, xcmd));
 		} while(cu_idx == -EAGAIN);
 		if (cu_idx < 0)
 			return cu_idx;
@@ -1358,6 +1431,7 @@ static int _kds_add_cu(struct kds_sched *kds, int domain, struct xrt_cu *xcu)
 	 */
 
 	mutex_lock(&cu_mgmt->lock);
+	xcu->track_latency = (cu_mgmt->cu_policy == KDS_CU_POLICY_LATENCY);
 	/* Get a free slot in kds for this CU */
 	for (i = 0; i < MAX_CUS; i++) {
 		if (cu_mgmt->xcus[i] == NULL) {
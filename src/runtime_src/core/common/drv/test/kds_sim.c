@@ -0,0 +1,304 @@
+// SPDX-License-Identifier: GPL-2.0 OR Apache-2.0
+/*
+ * KDS CU selection policy simulator
+ *
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Drives the KDS CU selection policy (include/kds_cu_policy.h) with
+ * synthetic CUs so policies can be compared without hardware or a
+ * driver.  Commands arrive as a Poisson process and may run on any
+ * CU.  Each CU executes one command at a time in FIFO order, like a
+ * CU with a single credit, with a per-CU speed factor to model
+ * heterogeneous or degraded CUs.  The simulator mirrors what KDS
+ * tracks: lifetime usage is bumped on dispatch, outstanding commands
+ * on dispatch and completion, and the execution time EWMA is folded
+ * from CU start to completion.
+ *
+ * % gcc -O2 -Wall -I../include -o kds_sim kds_sim.c -lm
+ *
+ * % ./kds_sim [--cus <n>] [--speed <f,f,...>] [--service <us>]
+ *             [--dist fixed|exp] [--load <0..1>] [--commands <n>]
+ *             [--policy usage|outstanding|latency|all] [--seed <n>]
+ */
+#include "kds_cu_policy.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_SIM_CUS	128
+#define U64_MAX		UINT64_MAX
+
+struct sim_cmd {
+	u64 arrival;
+	u64 start;
+	u64 end;
+};
+
+struct sim_cu {
+	double speed;
+	u64 usage;
+	u64 ewma;
+	u64 busy_until;
+	/* FIFO of dispatched, not yet completed commands */
+	struct sim_cmd *queue;
+	size_t head;
+	size_t tail;
+	size_t max_queue;
+};
+
+struct sim_cfg {
+	int num_cus;
+	double speed[MAX_SIM_CUS];
+	double service_ns;
+	int exp_service;
+	double load;
+	size_t commands;
+	u64 seed;
+};
+
+static u64 rng_state;
+
+static u64 splitmix64(void)
+{
+	u64 z = (rng_state += 0x9e3779b97f4a7c15ULL);
+
+	z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+	return z ^ (z >> 31);
+}
+
+static double exponential(double mean)
+{
+	double u = (double)(splitmix64() >> 11) / (double)(1ULL << 53);
+
+	return -mean * log(1.0 - u);
+}
+
+static int cmp_u64(const void *a, const void *b)
+{
+	u64 x = *(const u64 *)a;
+	u64 y = *(const u64 *)b;
+
+	return (x > y) - (x < y);
+}
+
+static u32 outstanding(struct sim_cu *cu)
+{
+	return cu->tail - cu->head;
+}
+
+/* Complete commands that are done at time now, as the CU thread would */
+static void retire(struct sim_cu *cu, u64 now, u64 *latency, size_t *num_latency)
+{
+	struct sim_cmd *cmd;
+
+	while (cu->head != cu->tail) {
+		cmd = &cu->queue[cu->head];
+		if (cmd->end > now)
+			break;
+
+		cu->ewma = kds_cu_ewma_update(cu->ewma, cmd->end - cmd->start);
+		latency[(*num_latency)++] = cmd->end - cmd->arrival;
+		++cu->head;
+	}
+}
+
+static int run(const struct sim_cfg *cfg, u32 policy)
+{
+	struct sim_cu cus[MAX_SIM_CUS];
+	double capacity = 0;
+	double interarrival;
+	double service;
+	u64 *latency;
+	size_t num_latency = 0;
+	u64 now = 0;
+	u64 end = 0;
+	u64 score;
+	u64 min_score;
+	double sum = 0;
+	size_t n;
+	int idx;
+	int i;
+
+	memset(cus, 0, sizeof(cus));
+	latency = calloc(cfg->commands, sizeof(*latency));
+	if (!latency)
+		return -1;
+
+	for (i = 0; i < cfg->num_cus; ++i) {
+		cus[i].speed = cfg->speed[i];
+		cus[i].queue = calloc(cfg->commands, sizeof(struct sim_cmd));
+		if (!cus[i].queue)
+			return -1;
+		capacity += cfg->speed[i] / cfg->service_ns;
+	}
+
+	/* Same arrivals and service demands for every policy */
+	rng_state = cfg->seed;
+	interarrival = 1.0 / (capacity * cfg->load);
+
+	for (n = 0; n < cfg->commands; ++n) {
+		struct sim_cmd *cmd;
+		struct sim_cu *cu;
+
+		now += (u64)exponential(interarrival);
+		service = cfg->exp_service ? exponential(cfg->service_ns) : cfg->service_ns;
+
+		for (i = 0; i < cfg->num_cus; ++i)
+			retire(&cus[i], now, latency, &num_latency);
+
+		/* This is the selection loop of acquire_cu_idx() */
+		for (i = 0, idx = 0, min_score = U64_MAX; i < cfg->num_cus; ++i) {
+			score = kds_cu_policy_score(policy, cus[i].usage,
+						    outstanding(&cus[i]), cus[i].ewma);
+			if (score < min_score) {
+				min_score = score;
+				idx = i;
+			}
+		}
+
+		cu = &cus[idx];
+		++cu->usage;
+		cmd = &cu->queue[cu->tail++];
+		cmd->arrival = now;
+		cmd->start = cu->busy_until > now ? cu->busy_until : now;
+		cmd->end = cmd->start + (u64)(service / cu->speed) + 1;
+		cu->busy_until = cmd->end;
+		if (outstanding(cu) > cu->max_queue)
+			cu->max_queue = outstanding(cu);
+		if (cmd->end > end)
+			end = cmd->end;
+	}
+
+	for (i = 0; i < cfg->num_cus; ++i)
+		retire(&cus[i], end, latency, &num_latency);
+
+	qsort(latency, num_latency, sizeof(*latency), cmp_u64);
+	for (n = 0; n < num_latency; ++n)
+		sum += latency[n];
+
+	printf("policy %-11s mean %9.1f us  p50 %9.1f us  p99 %9.1f us  p99.9 %9.1f us  max %9.1f us\n",
+	       kds_cu_policy_name(policy),
+	       sum / num_latency / 1000.0,
+	       latency[num_latency * 50 / 100] / 1000.0,
+	       latency[num_latency * 99 / 100] / 1000.0,
+	       latency[num_latency * 999 / 1000] / 1000.0,
+	       latency[num_latency - 1] / 1000.0);
+	for (i = 0; i < cfg->num_cus; ++i) {
+		printf("  cu[%d] speed %.2f  share %5.1f%%  max queue %zu\n",
+		       i, cus[i].speed, 100.0 * cus[i].usage / cfg->commands,
+		       cus[i].max_queue);
+		free(cus[i].queue);
+	}
+
+	free(latency);
+	return 0;
+}
+
+static void usage(void)
+{
+	printf("usage: kds_sim [options]\n\n");
+	printf("  [--cus <n>]: number of CUs (default: 4)\n");
+	printf("  [--speed <f,f,...>]: relative speed per CU, missing CUs have speed 1 (default: 1,...,1,0.25)\n");
+	printf("  [--service <us>]: mean command execution time at speed 1 (default: 100)\n");
+	printf("  [--dist fixed|exp]: execution time distribution (default: exp)\n");
+	printf("  [--load <0..1>]: offered load relative to total CU capacity (default: 0.8)\n");
+	printf("  [--commands <n>]: number of commands to simulate (default: 200000)\n");
+	printf("  [--policy usage|outstanding|latency|all]: policy to simulate (default: all)\n");
+	printf("  [--seed <n>]: random seed (default: 1)\n");
+}
+
+int main(int argc, char *argv[])
+{
+	struct sim_cfg cfg;
+	const char *speed = NULL;
+	const char *opt;
+	const char *arg;
+	int policy = -1;
+	char *tok;
+	char *buf;
+	int i;
+
+	cfg.num_cus = 4;
+	cfg.service_ns = 100000;
+	cfg.exp_service = 1;
+	cfg.load = 0.8;
+	cfg.commands = 200000;
+	cfg.seed = 1;
+
+	for (i = 1; i < argc; ++i) {
+		opt = argv[i];
+		if (!strcmp(opt, "-h") || !strcmp(opt, "--help") || i + 1 == argc) {
+			usage();
+			return 1;
+		}
+
+		arg = argv[++i];
+		if (!strcmp(opt, "--cus"))
+			cfg.num_cus = atoi(arg);
+		else if (!strcmp(opt, "--speed"))
+			speed = arg;
+		else if (!strcmp(opt, "--service"))
+			cfg.service_ns = atof(arg) * 1000.0;
+		else if (!strcmp(opt, "--dist"))
+			cfg.exp_service = strcmp(arg, "fixed") != 0;
+		else if (!strcmp(opt, "--load"))
+			cfg.load = atof(arg);
+		else if (!strcmp(opt, "--commands"))
+			cfg.commands = strtoull(arg, NULL, 10);
+		else if (!strcmp(opt, "--seed"))
+			cfg.seed = strtoull(arg, NULL, 10);
+		else if (!strcmp(opt, "--policy")) {
+			if (strcmp(arg, "all"))
+				policy = kds_cu_policy_parse(arg, strlen(arg));
+			if (strcmp(arg, "all") && policy < 0) {
+				fprintf(stderr, "unknown policy '%s'\n", arg);
+				return 1;
+			}
+		} else {
+			fprintf(stderr, "unknown option '%s'\n", opt);
+			return 1;
+		}
+	}
+
+	if (cfg.num_cus < 1 || cfg.num_cus > MAX_SIM_CUS || cfg.load <= 0 ||
+	    cfg.service_ns <= 0 || !cfg.commands) {
+		usage();
+		return 1;
+	}
+
+	for (i = 0; i < cfg.num_cus; ++i)
+		cfg.speed[i] = 1.0;
+
+	/* By default one CU is degraded, which is where policies differ */
+	if (!speed && cfg.num_cus > 1)
+		cfg.speed[cfg.num_cus - 1] = 0.25;
+
+	if (speed) {
+		buf = strdup(speed);
+		for (i = 0, tok = strtok(buf, ","); tok && i < cfg.num_cus;
+		     tok = strtok(NULL, ","), ++i) {
+			cfg.speed[i] = atof(tok);
+			if (cfg.speed[i] <= 0) {
+				fprintf(stderr, "bad speed '%s'\n", tok);
+				return 1;
+			}
+		}
+		free(buf);
+	}
+
+	printf("cus %d  load %.2f  service %.1f us (%s)  commands %zu\n",
+	       cfg.num_cus, cfg.load, cfg.service_ns / 1000.0,
+	       cfg.exp_service ? "exp" : "fixed", cfg.commands);
+
+	for (i = 0; i < KDS_CU_POLICY_MAX; ++i) {
+		if (policy >= 0 && policy != i)
+			continue;
+		if (run(&cfg, i))
+			return 1;
+	}
+
+	return 0;
+}
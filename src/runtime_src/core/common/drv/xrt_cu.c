@@ -253,6 +253,23 @@ static inline void xrt_cu_idle_end(struct xrt_cu *xcu)
 	}
 	spin_unlock_irqrestore(&xcu->stats.xcs_lock, flags);
 }
+
+static inline void xrt_cu_update_latency(struct xrt_cu *xcu, struct kds_command *xcmd)
+{
+	u64 now;
+
+	/* Commands aborted before reaching the CU have no start time */
+	if (!xcu->track_latency || !xcmd->start)
+		return;
+
+	now = ktime_get_raw_fast_ns();
+	if (now < xcmd->start)
+		return;
+
+	WRITE_ONCE(xcu->ewma_latency,
+		   kds_cu_ewma_update(xcu->ewma_latency, now - xcmd->start));
+}
+
 /**
  * process_cq() - Process completed queue
  * @xcu: Target XRT CU
@@ -277,6 +294,8 @@ static inline void process_cq(struct xrt_cu *xcu)
 		xcu->bad_state = (xcmd->status == KDS_SKCRASHED);
 		xcmd->cb.notify_host(xcmd, xcmd->status);
 		xrt_cu_incr_ecmd_count(xcu);
+		xrt_cu_update_latency(xcu, xcmd);
+		atomic_dec(&xcu->outstanding);
 		list_del(&xcmd->list);
 		xcmd->cb.free(xcmd);
 		--xcu->num_cq;
@@ -419,9 +438,11 @@ static inline int process_rq(struct xrt_cu *xcu)
 	 * For some sort of CU, which usually has a relative long execute time,
 	 * we could hide this overhead and provide timestamp for each command.
 	 * But this implementation is used for general purpose. Please create CU
-	 * specific thread if needed.
+	 * specific thread if needed. It is also taken when the KDS CU
+	 * selection policy needs the execution time of this CU.
 	 */
-	//xcmd->start = ktime_get_raw_fast_ns();
+	if (xcu->track_latency)
+		xcmd->start = ktime_get_raw_fast_ns();
 	move_to_queue(xcmd, dst_q, dst_len);
 	--xcu->num_rq;
 	if (xcu->stats.max_sq_length < xcu->num_sq)
@@ -665,6 +686,7 @@ void xrt_cu_submit(struct xrt_cu *xcu, struct kds_command *xcmd)
 	 * wakeup CU thread if it is the first command
 	 */
 	spin_lock_irqsave(&xcu->pq_lock, flags);
+	atomic_inc(&xcu->outstanding);
 	list_add_tail(&xcmd->list, &xcu->pq);
 	++xcu->num_pq;
 	first_command = (xcu->num_pq == 1);
@@ -960,6 +982,8 @@ int xrt_cu_init(struct xrt_cu *xcu)
 	timer_setup(&xcu->stats.stats_timer, cu_stats_timer, 0);
 #endif
 	atomic_set(&xcu->tick, 0);
+	atomic_set(&xcu->outstanding, 0);
+	xcu->ewma_latency = 0;
 	xcu->start_tick = 0;
 	xcu->thread = NULL;
 	xcu->poll_threshold = CU_DEFAULT_POLL_THRESHOLD;
@@ -12,19 +12,28 @@
 #include "xrt/detail/version-git.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <climits>
+#include <condition_variable>
 #include <cstdarg>
+#include <cstdlib>
 #include <cstring>
 #include <fstream>
 #include <iostream>
-#include <map>
 #include <mutex>
+#include <sstream>
+#include <string_view>
 #include <thread>
+#include <vector>
 #ifdef __linux__
 # include <linux/limits.h>
 # include <sys/stat.h>
 # include <sys/types.h>
 #endif
+#ifndef _WIN32
+# include <pthread.h>
+#endif
 
 namespace {
 
@@ -63,47 +72,127 @@ public:
   virtual void send(severity_level, const char*, const char*) {};
 };
 
+static const char*
+severity_name(severity_level l)
+{
+  switch (l) {
+  case severity_level::emergency: return "EMERGENCY: ";
+  case severity_level::alert:     return "ALERT: ";
+  case severity_level::critical:  return "CRITICAL: ";
+  case severity_level::error:     return "ERROR: ";
+  case severity_level::warning:   return "WARNING: ";
+  case severity_level::notice:    return "NOTICE: ";
+  case severity_level::info:      return "INFO: ";
+  case severity_level::debug:     return "DEBUG: ";
+  }
+  return "";
+}
+
+// class stream_dispatch - Base for dispatchers writing to a stream
+//
+// Separates formatting of a message from writing it, such that
+// messages can be formatted in batches away from the thread that
+// logged them (async_dispatch).  Formatting must only use what is
+// passed as arguments, time and thread id in particular are captured
+// by the caller.  Formatting may update state of the dispatcher, so
+// callers of format() must hold the mutex of the dispatcher.
+class stream_dispatch : public message_dispatch
+{
+  std::mutex m_mutex;
+
+protected:
+  using clock = std::chrono::system_clock;
+
+  virtual std::ostream&
+  stream() = 0;
+
+public:
+  // Serializes format() and writes to the stream
+  std::mutex&
+  mutex()
+  {
+    return m_mutex;
+  }
+
+  virtual void
+  format(std::ostream& os, severity_level l, clock::time_point time,
+         std::thread::id tid, std::string_view tag, std::string_view msg) = 0;
+
+  void
+  send(severity_level l, const char* tag, const char* msg) override
+  {
+    std::lock_guard lk(m_mutex);
+    auto& os = stream();
+    format(os, l, clock::now(), std::this_thread::get_id(), tag, msg);
+    os.flush();
+  }
+
+  // Write already formatted messages
+  void
+  write(const std::string& batch)
+  {
+    std::lock_guard lk(m_mutex);
+    auto& os = stream();
+    os << batch;
+    os.flush();
+  }
+};
+
 //--
-class console_dispatch : public message_dispatch
+class console_dispatch : public stream_dispatch
 {
 public:
   console_dispatch();
-  virtual ~console_dispatch() {}
-  virtual void send(severity_level l, const char* tag, const char* msg) override;
 
-private:
-  std::map<severity_level, const char*> severityMap = {
-    { severity_level::emergency, "EMERGENCY: "},
-    { severity_level::alert,     "ALERT: "},
-    { severity_level::critical,  "CRITICAL: "},
-    { severity_level::error,     "ERROR: "},
-    { severity_level::warning,   "WARNING: "},
-    { severity_level::notice,    "NOTICE: "},
-    { severity_level::info,      "INFO: "},
-    { severity_level::debug,     "DEBUG: "}
-  };
+  void
+  format(std::ostream& os, severity_level l, clock::time_point,
+         std::thread::id, std::string_view tag, std::string_view msg) override
+  {
+    os << "[" << tag << "] " << severity_name(l) << msg << "\n";
+  }
+
+protected:
+  std::ostream&
+  stream() override
+  {
+    return std::cerr;
+  }
 };
 
 //--
-class file_dispatch : public message_dispatch
+class file_dispatch : public stream_dispatch
 {
 public:
   explicit
   file_dispatch(const std::string& file);
-  virtual ~file_dispatch();
-  virtual void send(severity_level l, const char* tag, const char* msg) override;
+  ~file_dispatch() override;
+
+  void
+  format(std::ostream& os, severity_level l, clock::time_point time,
+         std::thread::id tid, std::string_view tag, std::string_view msg) override
+  {
+    // Formatting the timestamp dominates, reuse it within a second
+    auto sec = std::chrono::time_point_cast<std::chrono::seconds>(time);
+    if (sec != m_last_time) {
+      m_last_time = sec;
+      m_last_timestamp = xrt_core::timestamp(time);
+    }
+
+    os << "[" << m_last_timestamp << "] [" << tag << "] Tid: "
+       << tid << ", " << " " << severity_name(l) << msg << "\n";
+  }
+
+protected:
+  std::ostream&
+  stream() override
+  {
+    return handle;
+  }
+
 private:
   std::ofstream handle;
-  std::map<severity_level, const char*> severityMap = {
-    { severity_level::emergency, "EMERGENCY: "},
-    { severity_level::alert,     "ALERT: "},
-    { severity_level::critical,  "CRITICAL: "},
-    { severity_level::error,     "ERROR: "},
-    { severity_level::warning,   "WARNING: "},
-    { severity_level::notice,    "NOTICE: "},
-    { severity_level::info,      "INFO: "},
-    { severity_level::debug,     "DEBUG: "}
-  };
+  std::chrono::time_point<clock, std::chrono::seconds> m_last_time;
+  std::string m_last_timestamp;
 };
 
 //file ops
@@ -126,17 +215,6 @@ file_dispatch::~file_dispatch() {
   handle.close();
 }
 
-void
-file_dispatch::
-send(severity_level l, const char* tag, const char* msg)
-{
-  static std::mutex mutex;
-  std::lock_guard<std::mutex> lk(mutex);
-  handle << "[" << xrt_core::timestamp() <<"] [" << tag << "] Tid: "
-         << std::this_thread::get_id() << ", " << " " << severityMap[l]
-         << msg << std::endl;
-}
-
 //console ops
 console_dispatch::
 console_dispatch()
@@ -152,14 +230,392 @@ console_dispatch()
   std::cerr << "EXE: " << get_exe_path() << std::endl;
 }
 
-void
-console_dispatch::
-send(severity_level l, const char* tag, const char* msg)
+// class async_dispatch - Format and write messages from a background thread
+//
+// Each logging thread owns a fixed size ring of message slots that
+// only it pushes to and only the writer pops from, so logging is a
+// copy of tag and message into a slot whose string capacity is
+// reused, with no lock taken and no formatting or I/O done.
+//
+// The writer thread wakes up periodically, or when a ring is half
+// full, drains all rings, formats the messages in time order and
+// writes them to the stream with a single write and flush.
+//
+// When a ring is full the message is dropped and counted, the count
+// is written to the log with the next batch.  Messages of severity
+// error or worse are never dropped; they flush all queued messages
+// and return only when the message has been written, such that
+// nothing preceding a crash is lost.
+//
+// At process exit all queued messages are written.  Messages logged
+// after that are written synchronously.
+//
+// A forked child has no writer thread.  Fork handlers hold all locks
+// across fork, and in the child discard messages queued by the parent,
+// which the parent writes, and switch to writing synchronously.
+class async_dispatch : public message_dispatch
 {
-  static std::mutex mutex;
-  std::lock_guard<std::mutex> lk(mutex);
-  std::cerr << "[" << tag << "] " << severityMap[l]
-            << msg << std::endl;
+  using clock = std::chrono::system_clock;
+  static constexpr auto flush_interval = std::chrono::milliseconds(10);
+
+  struct slot
+  {
+    severity_level level = severity_level::debug;
+    clock::time_point time;
+    std::thread::id tid;
+    std::string tag;
+    std::string msg;
+  };
+
+  // Single producer, single consumer ring of messages.  head and
+  // tail increase monotonically and are masked on access.
+  struct ring
+  {
+    std::vector<slot> slots;
+    size_t mask;
+    alignas(64) std::atomic<size_t> head {0};  // consumer
+    alignas(64) std::atomic<size_t> tail {0};  // producer
+    std::atomic<uint64_t> dropped {0};
+    std::atomic<bool> orphaned {false};
+
+    explicit
+    ring(size_t size)
+      : slots(size), mask(size - 1)
+    {}
+
+    // Returns number of queued messages including the pushed one,
+    // or 0 if the ring is full.
+    size_t
+    push(severity_level l, clock::time_point time, const char* tag, const char* msg)
+    {
+      auto t = tail.load(std::memory_order_relaxed);
+      auto h = head.load(std::memory_order_acquire);
+      if (t - h > mask)
+        return 0;
+
+      auto& s = slots[t & mask];
+      s.level = l;
+      s.time = time;
+      s.tid = std::this_thread::get_id();
+      s.tag.assign(tag);
+      s.msg.assign(msg);
+      tail.store(t + 1, std::memory_order_release);
+      return t + 1 - h;
+    }
+
+    // Move queued messages to batch, strings are swapped such that
+    // the ring reuses the capacity of previously drained strings.
+    void
+    drain(std::vector<slot>& batch, size_t& count)
+    {
+      auto h = head.load(std::memory_order_relaxed);
+      auto t = tail.load(std::memory_order_acquire);
+      for (; h != t; ++h) {
+        if (count == batch.size())
+          batch.emplace_back();
+        auto& s = slots[h & mask];
+        auto& b = batch[count++];
+        b.level = s.level;
+        b.time = s.time;
+        b.tid = s.tid;
+        std::swap(b.tag, s.tag);
+        std::swap(b.msg, s.msg);
+      }
+      head.store(h, std::memory_order_release);
+    }
+
+    bool
+    empty() const
+    {
+      return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+  };
+
+  // Thread local handle to the calling thread's ring, marks the ring
+  // orphaned when the thread exits so the writer can release it once
+  // drained.
+  struct ring_handle
+  {
+    const async_dispatch* owner = nullptr;
+    std::shared_ptr<ring> r;
+
+    ~ring_handle()
+    {
+      if (r)
+        r->orphaned = true;
+    }
+  };
+
+  std::unique_ptr<stream_dispatch> m_sink;
+  size_t m_ring_size;
+
+  std::mutex m_rings_mutex;                   // protects m_rings
+  std::vector<std::shared_ptr<ring>> m_rings;
+
+  std::mutex m_drain_mutex;                   // serializes draining
+  std::vector<slot> m_batch;
+  std::ostringstream m_buffer;
+
+  std::mutex m_mutex;                         // protects below
+  std::condition_variable m_work;
+  std::condition_variable m_flushed;
+  uint64_t m_flush_requested = 0;
+  uint64_t m_flush_done = 0;
+  bool m_wake = false;
+  std::atomic<bool> m_stop {false};
+  std::thread m_writer;
+  bool m_forked = false;                      // m_writer is of parent process
+
+  static std::vector<async_dispatch*>&
+  instances()
+  {
+    static std::vector<async_dispatch*> dispatchers;
+    return dispatchers;
+  }
+
+  static size_t
+  round_up_pow2(size_t size)
+  {
+    size_t pow2 = 2;
+    while (pow2 < size)
+      pow2 <<= 1;
+    return pow2;
+  }
+
+  ring*
+  get_ring()
+  {
+    thread_local ring_handle handle;
+    if (handle.owner == this)
+      return handle.r.get();
+
+    // A thread logs to one async dispatcher in practice, the ring of
+    // a previous owner is orphaned and released once drained.
+    if (handle.r)
+      handle.r->orphaned = true;
+
+    handle.r = std::make_shared<ring>(m_ring_size);
+    handle.owner = this;
+    std::lock_guard lk(m_rings_mutex);
+    m_rings.push_back(handle.r);
+    return handle.r.get();
+  }
+
+  void
+  wake()
+  {
+    {
+      std::lock_guard lk(m_mutex);
+      m_wake = true;
+    }
+    m_work.notify_one();
+  }
+
+  // Drain all rings and write queued messages to the sink
+  void
+  drain()
+  {
+    std::lock_guard drain_lk(m_drain_mutex);
+
+    size_t count = 0;
+    uint64_t dropped = 0;
+    {
+      std::lock_guard lk(m_rings_mutex);
+      for (auto& r : m_rings) {
+        r->drain(m_batch, count);
+        dropped += r->dropped.exchange(0, std::memory_order_relaxed);
+      }
+
+      // Release rings of exited threads; a ring is orphaned only
+      // after its thread pushed its last message, so it stays empty.
+      m_rings.erase(std::remove_if(m_rings.begin(), m_rings.end(),
+                                   [](const auto& r) { return r->orphaned && r->empty(); }),
+                    m_rings.end());
+    }
+
+    if (!count && !dropped)
+      return;
+
+    // Messages are ordered within a thread, interleave threads by time
+    std::stable_sort(m_batch.begin(), m_batch.begin() + count,
+                     [](const slot& a, const slot& b) { return a.time < b.time; });
+
+    m_buffer.str("");
+    {
+      std::lock_guard sink_lk(m_sink->mutex());
+      for (size_t idx = 0; idx < count; ++idx) {
+        auto& s = m_batch[idx];
+        m_sink->format(m_buffer, s.level, s.time, s.tid, s.tag, s.msg);
+      }
+
+      if (dropped) {
+        auto msg = std::to_string(dropped) + " messages dropped, increase Runtime.runtime_log_async_ring";
+        m_sink->format(m_buffer, severity_level::warning, clock::now(),
+                       std::this_thread::get_id(), "XRT", msg);
+      }
+    }
+
+    m_sink->write(m_buffer.str());
+  }
+
+  void
+  writer()
+  {
+    std::unique_lock lk(m_mutex);
+    while (!m_stop) {
+      m_work.wait_for(lk, flush_interval,
+                      [this] { return m_stop || m_wake || m_flush_requested != m_flush_done; });
+      auto requested = m_flush_requested;
+      m_wake = false;
+      lk.unlock();
+      drain();
+      lk.lock();
+      m_flush_done = requested;
+      m_flushed.notify_all();
+    }
+  }
+
+  // Write all messages queued before this call
+  void
+  flush()
+  {
+    std::unique_lock lk(m_mutex);
+    if (m_stop) {
+      lk.unlock();
+      drain();
+      return;
+    }
+    auto ticket = ++m_flush_requested;
+    m_work.notify_one();
+    m_flushed.wait(lk, [this, ticket] { return m_flush_done >= ticket || m_stop; });
+    if (m_flush_done < ticket) {
+      // Stopped before the writer got to the request
+      lk.unlock();
+      drain();
+    }
+  }
+
+  // Drain remaining messages and retire the writer thread.  The thread
+  // is detached rather than joined, joining at exit can deadlock when
+  // the runtime is unloaded.  The dispatcher itself is never deleted.
+  void
+  stop()
+  {
+    {
+      std::lock_guard lk(m_mutex);
+      m_stop = true;
+    }
+    m_work.notify_all();
+    m_flushed.notify_all();
+    drain();
+    if (m_writer.joinable() && !m_forked)
+      m_writer.detach();
+  }
+
+  // Fork handlers.  Locks are taken in the order drain() takes them,
+  // m_mutex is never held while taking another lock.
+  void
+  prepare_fork()
+  {
+    m_drain_mutex.lock();
+    m_rings_mutex.lock();
+    m_sink->mutex().lock();
+    m_mutex.lock();
+  }
+
+  void
+  unlock_fork()
+  {
+    m_mutex.unlock();
+    m_sink->mutex().unlock();
+    m_rings_mutex.unlock();
+    m_drain_mutex.unlock();
+  }
+
+  void
+  child_fork()
+  {
+    for (auto& r : m_rings) {
+      r->head.store(r->tail.load(std::memory_order_relaxed), std::memory_order_relaxed);
+      r->dropped.store(0, std::memory_order_relaxed);
+    }
+    m_forked = true;
+    m_stop = true;
+    unlock_fork();
+  }
+
+public:
+  async_dispatch(std::unique_ptr<stream_dispatch> sink, size_t ring_size)
+    : m_sink(std::move(sink))
+    , m_ring_size(round_up_pow2(ring_size))
+  {
+    static std::once_flag once;
+    std::call_once(once, [] {
+      instances();  // construct before registering exit handler
+      std::atexit([] {
+        for (auto dispatcher : instances())
+          dispatcher->stop();
+      });
+#ifndef _WIN32
+      pthread_atfork
+        ([] { for (auto dispatcher : instances()) dispatcher->prepare_fork(); },
+         [] { for (auto dispatcher : instances()) dispatcher->unlock_fork(); },
+         [] { for (auto dispatcher : instances()) dispatcher->child_fork(); });
+#endif
+    });
+    instances().push_back(this);
+    m_writer = std::thread([this] { writer(); });
+  }
+
+  void
+  send(severity_level l, const char* tag, const char* msg) override
+  {
+    if (m_stop) {
+      m_sink->send(l, tag, msg);
+      return;
+    }
+
+    auto r = get_ring();
+    auto severe = l <= severity_level::error;
+    auto queued = r->push(l, clock::now(), tag, msg);
+    if (!queued && severe) {
+      // Make room, the ring is drained by the time flush returns
+      flush();
+      queued = r->push(l, clock::now(), tag, msg);
+    }
+
+    if (!queued) {
+      if (severe)
+        m_sink->send(l, tag, msg);
+      else
+        r->dropped.fetch_add(1, std::memory_order_relaxed);
+      wake();
+      return;
+    }
+
+    if (severe || m_stop)
+      flush();
+    else if (queued == (m_ring_size >> 1))
+      wake();
+  }
+};
+
+// Dispatcher for runtime_log, optionally formatting and writing
+// console and file messages from a background thread
+static std::unique_ptr<message_dispatch>
+make_runtime_dispatcher(const std::string& logger)
+{
+  auto dispatcher = message_dispatch::make_dispatcher(logger);
+  if (!xrt_core::config::get_logging_async())
+    return dispatcher;
+
+  auto sink = dynamic_cast<stream_dispatch*>(dispatcher.get());
+  if (!sink)
+    return dispatcher;
+
+  dispatcher.release();
+  return std::make_unique<async_dispatch>
+    (std::unique_ptr<stream_dispatch>(sink), xrt_core::config::get_logging_async_ring_size());
 }
 
 } //end unnamed namespace
@@ -197,7 +653,7 @@ send(severity_level l, const char* tag, const char* msg)
     // XDP trace flush) can still log after static teardown begins. Do not
     // store as unique_ptr; that reintroduces use-after-free at process exit.
     static message_dispatch* const dispatcher =
-      message_dispatch::make_dispatcher(logger).release();
+      make_runtime_dispatcher(logger).release();
     dispatcher->send(l, tag, msg);
   }
 }
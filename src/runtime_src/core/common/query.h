@@ -21,6 +21,7 @@
 
 #include <stdexcept>
 #include <any>
+#include <type_traits>
 
 namespace xrt_core {
 
@@ -100,6 +101,47 @@ struct request
   { throw std::runtime_error("query update does not support two arguments"); }
 };
 
+/**
+ * struct cache_policy - how long a query result can be reused
+ *
+ * A query request opts in to caching of its result in the device
+ * object by declaring a static member of this type, e.g.
+ *
+ *   static constexpr cache_policy cache = cache_policy_static;
+ *
+ * Only requests without arguments are cached, errors are not cached.
+ *
+ * static_value: Read once, invalidated by device reset only
+ * xclbin: Invalidated when an xclbin is loaded or device is reset
+ * ttl: Reused for ttl_ms milliseconds, such that telemetry read
+ *   repeatedly while building one report is read once
+ */
+struct cache_policy
+{
+  enum class volatility { none, static_value, xclbin, ttl };
+
+  volatility vol = volatility::none;
+  unsigned int ttl_ms = 0;
+};
+
+constexpr cache_policy cache_policy_none {};
+constexpr cache_policy cache_policy_static {cache_policy::volatility::static_value, 0};
+constexpr cache_policy cache_policy_xclbin {cache_policy::volatility::xclbin, 0};
+constexpr cache_policy cache_policy_telemetry {cache_policy::volatility::ttl, 500}; // NOLINT
+
+// cache_policy_of - cache policy of a request type, none unless declared
+template <typename QueryRequestType, typename = void>
+struct cache_policy_of
+{
+  static constexpr cache_policy value = cache_policy_none;
+};
+
+template <typename QueryRequestType>
+struct cache_policy_of<QueryRequestType, std::void_t<decltype(QueryRequestType::cache)>>
+{
+  static constexpr cache_policy value = QueryRequestType::cache;
+};
+
 // Base class for query exceptions.
 //
 // Provides granularity for calling code to catch errors specific to
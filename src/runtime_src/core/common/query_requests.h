@@ -357,6 +357,7 @@ struct pcie_vendor : request
 {
   using result_type = uint16_t;
   static const key_type key = key_type::pcie_vendor;
+  static constexpr cache_policy cache = cache_policy_static;
   static const char* name() { return "vendor"; }
 
   virtual std::any
@@ -373,6 +374,7 @@ struct pcie_device : request
 {
   using result_type = uint16_t;
   static const key_type key = key_type::pcie_device;
+  static constexpr cache_policy cache = cache_policy_static;
   static const char* name() { return "device"; }
 
   virtual std::any
@@ -390,6 +392,7 @@ struct pcie_subsystem_vendor : request
 {
   using result_type = uint16_t;
   static const key_type key = key_type::pcie_subsystem_vendor;
+  static constexpr cache_policy cache = cache_policy_static;
   static const char* name() { return "subsystem_vendor"; }
 
   virtual std::any
@@ -406,6 +409,7 @@ struct pcie_subsystem_id : request
 {
   using result_type = uint16_t;
   static const key_type key = key_type::pcie_subsystem_id;
+  static constexpr cache_policy cache = cache_policy_static;
   static const char* name() { return "subsystem_id"; }
 
   virtual std::any
@@ -438,6 +442,7 @@ struct pcie_link_speed_max : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::pcie_link_speed_max;
+  static constexpr cache_policy cache = cache_policy_static;
   static const char* name() { return "link_speed_max"; }
 
   virtual std::any
@@ -470,6 +475,7 @@ struct pcie_express_lane_width_max : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::pcie_express_lane_width_max;
+  static constexpr cache_policy cache = cache_policy_static;
   static const char* name() { return "width_max"; }
 
   virtual std::any
@@ -486,6 +492,7 @@ struct pcie_bdf : request
 {
   using result_type = std::tuple<uint16_t, uint16_t, uint16_t, uint16_t>;
   static const key_type key = key_type::pcie_bdf;
+  static constexpr cache_policy cache = cache_policy_static;
   static const char* name() { return "bdf"; }
 
   virtual std::any
@@ -670,6 +677,7 @@ struct rom_vbnv : request
 {
   using result_type = std::string;
   static const key_type key = key_type::rom_vbnv;
+  static constexpr cache_policy cache = cache_policy_static;
   static const char* name() { return "vbnv"; }
 
   virtual std::any
@@ -686,6 +694,7 @@ struct rom_ddr_bank_size_gb : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::rom_ddr_bank_size_gb;
+  static constexpr cache_policy cache = cache_policy_static;
   static const char* name() { return "ddr_size_bytes"; }
 
   virtual std::any
@@ -702,6 +711,7 @@ struct rom_ddr_bank_count_max : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::rom_ddr_bank_count_max;
+  static constexpr cache_policy cache = cache_policy_static;
   static const char* name() { return "widdr_countdth"; }
 
   virtual std::any
@@ -718,6 +728,7 @@ struct rom_fpga_name : request
 {
   using result_type = std::string;
   static const key_type key = key_type::rom_fpga_name;
+  static constexpr cache_policy cache = cache_policy_static;
   static const char* name() { return "fpga_name"; }
 
   virtual std::any
@@ -1572,6 +1583,7 @@ struct m2m : request
 {
   using result_type = uint32_t;
   static const key_type key = key_type::m2m;
+  static constexpr cache_policy cache = cache_policy_xclbin;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -1588,6 +1600,7 @@ struct nodma : request
 {
   using result_type = uint32_t;
   static const key_type key = key_type::nodma;
+  static constexpr cache_policy cache = cache_policy_static;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -1682,6 +1695,7 @@ struct dna_serial_num : request
 {
   using result_type = std::string;
   static const key_type key = key_type::dna_serial_num;
+  static constexpr cache_policy cache = cache_policy_static;
   static const char* name() { return "dna"; }
 
   virtual std::any
@@ -2158,6 +2172,7 @@ struct temp_card_top_front : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::temp_card_top_front;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2173,6 +2188,7 @@ struct temp_card_top_rear : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::temp_card_top_rear;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2188,6 +2204,7 @@ struct temp_card_bottom_front : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::temp_card_bottom_front;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2203,6 +2220,7 @@ struct temp_fpga : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::temp_fpga;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2248,6 +2266,7 @@ struct fan_speed_rpm : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::fan_speed_rpm;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2263,6 +2282,7 @@ struct ddr_temp_0 : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::ddr_temp_0;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2272,6 +2292,7 @@ struct ddr_temp_1 : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::ddr_temp_1;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2281,6 +2302,7 @@ struct ddr_temp_2 : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::ddr_temp_2;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2290,6 +2312,7 @@ struct ddr_temp_3 : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::ddr_temp_3;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2299,6 +2322,7 @@ struct hbm_temp : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::hbm_temp;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2314,6 +2338,7 @@ struct cage_temp_0 : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::cage_temp_0;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2329,6 +2354,7 @@ struct cage_temp_1 : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::cage_temp_1;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2344,6 +2370,7 @@ struct cage_temp_2 : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::cage_temp_2;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2359,6 +2386,7 @@ struct cage_temp_3 : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::cage_temp_3;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2374,6 +2402,7 @@ struct dimm_temp_0 : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::dimm_temp_0;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2389,6 +2418,7 @@ struct dimm_temp_1 : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::dimm_temp_1;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2404,6 +2434,7 @@ struct dimm_temp_2 : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::dimm_temp_2;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2419,6 +2450,7 @@ struct dimm_temp_3 : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::dimm_temp_3;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2434,6 +2466,7 @@ struct v12v_pex_millivolts : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::v12v_pex_millivolts;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2449,6 +2482,7 @@ struct v12v_pex_milliamps : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::v12v_pex_milliamps;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2464,6 +2498,7 @@ struct v12v_aux_millivolts : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::v12v_aux_millivolts;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2479,6 +2514,7 @@ struct v12v_aux_milliamps : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::v12v_aux_milliamps;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2494,6 +2530,7 @@ struct v3v3_pex_millivolts : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::v3v3_pex_millivolts;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2509,6 +2546,7 @@ struct v3v3_aux_millivolts : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::v3v3_aux_millivolts;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2524,6 +2562,7 @@ struct ddr_vpp_bottom_millivolts : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::ddr_vpp_bottom_millivolts;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2539,6 +2578,7 @@ struct ddr_vpp_top_millivolts : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::ddr_vpp_top_millivolts;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2554,6 +2594,7 @@ struct v5v5_system_millivolts : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::v5v5_system_millivolts;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2569,6 +2610,7 @@ struct v1v2_vcc_top_millivolts : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::v1v2_vcc_top_millivolts;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2584,6 +2626,7 @@ struct v1v2_vcc_bottom_millivolts : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::v1v2_vcc_bottom_millivolts;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2599,6 +2642,7 @@ struct v1v8_millivolts : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::v1v8_millivolts;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2614,6 +2658,7 @@ struct v0v85_millivolts : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::v0v85_millivolts;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2629,6 +2674,7 @@ struct v0v9_vcc_millivolts : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::v0v9_vcc_millivolts;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2644,6 +2690,7 @@ struct v12v_sw_millivolts : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::v12v_sw_millivolts;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2659,6 +2706,7 @@ struct mgt_vtt_millivolts : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::mgt_vtt_millivolts;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2674,6 +2722,7 @@ struct int_vcc_millivolts : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::int_vcc_millivolts;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2689,6 +2738,7 @@ struct int_vcc_milliamps : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::int_vcc_milliamps;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2704,6 +2754,7 @@ struct int_vcc_temp : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::int_vcc_temp;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2719,6 +2770,7 @@ struct v3v3_pex_milliamps : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::v3v3_pex_milliamps;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2734,6 +2786,7 @@ struct v3v3_aux_milliamps : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::v3v3_aux_milliamps;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2749,6 +2802,7 @@ struct int_vcc_io_milliamps : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::int_vcc_io_milliamps;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2764,6 +2818,7 @@ struct v3v3_vcc_millivolts : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::v3v3_vcc_millivolts;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2779,6 +2834,7 @@ struct hbm_1v2_millivolts : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::hbm_1v2_millivolts;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2794,6 +2850,7 @@ struct v2v5_vpp_millivolts : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::v2v5_vpp_millivolts;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2809,6 +2866,7 @@ struct v12_aux1_millivolts : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::v12_aux1_millivolts;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2824,6 +2882,7 @@ struct vcc1v2_i_milliamps : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::vcc1v2_i_milliamps;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2839,6 +2898,7 @@ struct v12_in_i_milliamps : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::v12_in_i_milliamps;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2854,6 +2914,7 @@ struct v12_in_aux0_i_milliamps : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::v12_in_aux0_i_milliamps;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2869,6 +2930,7 @@ struct v12_in_aux1_i_milliamps : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::v12_in_aux1_i_milliamps;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2884,6 +2946,7 @@ struct vcc_aux_millivolts : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::vcc_aux_millivolts;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2899,6 +2962,7 @@ struct vcc_aux_pmc_millivolts : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::vcc_aux_pmc_millivolts;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2914,6 +2978,7 @@ struct vcc_ram_millivolts : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::vcc_ram_millivolts;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2929,6 +2994,7 @@ struct int_vcc_io_millivolts : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::int_vcc_io_millivolts;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -2944,6 +3010,7 @@ struct v0v9_int_vcc_vcu_millivolts : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::v0v9_int_vcc_vcu_millivolts;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
@@ -3063,6 +3130,7 @@ struct power_microwatts : request
 {
   using result_type = uint64_t;
   static const key_type key = key_type::power_microwatts;
+  static constexpr cache_policy cache = cache_policy_telemetry;
 
   virtual std::any
   get(const device*) const override = 0;
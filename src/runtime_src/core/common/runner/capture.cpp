@@ -226,7 +226,7 @@ class frames
     std::string
     dump(artifacts& repo) const
     {
-      return repo.dump({m_data, m_size});
+      return repo.dump_buffer({m_data, m_size});
     }
   }; // class bo
 
@@ -741,7 +741,10 @@ class frames
   mutable artifacts m_artifacts;
 
   frames()
-    : m_artifacts{xrt_core::config::get_capture_dir()}
+    : m_artifacts{xrt_core::config::get_capture_dir(),
+                  xrt_core::config::get_capture_mode() == "chunked",
+                  size_t(xrt_core::config::get_capture_writer_queue_mb()) << 20,
+                  xrt_core::config::get_capture_format() == "pack"}
   {
     // Reserve capacity to prevent vector reallocation which would
     // invalidate frame pointers stored in m_hdl2frame and m_tid2last_frame
@@ -752,6 +755,7 @@ class frames
   {
     try {
       save_replay_script();
+      m_artifacts.flush();
     }
     catch (const std::exception& ex) {
       xrt_core::send_exception_message("could not save replay script: " + std::string(ex.what()));
@@ -4,35 +4,205 @@
 #define XRT_COMMON_RUNNER_DETAIL_ARTIFACTS_H_
 #include "core/common/config.h"
 #include "core/common/debug.h"
+#include "core/common/runner/detail/pack.h"
 #include "xrt/detail/span.h"
 
+#include <algorithm>
 #include <atomic>
+#include <condition_variable>
 #include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <exception>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace xrt_core::capture::detail {
 
 template <typename T>
 using span = xrt::detail::span<T>;
 
+// Buffer data captured in chunked mode is split into chunks of this
+// size.  Each chunk is stored in a file named by its content hash.
+constexpr size_t capture_chunk_size = 64 * 1024;
+
+// Extension of the manifest file listing the chunks of a buffer
+constexpr const char* capture_manifest_ext = ".chunks";
+
+// class writer - background writer of artifact files
+//
+// Files are written by a separate thread such that capturing does not
+// stall the application on disk I/O.  The queue of pending writes is
+// bounded by total bytes; a write blocks while the queue is full.
+// Errors from the writer thread are reported on the next write or
+// flush.
+class writer
+{
+public:
+  using sink_type = std::function<void(const std::string&, span<const char>)>;
+
+private:
+  struct job
+  {
+    std::string fnm;
+    std::vector<char> data;
+  };
+
+  sink_type m_sink;          // writes a file
+
+  std::queue<job> m_jobs;
+  size_t m_bytes = 0;        // bytes in queued jobs
+  size_t m_max_bytes;        // max bytes in queued jobs
+  bool m_busy = false;       // writer thread is writing a job
+  bool m_stop = false;
+  std::exception_ptr m_error;
+  std::mutex m_mutex;
+  std::condition_variable m_work;
+  std::condition_variable m_space;
+  std::thread m_thread;
+
+  void
+  run()
+  {
+    std::unique_lock lk(m_mutex);
+    while (true) {
+      m_work.wait(lk, [this] { return m_stop || !m_jobs.empty(); });
+      if (m_jobs.empty())
+        return;
+
+      auto jb = std::move(m_jobs.front());
+      m_jobs.pop();
+      m_busy = true;
+      lk.unlock();
+
+      std::exception_ptr error;
+      try {
+        m_sink(jb.fnm, {jb.data.data(), jb.data.size()});
+      }
+      catch (...) {
+        error = std::current_exception();
+      }
+
+      lk.lock();
+      if (error && !m_error)
+        m_error = error;
+      m_busy = false;
+      m_bytes -= jb.data.size();
+      m_space.notify_all();
+    }
+  }
+
+  void
+  throw_if_error()
+  {
+    if (!m_error)
+      return;
+
+    auto error = m_error;
+    m_error = nullptr;
+    std::rethrow_exception(error);
+  }
+
+public:
+  writer(sink_type sink, size_t max_bytes)
+    : m_sink(std::move(sink))
+    , m_max_bytes(max_bytes)
+    , m_thread([this] { run(); })
+  {}
+
+  // Drain pending writes and stop writer thread
+  ~writer()
+  {
+    {
+      std::lock_guard lk(m_mutex);
+      m_stop = true;
+      m_work.notify_one();
+    }
+    m_thread.join();
+  }
+
+  writer(const writer&) = delete;
+  writer(writer&&) = delete;
+  writer& operator=(const writer&) = delete;
+  writer& operator=(writer&&) = delete;
+
+  // write() - Queue data for writing to file
+  //
+  // Blocks while the queue is full.  A job larger than the queue
+  // bound is accepted when the queue is empty.
+  void
+  write(std::string fnm, std::vector<char>&& data)
+  {
+    std::unique_lock lk(m_mutex);
+    m_space.wait(lk, [this, &data] {
+      return m_error || m_jobs.empty() || m_bytes + data.size() <= m_max_bytes;
+    });
+    throw_if_error();
+    m_bytes += data.size();
+    m_jobs.push({std::move(fnm), std::move(data)});
+    m_work.notify_one();
+  }
+
+  // flush() - Wait for all queued writes to complete
+  void
+  flush()
+  {
+    std::unique_lock lk(m_mutex);
+    m_space.wait(lk, [this] { return m_jobs.empty() && !m_busy; });
+    throw_if_error();
+  }
+};
+
 // class artifacts - dump unique artifacts to disk
 //
 // This class manages captured data dumping to specified
 // directory if and only if data is not already dumped.
+//
+// In chunked mode, buffer data is split into fixed size chunks that
+// are stored content addressed, so a chunk is written at most once
+// regardless of how many buffers or frames contain it.  A buffer dump
+// is a small manifest file that lists the chunks of the buffer.
+// When a large buffer is modified in a small region, only the chunks
+// of that region are written.  All files are written by a background
+// writer.
+//
+// In pack mode, all artifacts are appended to a single pack file
+// instead of individual files, see detail/pack.h.
 class artifacts
 {
   std::filesystem::path m_dir;
   std::unordered_map<uint64_t, std::string> m_hash_to_fnm;
 
+  // Pack mode only
+  std::unique_ptr<xrt_core::artifacts::detail::pack::writer> m_pack;
+
+  // Chunked mode only
+  std::unique_ptr<writer> m_writer;
+  std::unordered_set<uint64_t> m_chunks;  // hashes of written chunks
+
   static std::string
-  generate_fnm()
+  generate_fnm(const char* ext = ".bin")
   {
     static std::atomic<uint64_t> counter {0};
-    return "capture_" + std::to_string(counter.fetch_add(1)) + ".bin";
+    return "capture_" + std::to_string(counter.fetch_add(1)) + ext;
+  }
+
+  static std::string
+  chunk_fnm(uint64_t hash)
+  {
+    char buf[32];  // NOLINT
+    std::snprintf(buf, sizeof(buf), "chunk_%016llx.bin", static_cast<unsigned long long>(hash)); // NOLINT
+    return buf;
   }
 
   static std::filesystem::path
@@ -42,26 +212,184 @@ class artifacts
     return dir;
   }
 
-  // FNV-1a hash function.
-  // Should be low probability of collision.
-  // Suggested by Gemini
+  static uint64_t
+  rotl(uint64_t value, int bits)
+  {
+    return (value << bits) | (value >> (64 - bits));
+  }
+
+  static uint64_t
+  load64(const char* data)
+  {
+    uint64_t value = 0;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+  }
+
+  // Word-wide hash function.
+  //
+  // Consumes 32 bytes per iteration in four independent 64-bit lanes
+  // using the xxHash64 round and merge functions, which lets the
+  // compiler keep multiple multiplications in flight.  Processes
+  // several GB/s compared to a few hundred MB/s for byte-at-a-time
+  // FNV-1a.  The hash is used only to identify identical data within
+  // one capture session.
   static uint64_t
   calculate_hash(span<const char> data)
   {
-    auto hash = 0xcbf29ce484222325ULL; // NOLINT
-    for (unsigned char c : data) {
-      hash ^= c;
-      hash *= 0x100000001b3ULL; // NOLINT
+    constexpr uint64_t prime1 = 0x9e3779b185ebca87ULL; // NOLINT
+    constexpr uint64_t prime2 = 0xc2b2ae3d27d4eb4fULL; // NOLINT
+    constexpr uint64_t prime3 = 0x165667b19e3779f9ULL; // NOLINT
+    constexpr uint64_t prime4 = 0x85ebca77c2b2ae63ULL; // NOLINT
+    constexpr uint64_t prime5 = 0x27d4eb2f165667c5ULL; // NOLINT
+
+    auto round = [](uint64_t acc, uint64_t input) {
+      return rotl(acc + input * prime2, 31) * prime1; // NOLINT
+    };
+    auto merge = [&round](uint64_t acc, uint64_t val) {
+      return (acc ^ round(0, val)) * prime1 + prime4;
+    };
+
+    auto ptr = data.data();
+    auto size = data.size();
+    auto end = ptr + size;
+    uint64_t hash = 0;
+
+    if (size >= 32) {
+      uint64_t v1 = prime1 + prime2;
+      uint64_t v2 = prime2;
+      uint64_t v3 = 0;
+      uint64_t v4 = 0 - prime1;
+      for (; ptr + 32 <= end; ptr += 32) {  // NOLINT
+        v1 = round(v1, load64(ptr));
+        v2 = round(v2, load64(ptr + 8));    // NOLINT
+        v3 = round(v3, load64(ptr + 16));   // NOLINT
+        v4 = round(v4, load64(ptr + 24));   // NOLINT
+      }
+      hash = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18); // NOLINT
+      hash = merge(hash, v1);
+      hash = merge(hash, v2);
+      hash = merge(hash, v3);
+      hash = merge(hash, v4);
+    }
+    else {
+      hash = prime5;
     }
+
+    hash += size;
+    for (; ptr + 8 <= end; ptr += 8)                           // NOLINT
+      hash = rotl(hash ^ round(0, load64(ptr)), 27) * prime1 + prime4; // NOLINT
+    for (; ptr < end; ++ptr)                                   // NOLINT
+      hash = rotl(hash ^ (static_cast<unsigned char>(*ptr) * prime5), 11) * prime1; // NOLINT
+
+    hash ^= hash >> 33; // NOLINT
+    hash *= prime2;
+    hash ^= hash >> 29; // NOLINT
+    hash *= prime3;
+    hash ^= hash >> 32; // NOLINT
     return hash;
   }
 
+  // Write a file synchronously, or append to pack
+  void
+  write_file(const std::string& fnm, span<const char> data) const
+  {
+    if (m_pack) {
+      XRT_DEBUGF("Packing artifact data as %s\n", fnm.c_str());
+      m_pack->append(fnm, data);
+      return;
+    }
+
+    std::filesystem::path file_path = m_dir / fnm;
+    XRT_DEBUGF("Dumping artifact data to %s\n", file_path.string().c_str());
+    std::ofstream ostr(file_path, std::ios::binary);
+    if (!ostr)
+      throw std::runtime_error("Failed to open file for capture dump: " + file_path.string());
+
+    ostr.write(data.data(), static_cast<std::streamsize>(data.size()));
+    if (!ostr)
+      throw std::runtime_error("Error writing capture dump to: " + file_path.string());
+  }
+
+  // Dump buffer data as content addressed chunks and a manifest
+  //
+  // The manifest lists the chunk size, the data size, and the chunk
+  // file names in order:
+  //   chunk_size <bytes>
+  //   size <bytes>
+  //   chunk_<hash>.bin
+  //   ...
+  std::string
+  dump_chunked(span<const char> data)
+  {
+    auto num_chunks = (data.size() + capture_chunk_size - 1) / capture_chunk_size;
+    std::vector<uint64_t> hashes(num_chunks);
+    for (size_t idx = 0; idx < num_chunks; ++idx) {
+      auto offset = idx * capture_chunk_size;
+      hashes[idx] = calculate_hash(data.subspan(offset, std::min(capture_chunk_size, data.size() - offset)));
+    }
+
+    // The manifest identifies the buffer content
+    auto hash = calculate_hash({reinterpret_cast<const char*>(hashes.data()), hashes.size() * sizeof(uint64_t)});
+    if (auto itr = m_hash_to_fnm.find(hash); itr != m_hash_to_fnm.end())
+      return (*itr).second;
+
+    std::ostringstream manifest;
+    manifest << "chunk_size " << capture_chunk_size << '\n'
+             << "size " << data.size() << '\n';
+
+    size_t written = 0;
+    for (size_t idx = 0; idx < num_chunks; ++idx) {
+      auto chunk = chunk_fnm(hashes[idx]);
+      manifest << chunk << '\n';
+      if (!m_chunks.insert(hashes[idx]).second)
+        continue;
+
+      auto offset = idx * capture_chunk_size;
+      auto bytes = std::min(capture_chunk_size, data.size() - offset);
+      m_writer->write(chunk, {data.data() + offset, data.data() + offset + bytes});
+      ++written;
+    }
+    XRT_DEBUGF("Chunked dump of %zu bytes, %zu of %zu chunks written\n", data.size(), written, num_chunks);
+
+    auto fnm = generate_fnm(capture_manifest_ext);
+    auto str = manifest.str();
+    m_writer->write(fnm, {str.begin(), str.end()});
+    m_hash_to_fnm.emplace(hash, fnm);
+    return fnm;
+  }
+
 public:
+  // ctor - Construct artifacts for directory
+  //
+  // @dir: directory to dump artifacts to
+  // @chunked: dump buffer data as content addressed chunks
+  // @writer_bytes: max bytes queued for background writing
+  // @pack: write all artifacts to a single pack file in dir
+  artifacts(std::filesystem::path dir, bool chunked, size_t writer_bytes, bool pack)
+    : m_dir(init_dir(std::move(dir)))
+    , m_pack(pack ? std::make_unique<xrt_core::artifacts::detail::pack::writer>(m_dir / xrt_core::artifacts::detail::pack::default_fnm) : nullptr)
+  {
+    if (chunked)
+      m_writer = std::make_unique<writer>([this](const std::string& fnm, span<const char> data) { write_file(fnm, data); }, writer_bytes);
+  }
+
   explicit
   artifacts(std::filesystem::path dir)
-    : m_dir(init_dir(std::move(dir)))
+    : artifacts(std::move(dir), false, 0, false)
   {}
 
+  // Drain background writes before closing the pack
+  ~artifacts()
+  {
+    m_writer.reset();
+  }
+
+  artifacts(const artifacts&) = delete;
+  artifacts(artifacts&&) = delete;
+  artifacts& operator=(const artifacts&) = delete;
+  artifacts& operator=(artifacts&&) = delete;
+
   std::string
   dump(span<const char> data)
   {
@@ -73,26 +401,47 @@ public:
       return (*itr).second;
 
     auto fnm = generate_fnm();
-    std::filesystem::path file_path = m_dir / fnm;
-    XRT_DEBUGF("Dumping artifact data to %s\n", file_path.string().c_str());
-    std::ofstream ostr(file_path, std::ios::binary);
-    if (!ostr)
-      throw std::runtime_error("Failed to open file for capture dump: " + file_path.string());
-
-    ostr.write(data.data(), static_cast<std::streamsize>(data.size()));
-    if (!ostr)
-      throw std::runtime_error("Error writing capture dump to: " + file_path.string());
-
+    write_file(fnm, data);
     m_hash_to_fnm.emplace(hash, fnm);
     return fnm;
   }
 
+  // dump_buffer() - Dump buffer object data
+  //
+  // Same as dump() unless in chunked mode, in which case the
+  // returned file is a manifest of chunks, see dump_chunked().
+  std::string
+  dump_buffer(span<const char> data)
+  {
+    if (data.empty())
+      return {};
+
+    if (!m_writer)
+      return dump(data);
+
+    return dump_chunked(data);
+  }
+
   std::string
   add(std::stringstream& sstr)
   {
     auto data = sstr.str();
     return dump({data.data(), data.size()});
   }
+
+  // flush() - Wait for background writes to complete
+  //
+  // In pack mode this also closes the pack, after which no more
+  // artifacts can be dumped.
+  void
+  flush()
+  {
+    if (m_writer)
+      m_writer->flush();
+
+    if (m_pack)
+      m_pack->close();
+  }
 };
 
 } // namespace xrt_core::capture::detail
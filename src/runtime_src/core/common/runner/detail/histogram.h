@@ -0,0 +1,162 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+#ifndef XRT_COMMON_RUNNER_DETAIL_HISTOGRAM_H_
+#define XRT_COMMON_RUNNER_DETAIL_HISTOGRAM_H_
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace xrt_core::detail {
+
+// class latency_histogram - Log-linear histogram of latencies
+//
+// HDR style histogram with a fixed relative precision.  Each power
+// of two range of values is split into sub_buckets linear buckets,
+// such that a recorded value is known within 1/sub_buckets of its
+// magnitude.  Values below sub_buckets are recorded exactly.
+//
+// Recording is constant time and allocation free, so per-thread
+// histograms can record from the hot path and be merged after the
+// fact.  Values are in nanoseconds.
+class latency_histogram
+{
+  static constexpr unsigned int sub_bucket_bits = 5;
+  static constexpr uint64_t sub_buckets = uint64_t(1) << sub_bucket_bits;
+  static constexpr size_t num_buckets = (64 - sub_bucket_bits + 1) * sub_buckets;
+
+  std::vector<uint64_t> m_counts = std::vector<uint64_t>(num_buckets, 0);
+  uint64_t m_count = 0;
+  uint64_t m_min = std::numeric_limits<uint64_t>::max();
+  uint64_t m_max = 0;
+  double m_sum = 0;
+  double m_sum_squares = 0;
+
+  static unsigned int
+  msb(uint64_t value)
+  {
+    unsigned int bit = 0;
+    while (value >>= 1)
+      ++bit;
+    return bit;
+  }
+
+  static size_t
+  index(uint64_t ns)
+  {
+    if (ns < sub_buckets)
+      return ns;
+
+    auto shift = msb(ns) - sub_bucket_bits;
+    return (shift + 1) * sub_buckets + ((ns >> shift) - sub_buckets);
+  }
+
+  // Highest value that maps to bucket idx
+  static uint64_t
+  value(size_t idx)
+  {
+    if (idx < sub_buckets)
+      return idx;
+
+    auto shift = idx / sub_buckets - 1;
+    auto sub = sub_buckets + idx % sub_buckets;
+    return ((sub + 1) << shift) - 1;
+  }
+
+public:
+  void
+  record(uint64_t ns)
+  {
+    ++m_counts[index(ns)];
+    ++m_count;
+    m_min = std::min(m_min, ns);
+    m_max = std::max(m_max, ns);
+    m_sum += static_cast<double>(ns);
+    m_sum_squares += static_cast<double>(ns) * static_cast<double>(ns);
+  }
+
+  template <typename Rep, typename Period>
+  void
+  record(std::chrono::duration<Rep, Period> duration)
+  {
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    record(static_cast<uint64_t>(std::max<decltype(ns)>(ns, 0)));
+  }
+
+  void
+  merge(const latency_histogram& other)
+  {
+    for (size_t idx = 0; idx < num_buckets; ++idx)
+      m_counts[idx] += other.m_counts[idx];
+
+    m_count += other.m_count;
+    m_min = std::min(m_min, other.m_min);
+    m_max = std::max(m_max, other.m_max);
+    m_sum += other.m_sum;
+    m_sum_squares += other.m_sum_squares;
+  }
+
+  uint64_t
+  count() const
+  {
+    return m_count;
+  }
+
+  uint64_t
+  min() const
+  {
+    return m_count ? m_min : 0;
+  }
+
+  uint64_t
+  max() const
+  {
+    return m_max;
+  }
+
+  double
+  mean() const
+  {
+    return m_count ? m_sum / static_cast<double>(m_count) : 0;
+  }
+
+  double
+  stddev() const
+  {
+    if (m_count < 2)
+      return 0;
+
+    auto avg = mean();
+    auto var = m_sum_squares / static_cast<double>(m_count) - avg * avg;
+    return var > 0 ? std::sqrt(var) : 0;
+  }
+
+  // percentile() - Value at or below which pct percent of samples fall
+  //
+  // The returned value is the highest value equivalent to the bucket
+  // containing the percentile, clamped to the recorded max.
+  uint64_t
+  percentile(double pct) const
+  {
+    if (!m_count)
+      return 0;
+
+    auto rank = static_cast<uint64_t>(std::ceil(pct / 100.0 * static_cast<double>(m_count)));
+    rank = std::clamp<uint64_t>(rank, 1, m_count);
+    uint64_t sum = 0;
+    for (size_t idx = 0; idx < num_buckets; ++idx) {
+      sum += m_counts[idx];
+      if (sum >= rank)
+        return std::clamp(value(idx), min(), m_max);
+    }
+
+    return m_max;
+  }
+};
+
+} // namespace xrt_core::detail
+
+#endif
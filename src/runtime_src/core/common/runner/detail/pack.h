@@ -0,0 +1,221 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+#ifndef XRT_COMMON_RUNNER_DETAIL_PACK_H_
+#define XRT_COMMON_RUNNER_DETAIL_PACK_H_
+#include "xrt/detail/span.h"
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Artifact pack format
+//
+// A pack stores many artifacts in a single file that can be memory
+// mapped, such that artifacts are accessed as spans into the mapped
+// file without copying.
+//
+//  +----------------------+ 0
+//  | header               |
+//  +----------------------+ header_size
+//  | artifact data        | each artifact aligned to data_alignment
+//  | ...                  |
+//  +----------------------+ index_offset
+//  | index                | count entries of
+//  |                      |   uint64_t offset, uint64_t size,
+//  |                      |   uint32_t key_size, char key[key_size]
+//  +----------------------+
+//
+// The index is written last when the pack is closed.  All integers
+// are little endian.
+namespace xrt_core::artifacts::detail::pack {
+
+template <typename T>
+using span = xrt::detail::span<T>;
+
+// Default file name of a pack in an artifacts directory
+constexpr const char* default_fnm = "artifacts.pack";
+
+constexpr char magic[8] = {'X', 'R', 'T', 'P', 'A', 'C', 'K', '\0'};
+constexpr uint32_t version = 1;
+constexpr uint64_t data_alignment = 64;
+
+struct header
+{
+  char magic[8];         // NOLINT
+  uint32_t version;
+  uint32_t count;        // number of index entries
+  uint64_t index_offset; // file offset of index
+  uint64_t index_size;   // bytes in index
+};
+static_assert(sizeof(header) == 32, "unexpected pack header size");
+
+// is_pack() - Check if file is an artifact pack
+inline bool
+is_pack(const std::filesystem::path& path)
+{
+  std::ifstream ifs(path, std::ios::binary);
+  char buf[sizeof(magic)] = {}; // NOLINT
+  return ifs.read(buf, sizeof(buf)) && std::memcmp(buf, magic, sizeof(magic)) == 0;
+}
+
+// class writer - Append artifacts to a pack file
+//
+// Thread safe.  The pack is valid only after close(), which is
+// called by the destructor if not called explicitly.
+class writer
+{
+  std::mutex m_mutex;
+  std::filesystem::path m_path;
+  std::ofstream m_ostr;
+  uint64_t m_offset = sizeof(header);
+  std::vector<char> m_index;
+  uint32_t m_count = 0;
+
+  template <typename T>
+  void
+  append_index(const T& value)
+  {
+    auto data = reinterpret_cast<const char*>(&value);
+    m_index.insert(m_index.end(), data, data + sizeof(T)); // NOLINT
+  }
+
+  void
+  write(const char* data, uint64_t size)
+  {
+    m_ostr.write(data, static_cast<std::streamsize>(size));
+    if (!m_ostr)
+      throw std::runtime_error("Error writing artifact pack: " + m_path.string());
+    m_offset += size;
+  }
+
+public:
+  explicit
+  writer(std::filesystem::path path)
+    : m_path(std::move(path))
+    , m_ostr(m_path, std::ios::binary | std::ios::trunc)
+  {
+    if (!m_ostr)
+      throw std::runtime_error("Failed to open artifact pack: " + m_path.string());
+
+    header hdr {};
+    m_ostr.write(reinterpret_cast<const char*>(&hdr), sizeof(hdr));
+  }
+
+  ~writer()
+  {
+    try {
+      close();
+    }
+    catch (...) {
+    }
+  }
+
+  writer(const writer&) = delete;
+  writer(writer&&) = delete;
+  writer& operator=(const writer&) = delete;
+  writer& operator=(writer&&) = delete;
+
+  // append() - Append artifact data under key
+  void
+  append(const std::string& key, span<const char> data)
+  {
+    static const char zeros[data_alignment] = {}; // NOLINT
+    std::lock_guard lk(m_mutex);
+    if (!m_ostr.is_open())
+      throw std::runtime_error("Artifact pack is closed: " + m_path.string());
+
+    if (auto pad = (data_alignment - m_offset % data_alignment) % data_alignment)
+      write(zeros, pad);
+
+    append_index(m_offset);
+    append_index(static_cast<uint64_t>(data.size()));
+    append_index(static_cast<uint32_t>(key.size()));
+    m_index.insert(m_index.end(), key.begin(), key.end());
+    ++m_count;
+
+    write(data.data(), data.size());
+  }
+
+  // close() - Write index and header
+  void
+  close()
+  {
+    std::lock_guard lk(m_mutex);
+    if (!m_ostr.is_open())
+      return;
+
+    header hdr {};
+    std::memcpy(hdr.magic, magic, sizeof(magic));
+    hdr.version = version;
+    hdr.count = m_count;
+    hdr.index_offset = m_offset;
+    hdr.index_size = m_index.size();
+    write(m_index.data(), m_index.size());
+
+    m_ostr.seekp(0);
+    m_ostr.write(reinterpret_cast<const char*>(&hdr), sizeof(hdr));
+    m_ostr.close();
+    if (!m_ostr)
+      throw std::runtime_error("Error closing artifact pack: " + m_path.string());
+  }
+};
+
+// read_index() - Parse index of a mapped pack
+//
+// Return map of artifact key to span of data within the pack.
+inline std::unordered_map<std::string, span<char>>
+read_index(span<char> pack)
+{
+  auto fail = [](const std::string& msg) {
+    throw std::runtime_error("artifacts::repository: invalid pack, " + msg);
+  };
+
+  if (pack.size() < sizeof(header))
+    fail("too small");
+
+  header hdr {};
+  std::memcpy(&hdr, pack.data(), sizeof(hdr));
+  if (std::memcmp(hdr.magic, magic, sizeof(magic)) != 0)
+    fail("bad magic");
+  if (hdr.version != version)
+    fail("unsupported version " + std::to_string(hdr.version));
+  if (hdr.index_offset > pack.size() || hdr.index_size > pack.size() - hdr.index_offset)
+    fail("index out of range");
+
+  std::unordered_map<std::string, span<char>> index;
+  auto ptr = pack.data() + hdr.index_offset;
+  auto end = ptr + hdr.index_size;
+  auto read = [&ptr, end, &fail](void* dst, size_t bytes) {
+    if (bytes > static_cast<size_t>(end - ptr))
+      fail("truncated index");
+    std::memcpy(dst, ptr, bytes);
+    ptr += bytes; // NOLINT
+  };
+
+  for (uint32_t idx = 0; idx < hdr.count; ++idx) {
+    uint64_t offset = 0;
+    uint64_t size = 0;
+    uint32_t key_size = 0;
+    read(&offset, sizeof(offset));
+    read(&size, sizeof(size));
+    read(&key_size, sizeof(key_size));
+    std::string key(key_size, '\0');
+    read(key.data(), key_size);
+    if (offset > hdr.index_offset || size > hdr.index_offset - offset)
+      fail("artifact out of range: " + key);
+
+    index.emplace(std::move(key), span<char>{pack.data() + offset, size});
+  }
+
+  return index;
+}
+
+} // namespace xrt_core::artifacts::detail::pack
+
+#endif
@@ -50,6 +50,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -451,6 +452,47 @@ class replay_impl
         std::map<std::string, std::pair<xrt::bo, std::string>> m_bo2data;
       public:
 
+        // is_manifest() - Check if file is a manifest of chunks
+        //
+        // Buffer data captured in chunked mode is a manifest listing
+        // content addressed chunk files, see capture_artifacts.h
+        static bool
+        is_manifest(const std::string& fnm)
+        {
+          constexpr std::string_view ext = ".chunks";
+          return fnm.size() > ext.size() && fnm.compare(fnm.size() - ext.size(), ext.size(), ext) == 0;
+        }
+
+        // init_chunked() - Initialize buffer from chunk manifest
+        static void
+        init_chunked(const repo_type* repo, xrt::bo& xbo, const std::string& fnm)
+        {
+          auto manifest = repo->get(fnm, file_mode::read);
+          std::istringstream istr{std::string{manifest.data(), manifest.size()}};
+          std::string key;
+          size_t chunk_size = 0;
+          size_t size = 0;
+          istr >> key >> chunk_size >> key >> size;
+          if (!istr || chunk_size == 0)
+            throw std::runtime_error("invalid chunk manifest: " + fnm);
+
+          if (size > xbo.size())
+            throw std::runtime_error("size mismatch during buffer initialization");
+
+          auto xbo_data = xbo.map<char*>();
+          size_t offset = 0;
+          std::string chunk;
+          while (istr >> chunk) {
+            auto data = repo->get(chunk, file_mode::mmap);
+            if (offset + data.size() > size || data.size() > chunk_size)
+              throw std::runtime_error("size mismatch in chunk: " + chunk);
+
+            std::memcpy(xbo_data + offset, data.data(), data.size());
+            offset += chunk_size;
+          }
+          xbo.sync(XCL_BO_SYNC_BO_TO_DEVICE);
+        }
+
         // init() - Initialize recorded buffers with their data
         //
         // This function is called prior to frame execution.  Per
@@ -462,6 +504,11 @@ class replay_impl
         {
           for (auto& [nm, value] : m_bo2data) {
             auto& [xbo, fnm] = value;
+            if (is_manifest(fnm)) {
+              init_chunked(repo, xbo, fnm);
+              continue;
+            }
+
             auto data = repo->get(fnm, file_mode::mmap);
             if (data.size() > xbo.size())
               throw std::runtime_error("size mismatch during buffer initialization");
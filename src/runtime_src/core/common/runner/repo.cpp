@@ -5,6 +5,7 @@
 #define XRT_API_SOURCE         // in same dll as coreutil
 #include "repo.h"
 #include "detail/mmap.h"
+#include "detail/pack.h"
 
 #include <atomic>
 #include <filesystem>
@@ -332,6 +333,76 @@ public:
   
 };
 
+////////////////////////////////////////////////////////////////
+// class pack_repo - Implementation backed by an artifact pack
+// The pack is memory mapped and artifacts in the pack are returned
+// as spans into the mapping without copying.  Keys not in the pack
+// are resolved as files relative to the directory of the pack.
+////////////////////////////////////////////////////////////////
+class pack_repo : public file_repo
+{
+  detail::mmap_artifact m_map;
+  std::unordered_map<std::string, span<char>> m_index;
+
+  static std::filesystem::path
+  pack_dir(const std::filesystem::path& pack)
+  {
+    return pack.has_parent_path() ? pack.parent_path() : std::filesystem::path{"."};
+  }
+
+  const span<char>*
+  find(const std::string& key) const
+  {
+    auto it = m_index.find(key);
+    if (it == m_index.end())
+      it = m_index.find(std::filesystem::path{key}.lexically_normal().generic_string());
+
+    return it == m_index.end() ? nullptr : &it->second;
+  }
+
+public:
+  explicit
+  pack_repo(const std::filesystem::path& pack)
+    : file_repo(pack_dir(pack))
+    , m_map(pack.string())
+    , m_index(detail::pack::read_index(m_map.get_span()))
+  {}
+
+  span<char>
+  get(const std::string& key) const override
+  {
+    if (auto data = find(key))
+      return *data;
+
+    return file_repo::get(key);
+  }
+
+  // get() - The pack is mapped, file mode hint is irrelevant
+  span<char>
+  get(const std::string& key, file_mode hint) const override
+  {
+    if (auto data = find(key))
+      return *data;
+
+    return base_repo::get(key, hint);
+  }
+};
+
+// Create pack repo if path is a pack or a directory with a
+// default pack, otherwise a file repo
+static std::unique_ptr<repository_impl>
+create_file_repo(const std::filesystem::path& path)
+{
+  if (std::filesystem::is_regular_file(path) && detail::pack::is_pack(path))
+    return std::make_unique<pack_repo>(path);
+
+  auto pack = path / detail::pack::default_fnm;
+  if (std::filesystem::is_regular_file(pack) && detail::pack::is_pack(pack))
+    return std::make_unique<pack_repo>(pack);
+
+  return std::make_unique<file_repo>(path);
+}
+
 ////////////////////////////////////////////////////////////////
 // class repository - Public API implementation
 ////////////////////////////////////////////////////////////////
@@ -342,7 +413,7 @@ repository()
 
 repository::
 repository(const std::filesystem::path& artifacts_dir)
-  : xrt::detail::pimpl<repository_impl>{std::make_unique<file_repo>(artifacts_dir)}
+  : xrt::detail::pimpl<repository_impl>{create_file_repo(artifacts_dir)}
 {}
 
 repository::~repository() = default;
@@ -73,6 +73,12 @@ public:
   /**
    * ctor - Supply base directory for file data
    * aka file_repo
+   *
+   * If @a artifacts_dir is an artifact pack file, or a directory
+   * containing an artifact pack named artifacts.pack, then the pack
+   * is memory mapped and artifacts in the pack are returned as
+   * spans into the mapping without copying.  Keys not found in the
+   * pack are resolved as files relative to the pack directory.
    */
   XRT_API_EXPORT
   explicit
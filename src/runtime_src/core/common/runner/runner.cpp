@@ -10,6 +10,7 @@
 
 #include "runner.h"
 #include "cpu.h"
+#include "detail/histogram.h"
 #include "detail/module_cache.h"
 #include "detail/streambuf.h"
 
@@ -39,18 +40,30 @@
 #include "core/common/json/nlohmann/json.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cmath>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <filesystem>
 #include <fstream>
+#include <functional>
+#include <future>
 #include <iostream>
 #include <istream>
+#include <limits>
 #include <map>
 #include <memory>
-#include <random>
+#include <optional>
+#include <set>
 #include <string>
 #include <thread>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #ifdef _WIN32
 # pragma warning (disable: 4100 4189 4505)
@@ -106,6 +119,155 @@ insert_json_object(json& dest, const json& src)
     dest.insert(src.begin(), src.end());
 }
 
+// Buffers are initialized and validated in chunks of this size,
+// which are distributed over multiple threads
+constexpr size_t buffer_chunk_size = 1024 * 1024;
+
+// parallel_chunks() - Call fn(idx, begin, end) for each chunk of [0, size[
+//
+// Chunks are distributed over threads, small ranges are processed
+// on the calling thread.  The function must not throw.
+template <typename Function>
+static void
+parallel_chunks(size_t size, size_t chunk_size, Function&& fn)
+{
+  auto chunks = (size + chunk_size - 1) / chunk_size;
+  auto threads = std::min<size_t>(chunks, std::max(std::thread::hardware_concurrency(), 1U));
+  std::atomic<size_t> next {0};
+  auto worker = [&] {
+    for (size_t idx = next++; idx < chunks; idx = next++)
+      fn(idx, idx * chunk_size, std::min(size, (idx + 1) * chunk_size));
+  };
+
+  std::vector<std::thread> pool;
+  for (size_t t = 1; t < threads; ++t)
+    pool.emplace_back(worker);
+
+  worker();
+
+  for (auto& t : pool)
+    t.join();
+}
+
+// splitmix64() - Fast seedable PRNG step
+//
+// Used to fill buffers with reproducible random data.  Each chunk of
+// a buffer is seeded independently such that the content does not
+// depend on how chunks are distributed over threads.
+inline uint64_t
+splitmix64(uint64_t& state)
+{
+  uint64_t z = (state += 0x9e3779b97f4a7c15ULL); // NOLINT
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;   // NOLINT
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;   // NOLINT
+  return z ^ (z >> 31);                          // NOLINT
+}
+
+// histogram_to_json() - Summary of latency histogram in microseconds
+inline json
+histogram_to_json(const xrt_core::detail::latency_histogram& hist)
+{
+  auto us = [](double ns) { return ns / 1000.0; }; // NOLINT
+  json j;
+  j["count"] = hist.count();
+  j["min"] = us(static_cast<double>(hist.min()));
+  j["mean"] = us(hist.mean());
+  j["stddev"] = us(hist.stddev());
+  j["p50"] = us(static_cast<double>(hist.percentile(50)));   // NOLINT
+  j["p90"] = us(static_cast<double>(hist.percentile(90)));   // NOLINT
+  j["p99"] = us(static_cast<double>(hist.percentile(99)));   // NOLINT
+  j["p99.9"] = us(static_cast<double>(hist.percentile(99.9))); // NOLINT
+  j["max"] = us(static_cast<double>(hist.max()));
+  return j;
+}
+
+// struct mismatch - Result of comparing a buffer to golden data
+struct mismatch
+{
+  size_t count = 0;                               // mismatching elements
+  size_t first = std::numeric_limits<size_t>::max(); // offset of first mismatch
+  size_t last = 0;                                // offset of last mismatch
+  double max_error = 0;                           // max abs error
+
+  void
+  merge(const mismatch& other)
+  {
+    if (!other.count)
+      return;
+
+    count += other.count;
+    first = std::min(first, other.first);
+    last = std::max(last, other.last);
+    max_error = std::max(max_error, other.max_error);
+  }
+};
+
+// exceeds() - Check if the absolute error of value exceeds tolerance
+//
+// Integral values are compared in integer arithmetic, a conversion
+// to double loses the low bits of 64-bit values.  The absolute error
+// is returned in error.
+template <typename ValueType>
+static bool
+exceeds(ValueType value, ValueType gold, double tolerance, double& error)
+{
+  if constexpr (std::is_integral_v<ValueType>) {
+    using utype = std::make_unsigned_t<ValueType>;
+    utype diff = value > gold
+      ? static_cast<utype>(static_cast<utype>(value) - static_cast<utype>(gold))
+      : static_cast<utype>(static_cast<utype>(gold) - static_cast<utype>(value));
+    error = static_cast<double>(diff);
+    if (!(tolerance >= 0))
+      return true;
+    if (tolerance >= static_cast<double>(std::numeric_limits<utype>::max()))
+      return false;
+    return diff > static_cast<utype>(tolerance);
+  }
+  else {
+    error = std::abs(static_cast<double>(value) - static_cast<double>(gold));
+    return !(error <= tolerance);
+  }
+}
+
+// compare() - Compare data to golden data as elements of ValueType
+//
+// Chunks are compared with memcmp which is vectorized, only chunks
+// that differ are compared element by element.  An element
+// mismatches if its absolute error exceeds tolerance.
+template <typename ValueType>
+static mismatch
+compare(const char* data, const char* golden, size_t bytes, double tolerance)
+{
+  constexpr size_t esz = sizeof(ValueType);
+  auto chunks = (bytes + buffer_chunk_size - 1) / buffer_chunk_size;
+  std::vector<mismatch> results(chunks);
+  parallel_chunks(bytes, buffer_chunk_size, [&](size_t idx, size_t begin, size_t end) {
+    if (std::memcmp(data + begin, golden + begin, end - begin) == 0)
+      return;
+
+    auto& result = results[idx];
+    for (size_t offset = begin; offset + esz <= end; offset += esz) {
+      ValueType value {};
+      ValueType gold {};
+      std::memcpy(&value, data + offset, esz);
+      std::memcpy(&gold, golden + offset, esz);
+      double error = 0;
+      if (exceeds(value, gold, tolerance, error)) {
+        ++result.count;
+        result.first = std::min(result.first, offset);
+        result.last = offset;
+        if (error > result.max_error)
+          result.max_error = error;
+      }
+    }
+  });
+
+  mismatch total;
+  for (const auto& result : results)
+    total.merge(result);
+  return total;
+}
+
 // Lifted from xrt_kernel.cpp
 // Helper for converting an arbitrary sequence of bytes into
 // a range that be iterated byte-by-byte (or by ValueType)
@@ -894,12 +1056,12 @@ public:
                      m_xrt_bo ? "true" : "false");
         }
 
-        // Copy constructor.  Allocates new resources::buffer and new
-        // XRT buffer object.
+        // Copy constructor.  The argument refers to the buffer of
+        // the same name in resources, which for a copy of the recipe
+        // resources is a new buffer shared by all runs of the copy.
         argument(const resources& resources, const argument& other)
-          : m_buffer{resources::buffer::create_buffer           // new resources:buffer
-                     (resources.get_device(),
-                      other.m_buffer)}                          // (see earlier comment)
+          : m_buffer{resources.get_buffer_or_error                // buffer in resources
+                     (other.m_buffer.get_name())}
           , m_offset{other.m_offset}                            // same offset
           , m_size{other.m_size}                                // same size
           , m_argidx{other.m_argidx}                            // same argidx
@@ -1155,6 +1317,17 @@ public:
         return m_name;
       }
 
+      // Names of resource buffers used by this run
+      std::set<std::string>
+      get_buffer_names() const
+      {
+        std::set<std::string> names;
+        for (const auto& [name, arg] : m_args)
+          names.insert(name);
+
+        return names;
+      }
+
       void
       set_dtrace(const std::string& path)
       {
@@ -1333,12 +1506,89 @@ public:
       }
     }; // npu_runlist
 
+    // struct pipeline - pipelined execution of runlists
+    //
+    // Each runlist is a stage that executes on its own xrt::queue, the
+    // queues share an executor with one worker per stage.  A stage of
+    // iteration i+1 executes concurrently with later stages of
+    // iteration i, such that CPU runlists overlap with in-flight NPU
+    // runlists.
+    //
+    // Iterations rotate over lanes, where lane 0 is the execution
+    // itself and the other lanes are clones of it with their own
+    // internal buffers.  A lane is reused when the iteration that
+    // last used it has completed.  Internal buffers carry data within
+    // an iteration only (see recipe.md) and are private to the lane.
+    // Bound buffers are shared by all lanes; a stage that shares a
+    // bound buffer with a later stage waits for that later stage of
+    // the previous iteration.  As a result every buffer is accessed in
+    // the same order as in sequential execution.
+    struct pipeline
+    {
+      std::vector<execution> m_lanes;                     // lanes 1..depth-1
+      std::vector<std::set<std::string>> m_buffers;       // buffers used by each stage
+      std::vector<std::vector<size_t>> m_hazards;         // later stages sharing a bound buffer
+      xrt::queue::executor m_executor;
+      std::vector<xrt::queue> m_stages;                   // one queue per stage
+      std::vector<std::shared_future<void>> m_last;       // stages of last enqueued iteration
+      std::deque<std::shared_future<void>> m_inflight;    // last stage of iterations in flight
+      size_t m_next = 0;                                  // sequence number of next iteration
+
+      pipeline(std::vector<execution> lanes, std::vector<std::set<std::string>> buffers)
+        : m_lanes(std::move(lanes))
+        , m_buffers(std::move(buffers))
+        , m_executor{static_cast<unsigned int>(m_buffers.size())}
+      {
+        for (size_t stage = 0; stage < m_buffers.size(); ++stage)
+          m_stages.emplace_back(m_executor);
+      }
+
+      // In-flight stages refer to runlists of the lanes
+      ~pipeline()
+      {
+        for (const auto& done : m_inflight)
+          done.wait();
+      }
+
+      pipeline(const pipeline&) = delete;
+      pipeline(pipeline&&) = delete;
+      pipeline& operator=(const pipeline&) = delete;
+      pipeline& operator=(pipeline&&) = delete;
+
+      size_t
+      depth() const
+      {
+        return m_lanes.size() + 1;
+      }
+
+      // Compute the later stages that share a bound buffer with each stage
+      void
+      update_hazards(const std::map<std::string, xrt::bo>& bound)
+      {
+        auto stages = m_buffers.size();
+        m_hazards.assign(stages, {});
+        for (size_t stage = 0; stage < stages; ++stage) {
+          for (size_t later = stage + 1; later < stages; ++later) {
+            auto shared = std::any_of(m_buffers[stage].begin(), m_buffers[stage].end(), [&](const auto& nm) {
+              return bound.count(nm) && m_buffers[later].count(nm);
+            });
+            if (shared)
+              m_hazards[stage].push_back(later);
+          }
+        }
+      }
+    };
+
     std::vector<run> m_runs;
     std::exception_ptr m_eptr;
     size_t m_runlist_threshold = default_runlist_threshold;
     std::vector<std::unique_ptr<runlist>> m_runlists;
     std::unique_ptr<xrt::queue> m_queue;      // Queue that executes the runlists in sequence
     std::vector<xrt::queue::event> m_events;  // Events that signal complettion of a runlist
+    std::map<std::string, xrt::bo> m_bound;   // Buffers bound to the execution
+    std::unique_ptr<pipeline> m_pipeline;     // Pipelined execution if enabled
+    std::function<void(size_t)> m_on_complete; // Called when an iteration completes
+    bool m_poll_complete = false;             // Poll for completion of single runlist
 
     static std::vector<std::unique_ptr<runlist>>
     create_runlists(const resources& resources, const std::vector<run>& runs, size_t rlt)
@@ -1380,6 +1630,24 @@ public:
       return runlists;
     }
 
+    // create_stage_buffers() - buffers used by each runlist
+    // The runlists are grouped the same way as in create_runlists().
+    static std::vector<std::set<std::string>>
+    create_stage_buffers(const std::vector<run>& runs)
+    {
+      std::vector<std::set<std::string>> stages;
+      std::optional<bool> npu;
+      for (const auto& run : runs) {
+        if (!npu || *npu != run.is_npu_run()) {
+          npu = run.is_npu_run();
+          stages.emplace_back();
+        }
+
+        stages.back().merge(run.get_buffer_names());
+      }
+      return stages;
+    }
+
     // create_runs() - create a vector of runs from a property tree
     static std::vector<run>
     create_runs(const resources& resources, const json& runs_array)
@@ -1413,6 +1681,7 @@ public:
       , m_runlist_threshold{runlist_threshold}
       , m_runlists{create_runlists(resources, m_runs, m_runlist_threshold)}
       , m_queue{m_runlists.size() > 1 ? std::make_unique<xrt::queue>() : nullptr}
+      , m_events(m_runlists.size())
     {}
 
     // execution() - create an execution object from existing runs
@@ -1421,6 +1690,7 @@ public:
       : m_runs{create_runs(resources, other.m_runs)}
       , m_runlists{create_runlists(resources, m_runs, other.m_runlist_threshold)}
       , m_queue{m_runlists.size() > 1 ? std::make_unique<xrt::queue>() : nullptr}
+      , m_events(m_runlists.size())
     {}
 
     size_t
@@ -1429,6 +1699,30 @@ public:
       return m_runs.size();
     }
 
+    // Number of runlists, which is the number of pipeline stages
+    size_t
+    num_runlists() const
+    {
+      return m_runlists.size();
+    }
+
+    // set_completion_callback() - notify completion of iterations
+    //
+    // @fn: called with the iteration when all its runlists have
+    //  completed, from the thread that observed the completion
+    // @poll: poll rather than block for completion of a single runlist
+    //
+    // A single runlist is then waited on the queue, wait() waits for
+    // the queue rather than for the runlist.
+    void
+    set_completion_callback(std::function<void(size_t)> fn, bool poll)
+    {
+      m_on_complete = std::move(fn);
+      m_poll_complete = poll;
+      if (m_on_complete && !m_queue)
+        m_queue = std::make_unique<xrt::queue>();
+    }
+
     void
     bind(const std::string& name, const xrt::bo& bo)
     {
@@ -1437,6 +1731,18 @@ public:
       // Maybe some optimization could be done here.
       for (auto& run : m_runs)
         run.bind(name, bo);
+
+      m_bound[name] = bo;
+      if (!m_pipeline)
+        return;
+
+      // Lanes share the bound buffer, which must not be in use by
+      // in-flight iterations when rebound.
+      wait_pipeline();
+      for (auto& lane : m_pipeline->m_lanes)
+        lane.bind(name, bo);
+
+      m_pipeline->update_hazards(m_bound);
     }
 
     void
@@ -1445,6 +1751,106 @@ public:
       for (auto& run : m_runs)
         if (run.get_name() == name)
           run.set_dtrace(path);
+
+      if (m_pipeline)
+        for (auto& lane : m_pipeline->m_lanes)
+          lane.set_dtrace(name, path);
+    }
+
+    // enable_pipeline() - execute runlists as pipelined stages
+    //
+    // @lanes: clones of this execution, one per additional iteration
+    //  in flight
+    //
+    // Buffers already bound to this execution are bound to the lanes.
+    void
+    enable_pipeline(std::vector<execution> lanes)
+    {
+      for (auto& lane : lanes)
+        for (const auto& [name, bo] : m_bound)
+          lane.bind(name, bo);
+
+      m_pipeline = std::make_unique<pipeline>(std::move(lanes), create_stage_buffers(m_runs));
+      m_pipeline->update_hazards(m_bound);
+    }
+
+    // Wait for oldest in-flight iteration of pipelined execution
+    void
+    wait_pipeline_oldest()
+    {
+      auto& inflight = m_pipeline->m_inflight;
+      if (inflight.empty())
+        return;
+
+      auto done = std::move(inflight.front());
+      inflight.pop_front();
+      done.get(); // rethrows error of failed stage
+    }
+
+    // Wait for all in-flight iterations of pipelined execution.  The
+    // first error is rethrown after all iterations have completed.
+    void
+    wait_pipeline()
+    {
+      std::exception_ptr eptr;
+      while (!m_pipeline->m_inflight.empty()) {
+        try {
+          wait_pipeline_oldest();
+        }
+        catch (...) {
+          if (!eptr)
+            eptr = std::current_exception();
+        }
+      }
+
+      m_pipeline->m_last.clear();
+      if (eptr)
+        std::rethrow_exception(eptr);
+    }
+
+    // Enqueue all stages of an iteration of pipelined execution
+    //
+    // A stage waits for the previous stage of the same iteration and
+    // for later stages of the previous iteration that share a bound
+    // buffer.  Stage errors propagate to dependent stages.
+    void
+    execute_pipeline(size_t iteration)
+    {
+      auto& pl = *m_pipeline;
+      auto last = m_runlists.size() - 1;
+
+      // The lane of this iteration is free when the iteration that
+      // last used it has completed.
+      if (pl.m_inflight.size() == pl.depth())
+        wait_pipeline_oldest();
+
+      auto lidx = pl.m_next++ % pl.depth();
+      auto& lane = lidx ? pl.m_lanes[lidx - 1] : *this;
+
+      std::vector<std::shared_future<void>> stages(m_runlists.size());
+      for (size_t stage = 0; stage < stages.size(); ++stage) {
+        std::vector<std::shared_future<void>> deps;
+        if (stage > 0)
+          deps.push_back(stages[stage - 1]);
+
+        if (!pl.m_last.empty())
+          for (auto later : pl.m_hazards[stage])
+            deps.push_back(pl.m_last[later]);
+
+        stages[stage] = pl.m_stages[stage].enqueue
+          ([this, deps = std::move(deps), rl = lane.m_runlists[stage].get(), iteration, notify = (stage == last)] {
+          for (const auto& dep : deps)
+            dep.get();
+
+          rl->execute(iteration);
+          rl->wait(false); // needed for NPU runlists, noop for CPU
+          if (notify)
+            notify_complete(iteration);
+        });
+      }
+
+      pl.m_inflight.push_back(stages.back());
+      pl.m_last = std::move(stages);
     }
 
     // execute_runlist() - execute a runlist synchronously
@@ -1467,36 +1873,77 @@ public:
       }
     }
 
+    // Call the completion callback of an iteration if any.  Called
+    // from the thread that observed the completion.
+    void
+    notify_complete(size_t iteration) const
+    {
+      if (m_on_complete && !m_eptr)
+        m_on_complete(iteration);
+    }
+
+    // Wait for the single runlist of an iteration on the queue and
+    // notify its completion
+    void
+    complete_runlist(size_t iteration)
+    {
+      try {
+        m_runlists[0]->wait(m_poll_complete);
+      }
+      catch (const std::exception&) {
+        m_eptr = std::current_exception();
+      }
+      notify_complete(iteration);
+    }
+
     // Execute a run-recipe iteration
     void
     execute(size_t iteration)
     {
-      // If single runlist then avoid the overhead of xrt::queue
+      if (m_pipeline) {
+        execute_pipeline(iteration);
+        return;
+      }
+
+      // If single runlist then avoid the overhead of xrt::queue for
+      // submission, completion is observed on the queue only if a
+      // completion callback is set
       if (m_runlists.size() == 1) {
         m_runlists[0]->execute(iteration);
+        if (m_on_complete)
+          m_events[0] = m_queue->enqueue([this, iteration] { complete_runlist(iteration); });
         return;
       }
 
       // The recipe has multiple runlists (a mix of NPU and CPU).
       // Restart the recipes, but ensure that a runlist has completed
       // its previous iteration before restarting it.
-      int count = 0;
-      for (auto& runlist : m_runlists) {
+      auto last = m_runlists.size() - 1;
+      for (size_t idx = 0; idx <= last; ++idx) {
         if (iteration > 0)
-          m_events[count].wait();
+          m_events[idx].wait();
 
-        m_events[count++] = m_queue->enqueue([this, iteration, &runlist] {
-          execute_runlist(iteration, runlist.get(), m_eptr);
+        m_events[idx] = m_queue->enqueue([this, iteration, runlist = m_runlists[idx].get(), notify = (idx == last)] {
+          execute_runlist(iteration, runlist, m_eptr);
+          if (notify)
+            notify_complete(iteration);
         });
       }
     }
 
+    // Wait for execution to complete.  A pipelined execution waits
+    // for all in-flight iterations, it does not support polling.
     void
     wait(bool poll)
     {
+      if (m_pipeline) {
+        wait_pipeline();
+        return;
+      }
+
       // If single runlist then it was submitted explicitly, so
-      // wait explicitly
-      if (m_runlists.size() == 1) {
+      // wait explicitly unless completion is observed on the queue
+      if (m_runlists.size() == 1 && !m_on_complete) {
         m_runlists[0]->wait(poll);
         return;
       }
@@ -1517,6 +1964,8 @@ public:
       json rpt;
       rpt["resources"]["runlist_threshold"] = m_runlist_threshold;
       rpt["resources"]["runlist"] = m_runlist_threshold;
+      if (m_pipeline)
+        rpt["resources"]["pipeline"] = m_pipeline->depth();
       return rpt;
     }
   }; // class recipe::execution
@@ -1555,10 +2004,36 @@ public:
     return &m_execution;
   }
 
+  // clone_execution() - copy of the execution with its own buffers
+  //
+  // The copy of the resources has one new buffer per named buffer,
+  // the cloned runs refer to these buffers, so data produced by one
+  // run of the clone is consumed by the next run of the clone.
   execution
   clone_execution() const
   {
-    return {m_resources, m_execution};
+    resources lane_resources{m_resources};
+    return {lane_resources, m_execution};
+  }
+
+  // enable_pipeline() - pipeline execution of recipe runlists
+  //
+  // @depth: number of iterations in flight, each with its own
+  //  internal buffers
+  // Return: false if the recipe has a single runlist, which
+  //  cannot be pipelined
+  bool
+  enable_pipeline(size_t depth)
+  {
+    if (m_execution.num_runlists() < 2)
+      return false;
+
+    std::vector<execution> lanes;
+    for (size_t i = 1; i < depth; ++i)
+      lanes.emplace_back(clone_execution());
+
+    m_execution.enable_pipeline(std::move(lanes));
+    return true;
   }
 
   size_t
@@ -1709,13 +2184,50 @@ class profile
       return bos;
     }
 
+    // compare() - Compare bo data to golden data per element type
+    static mismatch
+    compare(const std::string& type, const char* data, const char* golden, size_t bytes, double tolerance)
+    {
+      static const std::map<std::string, size_t> type_size {
+        {"int8", 1}, {"uint8", 1}, {"int16", 2}, {"uint16", 2},
+        {"int32", 4}, {"uint32", 4}, {"int64", 8}, {"uint64", 8},
+        {"float", 4}, {"double", 8}
+      };
+
+      auto itr = type_size.find(type);
+      if (itr == type_size.end())
+        throw profile_error("bad validate type: " + type);
+
+      if (bytes % itr->second)
+        throw profile_error("validate range is not a multiple of " + type + " size");
+
+      if (type == "int8")   return ::compare<int8_t>(data, golden, bytes, tolerance);
+      if (type == "uint8")  return ::compare<uint8_t>(data, golden, bytes, tolerance);
+      if (type == "int16")  return ::compare<int16_t>(data, golden, bytes, tolerance);
+      if (type == "uint16") return ::compare<uint16_t>(data, golden, bytes, tolerance);
+      if (type == "int32")  return ::compare<int32_t>(data, golden, bytes, tolerance);
+      if (type == "uint32") return ::compare<uint32_t>(data, golden, bytes, tolerance);
+      if (type == "int64")  return ::compare<int64_t>(data, golden, bytes, tolerance);
+      if (type == "uint64") return ::compare<uint64_t>(data, golden, bytes, tolerance);
+      if (type == "float")  return ::compare<float>(data, golden, bytes, tolerance);
+      return ::compare<double>(data, golden, bytes, tolerance);
+    }
+
     // Validate a resource buffer per profile.json validate json node
     // "validate": {
     //   "file": "gold.bin", // path to file
     //   "skip": 0,          // skip fist bytes of file (optional)
     //   "begin": 0,         // bo offset to start validating at (optional)
     //   "end": bo.size()    // bo offset to start validating at (optional)
+    //   "type": "uint8",    // element type of data (optional)
+    //   "tolerance": 0      // max abs error per element (optional)
     //  }
+    //
+    // The buffer is compared in parallel chunks.  On mismatch, the
+    // error reports number of mismatching elements, offsets of first
+    // and last mismatch, and max absolute error of an element, where
+    // elements are interpreted per "type", one of int8, uint8, int16,
+    // uint16, int32, uint32, int64, uint64, float, or double.
     void
     validate_buffer(xrt::bo& bo, const validate_node& node, const xartifacts::repo& repo)
     {
@@ -1749,19 +2261,19 @@ class profile
         throw profile_error("bad validate begin/end values: " + std::to_string(bo_begin) + "/" + std::to_string(bo_end));
 
       auto bo_data = bo.map<char*>();
-      auto bo_range_bytes = bo_end - bo_begin;
+      auto type = node.value<std::string>("type", "uint8");
+      auto tolerance = node.value<double>("tolerance", 0.0);
 
       XRT_DEBUGF("profile::bindings::validate_buffer() validating bo range [%d,%d[\n", bo_begin, bo_end);
-      if (std::equal(bo_data + bo_begin, bo_data + bo_end, golden_data.data()))
+      auto result = compare(type, bo_data + bo_begin, golden_data.data(), bo_end - bo_begin, tolerance);
+      if (!result.count)
         return;
 
-      // Error
-      for (uint64_t i = 0; i < bo_range_bytes; ++i) {
-        if (golden_data[i] != bo_data[bo_begin + i])
-          throw validation_error
-            ("gold[" + std::to_string(i) + "] = " + std::to_string(golden_data[i])
-             + " does not match bo value in bo " + std::to_string(bo_data[i]));
-      }
+      throw validation_error
+        (std::to_string(result.count) + " " + type + " elements do not match golden data"
+         + ", first mismatch at bo offset " + std::to_string(bo_begin + result.first)
+         + ", last mismatch at bo offset " + std::to_string(bo_begin + result.last)
+         + ", max abs error " + std::to_string(result.max_error));
     }
 
     // init_buffer_file() - Initialize bo from a content of a file
@@ -1869,6 +2381,73 @@ class profile
       return bo;
     }
 
+    // init_buffer_file_dma() - Initialize bo by DMA from mapped file
+    //
+    // "init": {
+    //   "file": "path",
+    //   "dma": true,     // copy file data to bo by DMA
+    //   ...              // same as init_buffer_file()
+    // }
+    //
+    // The file is memory mapped and wrapped in a userptr bo from
+    // which data is copied to the bo with xrt::bo::copy, which uses
+    // device DMA when supported.  The file data is not staged
+    // through a host copy.  Falls back to init_buffer_file() if the
+    // file data cannot be used as a userptr bo or if the file data
+    // can be used as the bo itself.
+    //
+    // The returned bo is synced to device.
+    xrt::bo
+    init_buffer_file_dma(size_t bo_size, const init_node& node, size_t iteration)
+    {
+      using file_mode = xrt_core::artifacts::repository::file_mode;
+      auto file = node.at("file").get<std::string>();
+      auto skip = node.value<size_t>("skip", 0);
+      auto bo_begin = node.value<size_t>("begin", 0);
+      auto bo_end = node.value<size_t>("end", bo_size);
+      auto data = m_repo.get(file, file_mode::mmap);
+
+      auto whole_bo = (bo_begin == 0 && bo_end == bo_size && skip < data.size() && data.size() - skip >= bo_size);
+      if (whole_bo || !is_page_aligned(data.data()) || skip + 1 > data.size() || bo_begin > bo_end || bo_end > bo_size) {
+        // userptr bo from file or error handling as per host copy
+        auto bo = init_buffer_file(bo_size, node, iteration);
+        bo.sync(XCL_BO_SYNC_BO_TO_DEVICE);
+        return bo;
+      }
+
+      XRT_DEBUGF("profile::bindings::init_buffer_file_dma() dma from file %s\n", file.c_str());
+      xrt::bo file_bo = xrt::ext::bo{m_device, data.data(), data.size(), xrt::ext::bo::access_mode::read};
+      file_bo.sync(XCL_BO_SYNC_BO_TO_DEVICE);
+
+      // bo_size is non-zero, otherwise the whole file is the bo
+      auto file_bytes = data.size() - skip;
+      xrt::bo bo = xrt::ext::bo{m_device, bo_size};
+
+      // Pad the bo with 0s outside the [bo_begin, bo_end[ range
+      auto bo_data = bo.map<char*>();
+      if (bo_begin) {
+        std::fill(bo_data, bo_data + bo_begin, char(0));
+        bo.sync(XCL_BO_SYNC_BO_TO_DEVICE, bo_begin, 0);
+      }
+      if (bo_end < bo.size()) {
+        std::fill(bo_data + bo_end, bo_data + bo.size(), char(0));
+        bo.sync(XCL_BO_SYNC_BO_TO_DEVICE, bo.size() - bo_end, bo_end);
+      }
+
+      // Same wrap around and iteration logic as init_buffer_file()
+      auto bo_range_bytes = bo_end - bo_begin;
+      auto bytes = bo_range_bytes;
+      while (bytes) {
+        auto bo_offset = bo_range_bytes - bytes;
+        auto beg = ((iteration * bo_range_bytes) + (bo_offset)) % file_bytes;
+        auto end = std::min<size_t>(beg + bytes, file_bytes);
+        bytes -= end - beg;
+        bo.copy(file_bo, end - beg, skip + beg, bo_begin + bo_offset);
+      }
+
+      return bo;
+    }
+
     // init_buffer_stride() - Create and initialize bo with value at stride
     // "init": {
     //   "stride": 1,   // write the value repeatedly at this stride
@@ -1894,18 +2473,38 @@ class profile
     }
 
     // init_buffer_random() - Create and initialize bo with random data
+    // "init": {
+    //   "random": true,
+    //   "seed": 0      // seed of random data (optional)
+    // }
+    //
+    // The bo is filled in parallel chunks.  Each chunk is seeded from
+    // the seed and the chunk index, so the data depends only on the
+    // seed and is reproducible between runs.
     xrt::bo
-    init_buffer_random(size_t bo_size, const init_node&)
+    init_buffer_random(size_t bo_size, const init_node& node)
     {
       xrt::bo bo = xrt::ext::bo{m_device, bo_size};
-      auto bo_data = bo.map<uint8_t*>();
-      static std::random_device rd;
-      std::generate(bo_data, bo_data + bo.size(), [&]() { return static_cast<uint8_t>(rd()); });
+      auto bo_data = bo.map<char*>();
+      auto seed = node.value<uint64_t>("seed", 0);
+      parallel_chunks(bo.size(), buffer_chunk_size, [bo_data, seed](size_t idx, size_t begin, size_t end) {
+        uint64_t state = seed ^ (idx * 0xd1b54a32d192ed03ULL); // NOLINT
+        auto offset = begin;
+        for (; offset + sizeof(uint64_t) <= end; offset += sizeof(uint64_t)) {
+          auto value = splitmix64(state);
+          std::memcpy(bo_data + offset, &value, sizeof(value));
+        }
+        if (offset < end) {
+          auto value = splitmix64(state);
+          std::memcpy(bo_data + offset, &value, end - offset);
+        }
+      });
       return bo;
     }
 
     // init_buffer() - Create and initialize a resource buffer per the binding json node
     // "init": {
+    //   // "file" file initialization, optionally by "dma"
     //   // "stride" stride initialization
     //   // "random" random initialization
     // }
@@ -1913,6 +2512,10 @@ class profile
     xrt::bo
     init_buffer(size_t bo_size, const init_node& node, size_t iteration)
     {
+      // DMA initialization is synced as part of DMA
+      if (node.contains("file") && node.value<bool>("dma", false))
+        return init_buffer_file_dma(bo_size, node, iteration);
+
       xrt::bo bo;
       // stride initialization with specified value
       if (node.contains("file"))
@@ -2068,6 +2671,10 @@ class profile
   //    "validate": bool,   (false)
   //    "mode" : mode       (none)
   //    "depth": depth      (1)
+  //    "rate": req/s       (openloop only)
+  //    "distribution": "fixed" | "poisson" (fixed)
+  //    "duration": ms      (1000)
+  //    "seed": number      (0)
   //    "iteration" : {
   //      "bind": false,    (false)
   //      "init": true,     (false)
@@ -2087,6 +2694,14 @@ class profile
   //    many times the runlist should be duplicated. A value of 1
   //    indicates no duplication.
   //
+  // In "openloop" mode, requests arrive at "rate" requests per second
+  // for "duration" milliseconds, independently of completions.  The
+  // arrivals are evenly spaced ("fixed") or follow a Poisson process
+  // seeded by "seed".  Up to "depth" (4) requests are outstanding;
+  // a request arriving when all are busy waits for a free one.  Per
+  // request latency is measured from arrival to completion, i.e.
+  // queueing plus service time.  "iterations" is ignored.
+  //
   // The behavior of an iteration is within the iteration sub-node.
   // - "bind" indicates if buffers should be re-bound to the
   //   recipe before an iteration.
@@ -2107,15 +2722,60 @@ class profile
     // the recipe execution section depth number of times.  This class
     // manages execution of the recipe whether its runs (runlist) is
     // cloned or not.
+    //
+    // In pipelined mode the recipe is not cloned, instead the recipe
+    // execution pipelines its runlists with depth iterations in
+    // flight.
     class executor
     {
+    public:
+      using clock = std::chrono::steady_clock;
+      using histogram = xrt_core::detail::latency_histogram;
+
+      // struct sample - Timestamps of one execution of a recipe runlist
+      struct sample
+      {
+        size_t iteration = 0;
+        size_t slot = 0;
+        clock::time_point submit;    // before execute()
+        clock::time_point submitted; // after execute() returned
+        clock::time_point done;      // completion observed by the completion callback
+      };
+
+      // struct stats - Per iteration timing
+      // @iteration: submit to observed completion
+      // @submit: host side overhead of submitting the runlist
+      // @wait: submitted to observed completion, the device time
+      //  plus completion notification
+      struct stats
+      {
+        histogram iteration;
+        histogram submit;
+        histogram wait;
+      };
+
+    private:
       profile* m_profile;
 
       recipe::execution* m_base;
+      size_t m_depth;
+      bool m_pipeline;
       std::vector<recipe::execution> m_copies;
 
       bool m_poll = false;
 
+      // Completion time of last iteration per slot, written by the
+      // completion callback of the slot's recipe execution.
+      std::vector<clock::time_point> m_completed;
+
+      // In flight sample per slot, and optionally all completed
+      // samples when a time series is requested.
+      std::vector<std::optional<sample>> m_pending;
+      std::deque<sample> m_inflight;  // pipelined mode
+      bool m_keep_samples = false;
+      std::vector<sample> m_samples;
+      stats m_stats;
+
       static std::vector<recipe::execution>
       create_execution_copies(recipe* recipe, size_t depth)
       {
@@ -2125,13 +2785,74 @@ class profile
 
         return copies;
       }
+
+      void
+      submit(size_t idx, size_t iteration)
+      {
+        auto start = clock::now();
+        slot(idx).execute(iteration);
+        m_pending[idx] = sample{iteration, idx, start, clock::now(), {}};
+      }
+
+      // Record a retired sample. The completion time is the time at
+      // which the completion callback observed the iteration done.
+      void
+      record(sample& smp, clock::time_point done)
+      {
+        // A completion without callback, e.g. failed iteration
+        smp.done = done < smp.submit ? clock::now() : done;
+        m_stats.iteration.record(smp.done - smp.submit);
+        m_stats.submit.record(smp.submitted - smp.submit);
+        m_stats.wait.record(smp.done - smp.submitted);
+        if (m_keep_samples)
+          m_samples.push_back(smp);
+      }
+
+      void
+      retire(size_t idx)
+      {
+        slot(idx).wait(m_poll);
+        auto& pending = m_pending[idx];
+        if (!pending)
+          return;
+
+        record(*pending, m_completed[idx]);
+        pending.reset();
+      }
+
+      // Submit an iteration to the pipelined recipe execution, retire
+      // the oldest iteration first if the pipeline is full.
+      void
+      submit_pipeline(size_t iteration)
+      {
+        if (m_inflight.size() == m_depth)
+          retire_pipeline();
+
+        auto start = clock::now();
+        m_base->execute(iteration);
+        m_inflight.push_back(sample{iteration, iteration % m_depth, start, clock::now(), {}});
+      }
+
+      void
+      retire_pipeline()
+      {
+        auto smp = m_inflight.front();
+        m_inflight.pop_front();
+        m_base->wait_pipeline_oldest();
+        record(smp, m_completed[smp.slot]);
+      }
       
     public:
-      executor(profile* profile, recipe* recipe, size_t depth, bool poll)
+      executor(profile* profile, recipe* recipe, size_t depth, bool poll, bool keep_samples, bool pipeline)
         : m_profile{profile}
         , m_base{recipe->get_execution()}
-        , m_copies{create_execution_copies(recipe, depth)}
+        , m_depth{depth}
+        , m_pipeline{pipeline && recipe->enable_pipeline(depth)}
+        , m_copies{m_pipeline ? std::vector<recipe::execution>{} : create_execution_copies(recipe, depth)}
         , m_poll(poll)
+        , m_completed(m_pipeline ? depth : m_copies.size() + 1)
+        , m_pending(m_copies.size() + 1)
+        , m_keep_samples(keep_samples)
       {
         // Bind buffers to the recipe execution objects prior to
         // executing the recipe. This will bind the buffers which have
@@ -2142,12 +2863,15 @@ class profile
       void
       execute_iteration(size_t iteration)
       {
+        if (m_pipeline) {
+          submit_pipeline(iteration);
+          return;
+        }
+
         // First iteration, start all
         if (iteration == 0) {
-          m_base->execute(iteration);
-
-          for (auto& exec : m_copies)
-            exec.execute(iteration);
+          for (size_t idx = 0; idx < slots(); ++idx)
+            submit(idx, iteration);
 
           return;
         }
@@ -2155,12 +2879,9 @@ class profile
         // Wait until previous iteration run is done then restart
         // This operates under the assumption that execution is
         // sequential and in-order of submission.
-        m_base->wait(m_poll);
-        m_base->execute(iteration);
-
-        for (auto& exec : m_copies) {
-          exec.wait(m_poll);
-          exec.execute(iteration);
+        for (size_t idx = 0; idx < slots(); ++idx) {
+          retire(idx);
+          submit(idx, iteration);
         }
       }
 
@@ -2189,14 +2910,121 @@ class profile
       void
       wait()
       {
-        m_base->wait(m_poll);
-        for (auto& exec : m_copies)
-          exec.wait(m_poll);
+        while (!m_inflight.empty())
+          retire_pipeline();
+
+        for (size_t idx = 0; idx < slots(); ++idx)
+          retire(idx);
+      }
+
+      bool
+      pipelined() const
+      {
+        return m_pipeline;
+      }
+
+      // Clear timing of previous execution
+      void
+      reset_stats()
+      {
+        m_stats = stats{};
+        m_samples.clear();
+      }
+
+      // Install completion callbacks that timestamp iterations of
+      // this executor's recipe executions.  The base execution may
+      // be shared with other executors, so this is done when the
+      // executor starts executing rather than at construction.
+      void
+      track_completion()
+      {
+        std::fill(m_completed.begin(), m_completed.end(), clock::time_point{});
+        for (size_t idx = 0; idx < slots(); ++idx) {
+          slot(idx).set_completion_callback([this, idx](size_t iteration) {
+            m_completed[m_pipeline ? iteration % m_depth : idx] = clock::now();
+          }, m_poll);
+        }
+      }
+
+      // Completion time of the last iteration of a slot
+      clock::time_point
+      completed(size_t idx) const
+      {
+        return m_completed[idx];
+      }
+
+      const stats&
+      get_stats() const
+      {
+        return m_stats;
+      }
+
+      const std::vector<sample>&
+      get_samples() const
+      {
+        return m_samples;
+      }
+
+      // Number of recipe executions, base and copies
+      size_t
+      slots() const
+      {
+        return m_copies.size() + 1;
+      }
+
+      // Recipe execution by index, 0 is the base
+      recipe::execution&
+      slot(size_t idx)
+      {
+        return idx ? m_copies[idx - 1] : *m_base;
       }
     }; // class profile::execution::executor
 
+    // struct openloop - Open loop arrival schedule
+    //
+    // Arrival times are precomputed relative to start of execution
+    // such that generating them does not perturb the measurement.
+    struct openloop
+    {
+      std::vector<std::chrono::nanoseconds> m_arrivals;
+      double m_rate = 0;
+      std::string m_distribution;
+      uint64_t m_duration_ms = 0;
+
+      openloop() = default;
+
+      explicit
+      openloop(const json& j)
+        : m_rate(j.value("rate", 0.0))
+        , m_distribution(j.value("distribution", "fixed"))
+        , m_duration_ms(j.value<uint64_t>("duration", 1000)) // NOLINT
+      {
+        if (m_rate <= 0)
+          throw profile_error("openloop execution requires a positive rate");
+
+        if (m_distribution != "fixed" && m_distribution != "poisson")
+          throw profile_error("bad openloop distribution: " + m_distribution);
+
+        auto duration = std::chrono::nanoseconds(std::chrono::milliseconds(m_duration_ms));
+        auto interval = 1e9 / m_rate; // NOLINT
+        uint64_t state = j.value<uint64_t>("seed", 0);
+        double at = 0;
+        while (at < static_cast<double>(duration.count())) {
+          m_arrivals.emplace_back(static_cast<int64_t>(at));
+          if (m_distribution == "fixed") {
+            at += interval;
+            continue;
+          }
+
+          // Exponential inter-arrival time, uniform in ]0, 1]
+          auto uniform = static_cast<double>((splitmix64(state) >> 11) + 1) * 0x1.0p-53; // NOLINT
+          at += -std::log(uniform) * interval;
+        }
+      }
+    };
+
     // Mode of execution
-    enum class mode { none, latency, throughput, validate };
+    enum class mode { none, latency, throughput, validate, openloop };
     
     profile* m_profile;
     std::string m_name;
@@ -2204,12 +3032,14 @@ class profile
     bool m_poll = false;
     size_t m_depth = 1;
     size_t m_recipe_runs = 1;  // legacy mode throughput calculation
+    std::string m_timeseries;  // file for per iteration timestamps
     executor m_executor;
     size_t m_iterations = 1;
     iteration_node m_iteration;
     bool m_verbose = false;
     bool m_validate = false;
     bool m_legacy = false;
+    openloop m_openloop;
     mutable json m_report;
 
     static mode
@@ -2219,7 +3049,8 @@ class profile
         {"default", mode::none},
         {"latency", mode::latency},
         {"throughput", mode::throughput},
-        {"validate", mode::validate}
+        {"validate", mode::validate},
+        {"openloop", mode::openloop}
       };
 
       if (auto itr = mode_map.find(mstr); itr != mode_map.end())
@@ -2235,7 +3066,8 @@ class profile
         {mode::none, "default"},
         {mode::latency, "latency"},
         {mode::throughput, "throughput"},
-        {mode::validate, "validate"}
+        {mode::validate, "validate"},
+        {mode::openloop, "openloop"}
       };
 
       if (auto itr = mode_map.find(m); itr != mode_map.end())
@@ -2250,7 +3082,7 @@ class profile
       if (m == mode::none || m == mode::validate)
         return j.value("iteration", json::object());
 
-      // validate and throughput do not support iteration node
+      // validate, throughput, and openloop do not support iteration node
       return json::object();
     }
 
@@ -2261,10 +3093,27 @@ class profile
       if (m == mode::throughput)
         return j.value("depth", 2);
 
-      // Only throughput mode supports depth of recipe
+      // For openloop, depth is the max number of outstanding requests
+      if (m == mode::openloop)
+        return std::max(j.value("depth", 4), 1); // NOLINT
+
+      // Only throughput and openloop modes support depth of recipe
       return 1;
     }
 
+    // Pipelining of recipe runlists applies to throughput mode only
+    static bool
+    get_pipeline(mode m, const json& j)
+    {
+      if (!j.value("pipeline", false))
+        return false;
+
+      if (m != mode::throughput)
+        throw profile_error("pipeline is only supported in throughput mode");
+
+      return true;
+    }
+
     static size_t
     get_iterations(const json& j)
     {
@@ -2303,6 +3152,129 @@ class profile
         m_profile->validate();
     }
 
+    // Write per iteration timestamps to m_timeseries file.  The
+    // format is csv if the file extension is .csv, otherwise json.
+    // Times are in microseconds relative to first submission.
+    void
+    write_timeseries() const
+    {
+      const auto& samples = m_executor.get_samples();
+      if (samples.empty())
+        return;
+
+      std::ofstream ostr(m_timeseries);
+      if (!ostr)
+        throw profile_error("Failed to open timeseries file: " + m_timeseries);
+
+      auto zero = samples.front().submit;
+      for (const auto& smp : samples)
+        zero = std::min(zero, smp.submit);
+
+      auto us = [zero](executor::clock::time_point tp) {
+        return std::chrono::duration<double, std::micro>(tp - zero).count();
+      };
+
+      if (std::filesystem::path(m_timeseries).extension() == ".csv") {
+        ostr << "iteration,slot,submit,submitted,done\n";
+        for (const auto& smp : samples)
+          ostr << smp.iteration << ',' << smp.slot << ',' << us(smp.submit) << ','
+               << us(smp.submitted) << ',' << us(smp.done) << '\n';
+        return;
+      }
+
+      json jts = json::array();
+      for (const auto& smp : samples)
+        jts.push_back({{"iteration", smp.iteration}, {"slot", smp.slot},
+                       {"submit", us(smp.submit)}, {"submitted", us(smp.submitted)},
+                       {"done", us(smp.done)}});
+      ostr << json{{"timeseries", jts}}.dump(2) << '\n';
+    }
+
+    // Execute requests at their arrival times
+    //
+    // Each recipe execution slot is driven by its own thread, which
+    // takes the next arrival, sleeps until the arrival time, and runs
+    // the request to completion.  A request is delayed (queued) if
+    // all slots are busy at its arrival time.
+    void
+    execute_openloop()
+    {
+      using clock = std::chrono::steady_clock;
+      using histogram = xrt_core::detail::latency_histogram;
+      const auto& arrivals = m_openloop.m_arrivals;
+      auto slots = m_executor.slots();
+      m_executor.track_completion();
+      std::vector<histogram> latency(slots);
+      std::vector<histogram> service(slots);
+      std::vector<std::exception_ptr> eptrs(slots);
+      std::atomic<size_t> next {0};
+      auto start = clock::now() + std::chrono::milliseconds(1);
+
+      auto worker = [&](size_t slot) {
+        try {
+          auto& exec = m_executor.slot(slot);
+          for (size_t idx = next++; idx < arrivals.size(); idx = next++) {
+            auto arrival = start + arrivals[idx];
+            std::this_thread::sleep_until(arrival);
+            auto submit = clock::now();
+            exec.execute(idx);
+            exec.wait(m_poll);
+            auto done = m_executor.completed(slot);
+            if (done < submit)
+              done = clock::now();
+            latency[slot].record(done - arrival);
+            service[slot].record(done - submit);
+          }
+        }
+        catch (...) {
+          eptrs[slot] = std::current_exception();
+          next = arrivals.size(); // stop other slots
+        }
+      };
+
+      std::vector<std::thread> threads;
+      for (size_t slot = 1; slot < slots; ++slot)
+        threads.emplace_back(worker, slot);
+
+      worker(0);
+
+      for (auto& t : threads)
+        t.join();
+
+      auto elapsed = clock::now() - start;
+
+      for (auto& eptr : eptrs)
+        if (eptr)
+          std::rethrow_exception(eptr);
+
+      for (size_t slot = 1; slot < slots; ++slot) {
+        latency[0].merge(latency[slot]);
+        service[0].merge(service[slot]);
+      }
+
+      auto elapsed_us = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+      auto requests = latency[0].count();
+      auto& report = m_report["openloop"];
+      report["rate"] = m_openloop.m_rate;
+      report["distribution"] = m_openloop.m_distribution;
+      report["duration"] = m_openloop.m_duration_ms;
+      report["requests"] = requests;
+      report["achieved_rate"] = elapsed_us ? (requests * 1000000.0) / elapsed_us : 0; // NOLINT
+      report["latency"] = histogram_to_json(latency[0]);
+      report["service"] = histogram_to_json(service[0]);
+      m_report["cpu"]["elapsed"] = elapsed_us;
+
+      if (m_verbose) {
+        std::cout << "Execution profile: " << m_name << "\n";
+        std::cout << "Elapsed time (us): " << elapsed_us << "\n";
+        std::cout << "Requests: " << requests << " at " << report["achieved_rate"].get<double>() << " req/s\n";
+        std::cout << "Latency p50/p99/p99.9 (us): "
+                  << report["latency"]["p50"].get<double>() << "/"
+                  << report["latency"]["p99"].get<double>() << "/"
+                  << report["latency"]["p99.9"].get<double>() << "\n";
+      }
+    }
+
   public:
     execution(profile* pr, recipe* rr, const json& j, bool legacy = false)
       : m_profile(pr)
@@ -2311,19 +3283,32 @@ class profile
       , m_poll{j.value("poll", false)}
       , m_depth(get_depth(m_mode, j))
       , m_recipe_runs(rr->num_runs())
-      , m_executor{m_profile, rr, m_depth, m_poll}
+      , m_timeseries(j.value("timeseries", ""))
+      , m_executor{m_profile, rr, m_depth, m_poll, !m_timeseries.empty(), get_pipeline(m_mode, j)}
       , m_iterations{get_iterations(j)}
       , m_iteration(get_iteration_node(m_mode, j))
       , m_verbose(j.value("verbose", true))
       , m_validate(j.value("validate", (m_mode == mode::validate)))
       , m_legacy(legacy)
-    {}
+    {
+      if (m_mode == mode::openloop)
+        m_openloop = openloop{j};
+    }
 
     // Execute the profile
     void
     execute()
     {
       XRT_DEBUGF("execution::execute(%s) depth(%d) mode(%s)\n",  m_name.c_str(), m_depth, to_string(m_mode).c_str());
+      if (m_mode == mode::openloop) {
+        execute_openloop();
+        if (m_validate)
+          m_profile->validate();
+        return;
+      }
+
+      m_executor.reset_stats();
+      m_executor.track_completion();
       unsigned long long time_ns = 0;
       {
         xrt_core::time_guard tg(time_ns);
@@ -2355,6 +3340,16 @@ class profile
       if (m_legacy || m_mode == mode::throughput)
         m_report["cpu"]["throughput"] = throughput;
 
+      const auto& stats = m_executor.get_stats();
+      m_report["cpu"]["iteration"] = histogram_to_json(stats.iteration);
+      m_report["cpu"]["submit"] = histogram_to_json(stats.submit);
+      m_report["cpu"]["wait"] = histogram_to_json(stats.wait);
+
+      if (!m_timeseries.empty()) {
+        write_timeseries();
+        m_report["cpu"]["timeseries"] = m_timeseries;
+      }
+
       if (m_verbose) {
         std::cout << "Execution profile: " << m_name << "\n";
         std::cout << "Elapsed time (us): " << elapsed << "\n";
@@ -2363,6 +3358,14 @@ class profile
 
         if (m_legacy || m_mode == mode::throughput)
           std::cout << "Average Throughput (op/s): " << throughput << "\n";
+
+        const auto& itr = m_report["cpu"]["iteration"];
+        std::cout << "Iteration min/p50/p99/max (us): "
+                  << itr["min"].get<double>() << "/" << itr["p50"].get<double>() << "/"
+                  << itr["p99"].get<double>() << "/" << itr["max"].get<double>() << "\n";
+        std::cout << "Average submit/wait (us): "
+                  << m_report["cpu"]["submit"]["mean"].get<double>() << "/"
+                  << m_report["cpu"]["wait"]["mean"].get<double>() << "\n";
       }
     }
 
@@ -2374,6 +3377,7 @@ class profile
       if (!m_legacy) {
         m_report["depth"] = m_depth;
         m_report["mode"] = to_string(m_mode);
+        m_report["pipeline"] = m_executor.pipelined();
         m_report["poll"] = m_poll;
       }
 
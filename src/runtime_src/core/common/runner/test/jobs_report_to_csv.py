@@ -15,12 +15,22 @@ import os
 import tkinter as tk
 from tkinter import messagebox
 
+# Latency distribution properties, see $defs/latency in schema
+LATENCY_STATS = ['min', 'mean', 'stddev', 'p50', 'p90', 'p99', 'p99.9', 'max']
+
 # Define the available properties (based on your schema)
+# Each property maps to the path of keys of the value in a job report
 PROPERTY_MAP = {
     'cpu_elapsed': ('cpu', 'elapsed'),
     'cpu_iterations': ('cpu', 'iterations'),
     'cpu_latency': ('cpu', 'latency'),
     'cpu_throughput': ('cpu', 'throughput'),
+    **{f'cpu_iteration_{s}': ('cpu', 'iteration', s) for s in LATENCY_STATS},
+    **{f'cpu_submit_{s}': ('cpu', 'submit', s) for s in ['mean', 'p99', 'max']},
+    **{f'cpu_wait_{s}': ('cpu', 'wait', s) for s in ['mean', 'p99', 'max']},
+    'openloop_rate': ('openloop', 'rate'),
+    'openloop_achieved_rate': ('openloop', 'achieved_rate'),
+    **{f'openloop_latency_{s}': ('openloop', 'latency', s) for s in LATENCY_STATS},
     'hwctx_columns': ('hwctx', 'columns'),
     'resources_buffers': ('resources', 'buffers'),
     'resources_kernels': ('resources', 'kernels'),
@@ -51,6 +61,25 @@ def select_properties_dialog(properties):
     selected = [prop for prop, var in vars.items() if var.get()]
     return selected
 
+def lookup(data, path):
+    for key in path:
+        if not isinstance(data, dict) or key not in data:
+            return ''
+        data = data[key]
+    return data
+
+# A job report with multiple executions has one row per execution,
+# where execution properties override the job properties.
+def job_rows(job_name, job_data):
+    executions = job_data.get('executions', [])
+    if not executions:
+        return [(job_name, job_data)]
+    rows = []
+    for execution in executions:
+        merged = {**job_data, **execution}
+        rows.append((f"{job_name}/{execution.get('name', len(rows))}", merged))
+    return rows
+
 def json_to_csv(json_file, csv_file, selected_props):
     with open(json_file, 'r') as f:
         data = json.load(f)
@@ -58,11 +87,11 @@ def json_to_csv(json_file, csv_file, selected_props):
     headers = ['job_name'] + selected_props
     rows = []
     for job_name, job_data in jobs.items():
-        row = {'job_name': job_name}
-        for prop in selected_props:
-            section, key = PROPERTY_MAP[prop]
-            row[prop] = job_data.get(section, {}).get(key, '')
-        rows.append(row)
+        for name, report in job_rows(job_name, job_data):
+            row = {'job_name': name}
+            for prop in selected_props:
+                row[prop] = lookup(report, PROPERTY_MAP[prop])
+            rows.append(row)
     with open(csv_file, 'w', newline='') as f:
         writer = csv.DictWriter(f, fieldnames=headers)
         writer.writeheader()
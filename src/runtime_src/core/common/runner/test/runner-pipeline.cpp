@@ -0,0 +1,206 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+// This test compares pipelined and sequential execution of a recipe
+// g++ -g -std=c++17
+//   -I/home/stsoe/git/stsoe/XRT/build/Debug/opt/xilinx/xrt/include
+//   -I/home/stsoe/git/stsoe/XRT/src/runtime_src
+//   -L/home/stsoe/git/stsoe/XRT/build/Debug/opt/xilinx/xrt/lib
+//   -o runner-pipeline.exe runner-pipeline.cpp -lxrt_coreutil -pthread
+//
+// or
+//
+// mkdir build
+// cd build
+// cmake -DXILINX_XRT=/home/stsoe/git/stsoe/XRT/build/Debug/opt/xilinx/xrt
+//       -DXRT_ROOT=/home/stsoe/git/stsoe/XRT ..
+// cmake --build . --config Debug
+//
+// ./runner-pipeline.exe --recipe ... --profile ... --output ... [--depth ...]
+//
+// The profile bindings create and initialize the buffers of the
+// recipe, the profile execution section is replaced by the test.  The
+// recipe is first executed in latency mode, then pipelined in
+// throughput mode, such that the last iteration runs in each lane of
+// the pipeline in turn.  The --output buffers, which are created by
+// the test rather than by the profile, must have the same content
+// after each pipelined execution as after the sequential execution.
+// The recipe must have both CPU and NPU runs to be pipelined.
+
+#include "xrt/xrt_bo.h"
+#include "xrt/xrt_device.h"
+#include "core/common/runner/runner.h"
+#include "core/common/json/nlohmann/json.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using json = nlohmann::json;
+
+static void
+usage()
+{
+  std::cout << "usage: runner-pipeline.exe [options]\n";
+  std::cout << " --recipe <recipe.json> recipe file to run\n";
+  std::cout << " --profile <profile.json> bindings of the recipe buffers\n";
+  std::cout << " --output <name> output buffer to compare, can be repeated\n";
+  std::cout << " [--dir <path>] directory containing artifacts (default: current dir)\n";
+  std::cout << " [--depth <n>] depth of pipeline, at least 2 (default: 2)\n";
+  std::cout << "\n\n";
+  std::cout << "runner-pipeline.exe --recipe recipe.json --profile profile.json --output ofm\n";
+}
+
+static json
+load_json(const std::string& path)
+{
+  std::ifstream f{path};
+  if (!f)
+    throw std::runtime_error("Failed to open " + path);
+
+  return json::parse(f);
+}
+
+// Remove the output bindings from the profile, the test binds its own
+// buffers, and record the size of each output.
+static std::map<std::string, size_t>
+take_outputs(json& profile, const std::vector<std::string>& outputs)
+{
+  std::map<std::string, size_t> sizes;
+  auto& bindings = profile.at("bindings");
+  for (const auto& name : outputs) {
+    auto itr = std::find_if(bindings.begin(), bindings.end(), [&name](const json& b) {
+      return b.at("name").get<std::string>() == name;
+    });
+    if (itr == bindings.end() || !itr->contains("size"))
+      throw std::runtime_error("No binding with size for output '" + name + "'");
+
+    sizes.emplace(name, itr->at("size").get<size_t>());
+    bindings.erase(itr);
+  }
+  return sizes;
+}
+
+// Execute the recipe per execution and return the content of outputs
+static std::map<std::string, std::vector<char>>
+run(const xrt::device& device, const std::string& recipe, json profile,
+    const json& execution, const std::map<std::string, size_t>& outputs,
+    const std::string& dir)
+{
+  profile.erase("executions");
+  profile["execution"] = execution;
+  xrt_core::runner runner {device, recipe, profile.dump(), dir};
+
+  std::map<std::string, xrt::bo> bos;
+  for (const auto& [name, size] : outputs) {
+    xrt::bo bo{device, size, xrt::bo::flags::host_only, 0};
+    std::memset(bo.map<char*>(), 0, size);
+    bo.sync(XCL_BO_SYNC_BO_TO_DEVICE);
+    runner.bind(name, bo);
+    bos.emplace(name, std::move(bo));
+  }
+
+  runner.execute();
+  runner.wait();
+
+  std::map<std::string, std::vector<char>> data;
+  for (auto& [name, bo] : bos) {
+    bo.sync(XCL_BO_SYNC_BO_FROM_DEVICE);
+    auto ptr = bo.map<char*>();
+    data.emplace(name, std::vector<char>(ptr, ptr + bo.size()));
+  }
+  return data;
+}
+
+static void
+run(const std::string& recipe, const std::string& profile,
+    const std::vector<std::string>& outputs, const std::string& dir, size_t depth)
+{
+  auto pj = load_json(profile);
+  auto sizes = take_outputs(pj, outputs);
+
+  xrt::device device{0};
+  for (size_t lane = 0; lane < depth; ++lane) {
+    // The last iteration of 2*depth + lane iterations runs in lane
+    auto iterations = 2 * depth + lane;
+    auto golden = run(device, recipe, pj, {{"iterations", iterations}, {"mode", "latency"}}, sizes, dir);
+    auto result = run(device, recipe, pj,
+                      {{"iterations", iterations}, {"mode", "throughput"},
+                       {"depth", depth}, {"pipeline", true}},
+                      sizes, dir);
+
+    for (const auto& [name, data] : golden) {
+      if (result.at(name) != data)
+        throw std::runtime_error("pipelined output '" + name + "' differs from sequential in lane "
+                                 + std::to_string(lane));
+    }
+    std::cout << "lane " << lane << ": " << iterations << " iterations, outputs match\n";
+  }
+}
+
+static void
+run(int argc, char* argv[])
+{
+  std::vector<std::string> args(argv+1,argv+argc);
+  std::string cur;
+  std::string recipe;
+  std::string profile;
+  std::vector<std::string> outputs;
+  std::string dir = ".";
+  size_t depth = 2;
+  for (auto& arg : args) {
+    if (arg == "-h") {
+      usage();
+      return;
+    }
+
+    if (arg[0] == '-') {
+      cur = arg;
+      continue;
+    }
+
+    if (cur == "--recipe")
+      recipe = arg;
+    else if (cur == "--profile")
+      profile = arg;
+    else if (cur == "--output")
+      outputs.push_back(arg);
+    else if (cur == "--dir")
+      dir = arg;
+    else if (cur == "--depth")
+      depth = std::stoul(arg);
+    else
+      throw std::runtime_error("Unknown option value " + cur + " " + arg);
+  }
+
+  if (recipe.empty() || profile.empty() || outputs.empty())
+    throw std::runtime_error("--recipe, --profile, and --output are required");
+
+  if (depth < 2)
+    throw std::runtime_error("--depth must be at least 2");
+
+  run(recipe, profile, outputs, dir, depth);
+}
+
+int
+main(int argc, char **argv)
+{
+  try {
+    run(argc, argv);
+    std::cout << "TEST PASSED\n";
+    return 0;
+  }
+  catch (const std::exception& ex) {
+    std::cerr << "TEST FAILED: " << ex.what() << '\n';
+  }
+  catch (...) {
+    std::cerr << "TEST FAILED\n";
+  }
+  return 1;
+}
@@ -1,5 +1,5 @@
 # SPDX-License-Identifier: Apache-2.0
-# Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+# Copyright (C) 2025-2026 Advanced Micro Devices, Inc. All rights reserved.
 #
 # pip install jsonschema
 import json
@@ -25,8 +25,10 @@ def validate_json(json_data, schema_data):
         print("JSON is valid against the schema.")
     except ValidationError as e:
         print(f"Validation Error: {e.message}")
+        exit(1)
     except SchemaError as e:
         print(f"Schema Error: {e.message}")
+        exit(1)
 
 def main():
     # Set up argument parser
@@ -0,0 +1,175 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+// This test measures execute() to wait() completion latency of a
+// recipe using the specified wait mode.
+// g++ -g -std=c++17
+//   -I/home/stsoe/git/stsoe/XRT/build/Debug/opt/xilinx/xrt/include
+//   -I/home/stsoe/git/stsoe/XRT/src/runtime_src
+//   -L/home/stsoe/git/stsoe/XRT/build/Debug/opt/xilinx/xrt/lib
+//   -o wait-latency.exe wait-latency.cpp -lxrt_coreutil -pthread
+//
+// ./wait-latency.exe --recipe ... [--dir ...] [-b name:path]*
+//                    [--iterations <n>] [--wait-mode block|hybrid]
+//
+// Compare the two wait modes by running the test twice.  The wait
+// mode is selected through xrt.ini Runtime.wait_mode, which is read
+// once per process.
+
+#include "xrt/xrt_device.h"
+#include "xrt/experimental/xrt_ext.h"
+#include "xrt/experimental/xrt_ini.h"
+#include "core/common/runner/runner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <string>
+#include <vector>
+
+static std::map<std::string, std::string> g_buffer2data;
+
+static void
+usage()
+{
+  std::cout << "usage: wait-latency.exe [options]\n";
+  std::cout << " --recipe <recipe.json> recipe file to run\n";
+  std::cout << " [--dir <path>] directory containing artifacts (default: current dir)\n";
+  std::cout << " [--buffer <key:path>] external buffer data, the key is referenced by recipe\n";
+  std::cout << " [--iterations <n>] number of execute/wait iterations (default: 1000)\n";
+  std::cout << " [--wait-mode <block|hybrid>] how to wait for completion (default: block)\n";
+}
+
+static std::vector<char>
+read_file(const std::string& fnm)
+{
+  std::ifstream ifs{fnm, std::ios::binary};
+  if (!ifs)
+    throw std::runtime_error("Failed to open file '" + fnm + "' for reading");
+
+  ifs.seekg(0, std::ios::end);
+  std::vector<char> data(ifs.tellg());
+  ifs.seekg(0, std::ios::beg);
+  ifs.read(data.data(), data.size());
+  return data;
+}
+
+static void
+report(const std::string& mode, std::vector<double>& lat)
+{
+  std::sort(lat.begin(), lat.end());
+  auto pct = [&lat](double p) { return lat[std::min(lat.size() - 1, static_cast<size_t>(p * lat.size()))]; };
+  auto avg = std::accumulate(lat.begin(), lat.end(), 0.0) / lat.size();
+  std::cout << "wait-mode: " << mode
+            << " iterations: " << lat.size()
+            << " avg(us): " << avg
+            << " min(us): " << lat.front()
+            << " p50(us): " << pct(0.50)
+            << " p99(us): " << pct(0.99)
+            << " max(us): " << lat.back()
+            << '\n';
+}
+
+static void
+run(const std::string& recipe, const std::string& dir, size_t iterations, const std::string& mode)
+{
+  xrt::ini::set("Runtime.wait_mode", mode);
+
+  xrt::device device{0};
+  xrt_core::runner runner {device, recipe, std::filesystem::path{dir}};
+
+  for (auto& [buffer, path] : g_buffer2data) {
+    auto data = read_file(path);
+    xrt::bo bo = xrt::ext::bo{device, data.size()};
+    auto bo_data = bo.map<char*>();
+    std::copy(data.data(), data.data() + data.size(), bo_data);
+    bo.sync(XCL_BO_SYNC_BO_TO_DEVICE);
+    runner.bind(buffer, bo);
+  }
+
+  // Warm up, also lets hybrid wait observe completion times
+  for (size_t i = 0; i < std::min<size_t>(iterations, 100); ++i) {
+    runner.execute();
+    runner.wait();
+  }
+
+  std::vector<double> latency(iterations);
+  for (size_t i = 0; i < iterations; ++i) {
+    auto start = std::chrono::high_resolution_clock::now();
+    runner.execute();
+    runner.wait();
+    auto end = std::chrono::high_resolution_clock::now();
+    latency[i] = std::chrono::duration<double, std::micro>(end - start).count();
+  }
+
+  report(mode, latency);
+}
+
+static void
+run(int argc, char* argv[])
+{
+  std::vector<std::string> args(argv+1,argv+argc);
+  std::string cur;
+  std::string recipe;
+  std::string dir = ".";
+  std::string mode = "block";
+  size_t iterations = 1000;
+  for (auto& arg : args) {
+    if (arg == "-h") {
+      usage();
+      return;
+    }
+
+    if (arg[0] == '-') {
+      cur = arg;
+      continue;
+    }
+
+    if (cur == "--recipe")
+      recipe = arg;
+    else if (cur == "--dir")
+      dir = arg;
+    else if (cur == "--iterations")
+      iterations = std::stoul(arg);
+    else if (cur == "--wait-mode")
+      mode = arg;
+    else if (cur == "--buffer" || cur == "-b") {
+      auto pos = arg.find(":");
+      if (pos == std::string::npos)
+        throw std::runtime_error("buffer data option must take the form of '-buffer buffer:path'");
+
+      g_buffer2data.emplace(arg.substr(0, pos), arg.substr(pos + 1));
+    }
+    else
+      throw std::runtime_error("Unknown option value " + cur + " " + arg);
+  }
+
+  if (recipe.empty() || iterations == 0) {
+    usage();
+    return;
+  }
+
+  run(recipe, dir, iterations, mode);
+}
+
+int
+main(int argc, char **argv)
+{
+  try {
+    run(argc, argv);
+    return 0;
+  }
+  catch (const std::exception& ex) {
+    std::cerr << "Error: " << ex.what() << '\n';
+  }
+  catch (...) {
+    std::cerr << "Unknown error\n";
+  }
+  return 1;
+
+}
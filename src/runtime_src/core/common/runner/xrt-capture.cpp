@@ -21,6 +21,8 @@
 // Options:
 //   --frames <num>       Number of frames to capture (required)
 //   --output-dir <path>  Output directory for capture artifacts (default: ./xrt_capture)
+//   --mode <full|chunked> Buffer capture mode (default: full)
+//   --pack               Write artifacts to a single pack file
 //   --help, -h           Show help message
 
 namespace {
@@ -29,6 +31,8 @@ struct capture_options
 {
   uint32_t frames = 0;
   std::filesystem::path output_dir = "./xrt_capture";
+  std::string mode = "full";
+  bool pack = false;
   std::vector<std::string> app_args;
 };
 
@@ -40,6 +44,9 @@ usage()
   std::cout << "Options:\n";
   std::cout << "  --frames <num>       Number of frames to capture (required)\n";
   std::cout << "  --output-dir <path>  Output directory for artifacts (default: ./xrt_capture)\n";
+  std::cout << "  --mode <full|chunked> Buffer capture mode (default: full)\n";
+  std::cout << "                       chunked dumps only changed regions of buffers\n";
+  std::cout << "  --pack               Write artifacts to a single pack file (artifacts.pack)\n";
   std::cout << "  --help, -h           Show this help message\n\n";
   std::cout << "Examples:\n";
   std::cout << "  # Capture 10 frames from application\n";
@@ -81,6 +88,16 @@ parse_args(int argc, char* argv[])
         throw std::runtime_error("--output-dir requires an argument");
       opts.output_dir = args[++i];
     }
+    else if (arg == "--mode") {
+      if (i + 1 >= args.size())
+        throw std::runtime_error("--mode requires an argument");
+      opts.mode = args[++i];
+      if (opts.mode != "full" && opts.mode != "chunked")
+        throw std::runtime_error("--mode must be 'full' or 'chunked'");
+    }
+    else if (arg == "--pack") {
+      opts.pack = true;
+    }
     else {
       throw std::runtime_error("Unknown option: " + arg);
     }
@@ -111,15 +128,21 @@ setup_capture_environment(const capture_options& opts)
   std::cout << "Configuring capture via environment...\n";
   std::cout << "  Runtime.capture_frames=" << opts.frames << "\n";
   std::cout << "  Runtime.capture_output_dir=" << opts.output_dir.string() << "\n";
+  std::cout << "  Runtime.capture_mode=" << opts.mode << "\n";
+  std::cout << "  Runtime.capture_format=" << (opts.pack ? "pack" : "files") << "\n";
 
   // Set environment variables using the same key format as xrt.ini
   // The config reader will check these before reading xrt.ini
 #ifdef _WIN32
   _putenv_s("Runtime.capture_frames", std::to_string(opts.frames).c_str());
   _putenv_s("Runtime.capture_output_dir", opts.output_dir.string().c_str());
+  _putenv_s("Runtime.capture_mode", opts.mode.c_str());
+  _putenv_s("Runtime.capture_format", opts.pack ? "pack" : "files");
 #else
   setenv("Runtime.capture_frames", std::to_string(opts.frames).c_str(), 1);  // NOLINT
   setenv("Runtime.capture_output_dir", opts.output_dir.string().c_str(), 1); // NOLINT
+  setenv("Runtime.capture_mode", opts.mode.c_str(), 1);                      // NOLINT
+  setenv("Runtime.capture_format", opts.pack ? "pack" : "files", 1);         // NOLINT
 #endif
 }
 
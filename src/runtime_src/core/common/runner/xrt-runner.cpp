@@ -22,6 +22,9 @@
 //           "recipe":  "<path>/recipe.json"
 //           "profile": "<path>/profile.json"
 //           "dir":     "<path> artifacts referenced by recipe and profile"
+//           "mode":    "<mode> optional, execute only specified mode"
+//           "rate":    <req/s> optional, override rate of openloop executions
+//           "duration": <ms>   optional, override duration of openloop executions
 //         }
 //         ...
 //       ]
@@ -32,6 +35,10 @@
 //     (2) creates worker threads, default to number of jobs
 //     (3) executes the specified jobs on first available worker
 //    All runner.json specified paths are prefixed with value of --dir option
+//
+//    Several openloop jobs can share one device to mix traffic at
+//    different rates, e.g. two jobs with "mode": "openloop" and
+//    different "rate" values run concurrently on separate workers.
 
 #include "xrt/xrt_device.h"
 #include "xrt/experimental/xrt_ini.h"
@@ -156,6 +163,26 @@ touchup_iterations(json& profile, uint32_t iterations)
     exec["iterations"] = iterations;
 }
 
+// Touch up openloop execution(s) with job specified rate and duration
+static void
+touchup_openloop(json& profile, const json& job)
+{
+  auto touchup = [&job](json& exec) {
+    if (exec.value("mode", "") != "openloop")
+      return;
+
+    for (const auto* key : {"rate", "duration"})
+      if (job.contains(key))
+        exec[key] = job[key];
+  };
+
+  if (profile.contains("execution"))
+    touchup(profile["execution"]);
+
+  for (auto& exec : profile["executions"])
+    touchup(exec);
+}
+
 // Disable specified key bool value globally
 static void
 touchup_kv(json& j, const std::string& key, bool value)
@@ -178,7 +205,8 @@ touchup_kv(json& j, const std::string& key, bool value)
 // Touch up profiles(s)
 // Return parsed / modified json as a json string
 static std::string
-touchup_profile_mt(const std::string& profile, const std::string& mode, uint32_t iterations)
+touchup_profile_mt(const std::string& profile, const std::string& mode, uint32_t iterations,
+                   const json& job = json::object())
 {
   // disable xrt::runner profile verbosity which is unsynchronized
   // with threaded execution
@@ -191,6 +219,7 @@ touchup_profile_mt(const std::string& profile, const std::string& mode, uint32_t
 
   filter_mode(json, mode);
   touchup_iterations(json, iterations);
+  touchup_openloop(json, job);
 
   if (g_nommap)
     touchup_kv(json, "mmap", false);
@@ -504,7 +533,7 @@ struct script_runner
     sfs::path profile = root / job["profile"];
     auto iterations = job.value<uint32_t>("iterations", g_iterations);
     auto mode = job.value<std::string>("mode", g_mode);
-    auto profile_json_string = touchup_profile_mt(profile.string(), mode, iterations);
+    auto profile_json_string = touchup_profile_mt(profile.string(), mode, iterations, job);
     sfs::path dir = root / job["dir"];
     return {device, std::move(id), recipe_json_string, profile_json_string, dir.string()};
   }
@@ -578,7 +607,7 @@ usage()
   std::cout << " [--threads <number>] number of threads to use when running script (default: #jobs)\n";
   std::cout << " [--queue-limit <number>] max jobs in job queue running script (default: threads or jobs)\n";
   std::cout << " [--dir <path>] directory containing artifacts (default: current dir)\n";
-  std::cout << " [--mode <latency|throughput|validate>] execute only specified mode (default: all)\n";
+  std::cout << " [--mode <latency|throughput|validate|openloop>] execute only specified mode (default: all)\n";
   std::cout << " [--verbose <val>] set XRT verbosity level to specified value (default: 0)\n";
   std::cout << " [--nommap] disable mmap of buffers (default: profile.json)\n";
   std::cout << " [--progress] show progress (same as --verbose 6)\n";
@@ -594,7 +623,7 @@ usage()
   std::cout << "Note, [--iterations <num>] overrides iterations in profile.json, but not in runner script.\n";
   std::cout << "If the runner script specifies iterations for a recipe/profile pair, then this value is\n";
   std::cout << "sticky for that recipe/profile pair.\n\n";
-  std::cout << "Note, [--mode <latency|throughput|validate>] filters execution sections in profile.json such\n";
+  std::cout << "Note, [--mode <latency|throughput|validate|openloop>] filters execution sections in profile.json such\n";
   std::cout << "only specified modes are executed. If the runner script specifies a mode for a recipe/profile\n";
   std::cout << "pair, then this value is sticky for that recipe/profile pair.\n\n";
   std::cout << "Note, [--replay <script>] is mutually exclusive with --recipe, --profile, --script\n";
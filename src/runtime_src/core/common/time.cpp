@@ -48,7 +48,15 @@ time_ns()
 std::string
 timestamp()
 {
-  auto time = std::chrono::system_clock::now();
+  return timestamp(std::chrono::system_clock::now());
+}
+
+/**
+ * @return formatted timestamp of time
+ */
+std::string
+timestamp(const std::chrono::system_clock::time_point& time)
+{
   auto tm = get_gmtime(std::chrono::system_clock::to_time_t(time));
   char buf[64] = {0};
   return std::strftime(buf, sizeof(buf), "%c GMT", &tm)
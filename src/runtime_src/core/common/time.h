@@ -1,10 +1,11 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright (C) 2016-2017 Xilinx, Inc. All rights reserved.
-// Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (C) 2025-2026 Advanced Micro Devices, Inc. All rights reserved.
 #ifndef xrtcore_util_time_h_
 #define xrtcore_util_time_h_
 
 #include "core/common/config.h"
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -27,6 +28,14 @@ XRT_CORE_COMMON_EXPORT
 std::string
 timestamp();
 
+/**
+ * @return formatted timestamp of a point in time, same format
+ *   as timestamp()
+ */
+XRT_CORE_COMMON_EXPORT
+std::string
+timestamp(const std::chrono::system_clock::time_point& time);
+
 /**
  * @return timestamp for epoch
  */
@@ -20,6 +20,7 @@
 #include <atomic>
 #include <boost/property_tree/json_parser.hpp>
 #include <boost/property_tree/ptree.hpp>
+#include <deque>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
@@ -36,7 +37,7 @@ static std::atomic<uint32_t> thread_count {0};
 
 template <typename MetType, typename FindType>
 static MetType*
-get_metrics(std::vector<MetType>& metrics_vec, const FindType& finder)
+get_metrics(std::deque<MetType>& metrics_vec, const FindType& finder)
 {
   auto it = std::find_if(metrics_vec.begin(), metrics_vec.end(), 
                         [finder](const auto& met) 
@@ -58,43 +59,15 @@ struct bo_metrics
   size_t   bytes_synced_from_device = 0;
 };
 
+// Metrics are stored in deques such that run objects can cache
+// pointers to kernel run counters while more contexts and kernels
+// are logged.
 struct kernel_metrics
 {
-  using tp = std::chrono::time_point<std::chrono::high_resolution_clock>;
-  struct timestamp
-  {
-    tp start_time;
-    bool is_valid = false;
-  };
-
   std::string handle; // kernel name is used as handle for identifying kernel
   std::vector<uint32_t> cu_index_vec;
-  uint32_t total_runs = 0;
-  std::chrono::microseconds total_time = {};
-  std::unordered_map<const xrt::run_impl*, timestamp> exec_times; // run handle ptr is used for indexing
+  xrt_core::usage_metrics::kernel_run_counters runs;
   size_t num_args = 0;
-
-  void
-  log_kernel_exec_time(const xrt::run_impl* run_hdl, const tp& tp_now, ert_cmd_state state)
-  {
-    // state ERT_CMD_STATE_NEW indicates kernel start is called
-    if (state == ERT_CMD_STATE_NEW) {
-      // record start everytime because previous run may be finished, timeout, aborted or stopped
-      exec_times[run_hdl].start_time = tp_now;
-      exec_times[run_hdl].is_valid = true;
-    }
-    else {
-      // make start time invalid so we can record for next run, add duration to total time and increment total runs
-      if (exec_times[run_hdl].is_valid && state == ERT_CMD_STATE_COMPLETED) {
-        // valid run increament run
-        total_runs++;
-        total_time += std::chrono::duration_cast<std::chrono::microseconds>(tp_now - exec_times[run_hdl].start_time);
-
-        // invalidate start time, run may be finished, aborted or timed out
-        exec_times[run_hdl].is_valid = false;
-      }
-    }
-  }
 };
 
 struct hw_ctx_metrics
@@ -102,15 +75,14 @@ struct hw_ctx_metrics
   const xrt_core::hwctx_handle* handle;  // using hw_ctx handle ptr as unique identifier for logging
   xrt::uuid xclbin_uuid;
   bo_metrics bos_met;
-  std::vector<kernel_metrics> kernel_metrics_vec;
+  std::deque<kernel_metrics> kernel_metrics_vec;
 
   void
   log_kernel(const std::string& name, size_t args)
   {
-    kernel_metrics k;
+    auto& k = kernel_metrics_vec.emplace_back();
     k.handle = name;
     k.num_args = args;
-    kernel_metrics_vec.emplace_back(k);
   }
 };
 
@@ -120,7 +92,7 @@ struct device_metrics
   bo_metrics global_bos_met;
   uint32_t bo_active_count = 0;
   uint32_t bo_peak_count = 0;
-  std::vector<hw_ctx_metrics> hw_ctx_vec;
+  std::deque<hw_ctx_metrics> hw_ctx_vec;
 
   void
   log_hw_ctx(const xrt_core::hwctx_handle* handle, const xrt::uuid& uuid)
@@ -212,18 +184,20 @@ get_bos_ptree(const bo_metrics& bo_met)
 }
 
 static bpt::ptree
-get_kernels_ptree(const std::vector<kernel_metrics>& kernels_vec)
+get_kernels_ptree(const std::deque<kernel_metrics>& kernels_vec)
 {
   bpt::ptree kernel_array;
 
   for (const auto& kernel : kernels_vec) {
     bpt::ptree kernel_tree;
+    auto total_runs = kernel.runs.total_runs.load();
+    auto total_time_us = kernel.runs.total_time_ns.load() / 1000;
 
     kernel_tree.put("name", kernel.handle);
     kernel_tree.put("num_of_args", kernel.num_args);
-    kernel_tree.put("num_total_runs", std::to_string(kernel.total_runs));
+    kernel_tree.put("num_total_runs", std::to_string(total_runs));
 
-    auto avg_run_time = (kernel.total_runs > 0) ? (kernel.total_time.count() / kernel.total_runs) : 0;
+    auto avg_run_time = (total_runs > 0) ? (total_time_us / total_runs) : 0;
     kernel_tree.put("avg_run_time", std::to_string(avg_run_time) + " us");
 
     kernel_array.push_back(std::make_pair("", kernel_tree));
@@ -233,7 +207,7 @@ get_kernels_ptree(const std::vector<kernel_metrics>& kernels_vec)
 }
 
 static bpt::ptree
-get_hw_ctx_ptree(const std::vector<hw_ctx_metrics>& hw_ctx_vec)
+get_hw_ctx_ptree(const std::deque<hw_ctx_metrics>& hw_ctx_vec)
 {
   bpt::ptree hw_ctx_array;
 
@@ -319,8 +293,8 @@ public:
   void
   log_kernel_info(const xrt_core::device*, const xrt::hw_context&, const std::string&, size_t) override;
 
-  void
-  log_kernel_run_info(const xrt::kernel_impl*, const xrt::run_impl*, ert_cmd_state) override;
+  xrt_core::usage_metrics::kernel_run_counters*
+  get_kernel_run_counters(const xrt::kernel_impl*) override;
 
 private:
   device_metrics_map m_dev_map;
@@ -469,12 +443,10 @@ log_kernel_info(const xrt_core::device* dev, const xrt::hw_context& ctx, const s
   }
 }
 
-void
+xrt_core::usage_metrics::kernel_run_counters*
 usage_metrics_logger::
-log_kernel_run_info(const xrt::kernel_impl* krnl_impl, const xrt::run_impl* run_hdl, ert_cmd_state state)
+get_kernel_run_counters(const xrt::kernel_impl* krnl_impl)
 {
-  // collecting time at start of call as next calls will be overhead
-  auto ts_now = std::chrono::high_resolution_clock::now();
   try {
     auto kernel =
         xrt_core::kernel_int::get_kernel_from_impl(krnl_impl);
@@ -487,21 +459,22 @@ log_kernel_run_info(const xrt::kernel_impl* krnl_impl, const xrt::run_impl* run_
 
     auto dev_metrics = get_device_metrics(m_dev_map, dev_id);
     if (!dev_metrics)
-      return;
+      return nullptr;
 
     auto hw_ctx_met = get_metrics(dev_metrics->hw_ctx_vec, hwctx_handle);
     // dont log if hw ctx didn't match existing ones
     if (!hw_ctx_met)
-      return;
+      return nullptr;
   
     auto kernel_met = get_metrics(hw_ctx_met->kernel_metrics_vec, name);
     if (!kernel_met)
-      return;
+      return nullptr;
 
-    kernel_met->log_kernel_exec_time(run_hdl, ts_now, state);
+    return &kernel_met->runs;
   }
   catch(...) {
     // dont log anything
+    return nullptr;
   }
 }
 
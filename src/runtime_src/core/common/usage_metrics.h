@@ -3,6 +3,8 @@
 #ifndef XRT_CORE_USAGE_METRICS_H
 #define XRT_CORE_USAGE_METRICS_H
 
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <cstdint>
 #include <string>
@@ -35,6 +37,23 @@ using device_id = unsigned int;
 ////////////////////////////////////////////////////////////////
 namespace xrt_core::usage_metrics {
 
+// struct kernel_run_counters - Run counters of one kernel
+//
+// Owned by the logger and stable for its lifetime.  Updated lock
+// free since runs can start and complete on any thread.
+struct kernel_run_counters
+{
+  std::atomic<uint64_t> total_runs {0};
+  std::atomic<uint64_t> total_time_ns {0};
+
+  void
+  record(std::chrono::nanoseconds duration)
+  {
+    total_runs.fetch_add(1, std::memory_order_relaxed);
+    total_time_ns.fetch_add(duration.count(), std::memory_order_relaxed);
+  }
+};
+
 // class base_logger - class with no op calls
 //
 // when user doesn't set ini option logging should be no op
@@ -59,8 +78,60 @@ public:
   virtual void
   log_kernel_info(const xrt_core::device*, const xrt::hw_context&, const std::string&, size_t) {}
 
-  virtual void
-  log_kernel_run_info(const xrt::kernel_impl*, const xrt::run_impl*, ert_cmd_state) {}
+  // get_kernel_run_counters() - Counters for runs of a kernel
+  //
+  // Returns nullptr if logging is disabled or the kernel is not
+  // logged.  This is a lookup, callers are expected to cache the
+  // result, see class run_metrics.
+  virtual kernel_run_counters*
+  get_kernel_run_counters(const xrt::kernel_impl*) { return nullptr; }
+};
+
+// class run_metrics - Usage metrics of one run object
+//
+// Kernel runs are logged in the critical path of starting a run.
+// The kernel's counters are looked up on first start and cached,
+// after which a start records a timestamp and a completion adds
+// the duration to the counters.  Nothing is recorded if logging is
+// disabled.
+class run_metrics
+{
+  using clock = std::chrono::steady_clock;
+  kernel_run_counters* m_counters = nullptr;
+  clock::time_point m_start;
+  bool m_resolved = false;
+  bool m_started = false;
+
+public:
+  void
+  start(base_logger* logger, const xrt::kernel_impl* kernel)
+  {
+    if (!m_resolved) {
+      m_counters = logger->get_kernel_run_counters(kernel);
+      m_resolved = true;
+    }
+
+    if (!m_counters)
+      return;
+
+    // record start everytime because previous run may be finished,
+    // timeout, aborted or stopped
+    m_start = clock::now();
+    m_started = true;
+  }
+
+  // complete() - Record duration of a successfully completed run
+  void
+  complete()
+  {
+    // count a started run once, completion can be observed more
+    // than once when waiting repeatedly
+    if (!m_started)
+      return;
+
+    m_counters->record(clock::now() - m_start);
+    m_started = false;
+  }
 };
 
 // get_usage_metrics_logger() - Return logger object for current thread
@@ -6,10 +6,15 @@
 
 #include "config_reader.h"
 #include "error.h"
+#include "message.h"
 #include "utils.h"
 
 #include <algorithm>
+#include <filesystem>
+#include <fstream>
 #include <map>
+#include <mutex>
+#include <optional>
 #include <regex>
 #include <cstring>
 #include <cstdlib>
@@ -429,6 +434,367 @@ merge_args(std::vector<xrt_core::xclbin::kernel_argument>& args)
 }
 
 
+
+// Argument meta data of a kernel xml entry
+static std::vector<xrt_core::xclbin::kernel_argument>
+parse_kernel_arguments(const pt::ptree& xml_kernel)
+{
+  using kernel_argument = xrt_core::xclbin::kernel_argument;
+  std::vector<kernel_argument> args;
+
+  auto pwmap = get_portname_width_map(xml_kernel);
+
+  for (auto& xml_arg : xml_kernel) {
+    if (xml_arg.first != "arg")
+      continue;
+
+    std::string id = xml_arg.second.get<std::string>("<xmlattr>.id");
+    size_t index = id.empty() ? kernel_argument::no_index : convert(id);
+
+    std::string port = xml_arg.second.get<std::string>("<xmlattr>.port", "no-port");
+    auto itr = pwmap.find(port);
+    size_t pwidth = (itr != pwmap.end()) ? (*itr).second : 0;
+
+    args.emplace_back(kernel_argument{
+        xml_arg.second.get<std::string>("<xmlattr>.name")
+       ,xml_arg.second.get<std::string>("<xmlattr>.type", "no-type")
+       ,std::move(port)
+       ,pwidth
+       ,index
+       ,convert(xml_arg.second.get<std::string>("<xmlattr>.offset"))
+       ,convert(xml_arg.second.get<std::string>("<xmlattr>.size"))
+       ,convert(xml_arg.second.get<std::string>("<xmlattr>.hostSize"))
+       ,0  // fa_desc_offset post computed if necessary
+       ,kernel_argument::argtype(xml_arg.second.get<size_t>("<xmlattr>.addressQualifier"))
+       ,kernel_argument::direction(kernel_argument::direction::input)
+    });
+  }
+
+  // stable sort to preserve order of multi-component arguments
+  // for example global_size, local_size, etc.
+  std::stable_sort(args.begin(), args.end(), [](auto& a1, auto& a2) { return a1.index < a2.index; });
+
+  // merge args with same index
+  merge_args(args);
+
+  return args;
+}
+
+// Properties of a kernel xml entry as specified in the xml
+static xrt_core::xclbin::kernel_properties
+parse_kernel_properties(const pt::ptree& xml_kernel, const std::string& kname)
+{
+  auto mailbox = convert_to_mailbox_type(xml_kernel.get<std::string>("<xmlattr>.mailbox", "none"));
+  auto restart = convert(xml_kernel.get<std::string>("<xmlattr>.countedAutoRestart", "0"));
+  auto sw_reset = to_bool(xml_kernel.get<std::string>("<xmlattr>.swReset", "false"));
+  auto functional = get_functional(xml_kernel, "extended-data");
+  auto kernel_id = get_kernel_id(xml_kernel, "extended-data");
+
+  return xrt_core::xclbin::kernel_properties
+    { kname
+    , to_kernel_type(xml_kernel.get<std::string>("<xmlattr>.type", "pl"))
+    , restart
+    , mailbox
+    , get_address_range(xml_kernel)
+    , sw_reset
+    , functional
+    , kernel_id
+
+    , convert(xml_kernel.get<std::string>("<xmlattr>.workGroupSize", "0"))
+    , get_xyz(xml_kernel, "compileWorkGroupSize")
+    , get_xyz(xml_kernel, "maxWorkGroupSize")
+    , get_stringtable(xml_kernel) };
+}
+
+// Amend kernel properties with xrt.ini overrides of features
+// not specified in the xml
+static void
+amend_kernel_properties(xrt_core::xclbin::kernel_properties& props)
+{
+  if (props.mailbox == xrt_core::xclbin::kernel_properties::mailbox_type::none)
+    props.mailbox = get_mailbox_from_ini(props.name);
+  if (props.counted_auto_restart == 0)
+    props.counted_auto_restart = get_restart_from_ini(props.name);
+  if (!props.sw_reset)
+    props.sw_reset = get_sw_reset_from_ini(props.name);
+}
+
+static pt::ptree
+read_xml(const char* xml_data, size_t xml_size)
+{
+  pt::ptree xml_project;
+  std::stringstream xml_stream;
+  xml_stream.write(xml_data,xml_size);
+  pt::read_xml(xml_stream,xml_project);
+  return xml_project;
+}
+
+// Meta data of all kernels in one pass over the xml, kernel
+// properties are not amended with xrt.ini overrides
+static xrt_core::xclbin::xml_metadata
+parse_xml_metadata(const char* xml_data, size_t xml_size)
+{
+  auto xml_project = read_xml(xml_data, xml_size);
+
+  xrt_core::xclbin::xml_metadata md;
+  md.project_name = xml_project.get<std::string>("project.<xmlattr>.name","");
+  md.fpga_device_name = xml_project.get<std::string>("project.platform.device.<xmlattr>.fpgaDevice","");
+
+  for (auto& xml_kernel : xml_project.get_child("project.platform.device.core")) {
+    if (xml_kernel.first != "kernel")
+      continue;
+
+    auto kname = xml_kernel.second.get<std::string>("<xmlattr>.name");
+    md.kernels.push_back({parse_kernel_properties(xml_kernel.second, kname),
+                          parse_kernel_arguments(xml_kernel.second)});
+  }
+
+  return md;
+}
+
+// On-disk cache of parsed xml meta data
+//
+// A cache file is named by xclbin uuid and FNV-1a hash of the xml
+// meta data and stores the meta data in a compact binary form.  The
+// header repeats the hash and xml size, a mismatch or any read error
+// is treated as a cache miss.  Files are written to a temporary file
+// and renamed such that concurrent processes never see a partial
+// file.  Bump format_version when kernel_properties or
+// kernel_argument change.
+namespace metadata_cache {
+
+constexpr uint64_t format_magic = 0x314d444d4c4d5458;  // "XTMLMDM1"
+constexpr uint32_t format_version = 1;
+
+static uint64_t
+fnv1a(const char* data, size_t size)
+{
+  uint64_t hash = 0xcbf29ce484222325;
+  for (size_t idx = 0; idx < size; ++idx) {
+    hash ^= static_cast<unsigned char>(data[idx]);
+    hash *= 0x100000001b3;
+  }
+  return hash;
+}
+
+class writer
+{
+  std::string m_buf;
+
+public:
+  void
+  put(uint64_t value)
+  {
+    m_buf.append(reinterpret_cast<const char*>(&value), sizeof(value));
+  }
+
+  void
+  put(const std::string& str)
+  {
+    put(str.size());
+    m_buf.append(str);
+  }
+
+  const std::string&
+  data() const
+  {
+    return m_buf;
+  }
+};
+
+class reader
+{
+  const std::string& m_buf;
+  size_t m_pos = 0;
+
+public:
+  explicit
+  reader(const std::string& buf)
+    : m_buf(buf)
+  {}
+
+  uint64_t
+  get()
+  {
+    uint64_t value = 0;
+    if (m_buf.size() - m_pos < sizeof(value))
+      throw std::runtime_error("truncated");
+    std::memcpy(&value, m_buf.data() + m_pos, sizeof(value));
+    m_pos += sizeof(value);
+    return value;
+  }
+
+  std::string
+  get_string()
+  {
+    auto size = get();
+    if (m_buf.size() - m_pos < size)
+      throw std::runtime_error("truncated");
+    std::string str = m_buf.substr(m_pos, size);
+    m_pos += size;
+    return str;
+  }
+
+  bool
+  done() const
+  {
+    return m_pos == m_buf.size();
+  }
+};
+
+static std::string
+serialize(const xrt_core::xclbin::xml_metadata& md, uint64_t hash, size_t xml_size)
+{
+  writer w;
+  w.put(format_magic);
+  w.put(format_version);
+  w.put(hash);
+  w.put(xml_size);
+  w.put(md.project_name);
+  w.put(md.fpga_device_name);
+  w.put(md.kernels.size());
+  for (auto& kernel : md.kernels) {
+    auto& p = kernel.properties;
+    w.put(p.name);
+    w.put(static_cast<uint64_t>(p.type));
+    w.put(p.counted_auto_restart);
+    w.put(static_cast<uint64_t>(p.mailbox));
+    w.put(p.address_range);
+    w.put(p.sw_reset);
+    w.put(p.functional);
+    w.put(p.kernel_id);
+    w.put(p.workgroupsize);
+    for (auto v : p.compileworkgroupsize)
+      w.put(v);
+    for (auto v : p.maxworkgroupsize)
+      w.put(v);
+    w.put(p.stringtable.size());
+    for (auto& [id, str] : p.stringtable) {
+      w.put(id);
+      w.put(str);
+    }
+
+    w.put(kernel.args.size());
+    for (auto& a : kernel.args) {
+      w.put(a.name);
+      w.put(a.hosttype);
+      w.put(a.port);
+      w.put(a.port_width);
+      w.put(a.index);
+      w.put(a.offset);
+      w.put(a.size);
+      w.put(a.hostsize);
+      w.put(a.fa_desc_offset);
+      w.put(static_cast<uint64_t>(a.type));
+      w.put(static_cast<uint64_t>(a.dir));
+    }
+  }
+  return w.data();
+}
+
+static xrt_core::xclbin::xml_metadata
+deserialize(const std::string& buf, uint64_t hash, size_t xml_size)
+{
+  using kernel_properties = xrt_core::xclbin::kernel_properties;
+  using kernel_argument = xrt_core::xclbin::kernel_argument;
+
+  reader r(buf);
+  if (r.get() != format_magic || r.get() != format_version || r.get() != hash || r.get() != xml_size)
+    throw std::runtime_error("mismatch");
+
+  xrt_core::xclbin::xml_metadata md;
+  md.project_name = r.get_string();
+  md.fpga_device_name = r.get_string();
+  auto num_kernels = r.get();
+  for (uint64_t k = 0; k < num_kernels; ++k) {
+    xrt_core::xclbin::xml_metadata::kernel kernel;
+    auto& p = kernel.properties;
+    p.name = r.get_string();
+    p.type = static_cast<kernel_properties::kernel_type>(r.get());
+    p.counted_auto_restart = r.get();
+    p.mailbox = static_cast<kernel_properties::mailbox_type>(r.get());
+    p.address_range = r.get();
+    p.sw_reset = r.get() != 0;
+    p.functional = r.get();
+    p.kernel_id = r.get();
+    p.workgroupsize = r.get();
+    for (auto& v : p.compileworkgroupsize)
+      v = r.get();
+    for (auto& v : p.maxworkgroupsize)
+      v = r.get();
+    auto num_strings = r.get();
+    for (uint64_t s = 0; s < num_strings; ++s) {
+      auto id = static_cast<uint32_t>(r.get());
+      p.stringtable.emplace(id, r.get_string());
+    }
+
+    auto num_args = r.get();
+    for (uint64_t a = 0; a < num_args; ++a) {
+      kernel_argument arg;
+      arg.name = r.get_string();
+      arg.hosttype = r.get_string();
+      arg.port = r.get_string();
+      arg.port_width = r.get();
+      arg.index = r.get();
+      arg.offset = r.get();
+      arg.size = r.get();
+      arg.hostsize = r.get();
+      arg.fa_desc_offset = r.get();
+      arg.type = static_cast<kernel_argument::argtype>(r.get());
+      arg.dir = static_cast<kernel_argument::direction>(r.get());
+      kernel.args.push_back(std::move(arg));
+    }
+    md.kernels.push_back(std::move(kernel));
+  }
+
+  if (!r.done())
+    throw std::runtime_error("trailing data");
+
+  return md;
+}
+
+static std::optional<xrt_core::xclbin::xml_metadata>
+load(const std::filesystem::path& path, uint64_t hash, size_t xml_size)
+{
+  std::ifstream ifs(path, std::ios::binary);
+  if (!ifs)
+    return std::nullopt;
+
+  try {
+    std::string buf{std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>()};
+    return deserialize(buf, hash, xml_size);
+  }
+  catch (const std::exception& ex) {
+    xrt_core::message::send(xrt_core::message::severity_level::debug, "XRT",
+                            "Ignoring xclbin meta data cache '" + path.string() + "': " + ex.what());
+    return std::nullopt;
+  }
+}
+
+static void
+store(const std::filesystem::path& path, const std::string& data)
+{
+  std::error_code ec;
+  std::filesystem::create_directories(path.parent_path(), ec);
+  auto tmp = path;
+  tmp += "." + std::to_string(xrt_core::utils::get_pid()) + ".tmp";
+  {
+    std::ofstream ofs(tmp, std::ios::binary | std::ios::trunc);
+    ofs.write(data.data(), data.size());
+    if (!ofs) {
+      xrt_core::message::send(xrt_core::message::severity_level::debug, "XRT",
+                              "Failed to write xclbin meta data cache '" + tmp.string() + "'");
+      std::filesystem::remove(tmp, ec);
+      return;
+    }
+  }
+  std::filesystem::rename(tmp, path, ec);
+  if (ec)
+    std::filesystem::remove(tmp, ec);
+}
+
+} // metadata_cache
+
 } // namespace
 
 namespace xrt_core { namespace xclbin {
@@ -1044,12 +1410,7 @@ get_kernel_freq(const axlf* top)
 std::vector<kernel_argument>
 get_kernel_arguments(const char* xml_data, size_t xml_size, const std::string& kname)
 {
-  std::vector<kernel_argument> args;
-
-  pt::ptree xml_project;
-  std::stringstream xml_stream;
-  xml_stream.write(xml_data,xml_size);
-  pt::read_xml(xml_stream,xml_project);
+  auto xml_project = read_xml(xml_data, xml_size);
 
   for (auto& xml_kernel : xml_project.get_child("project.platform.device.core")) {
     if (xml_kernel.first != "kernel")
@@ -1057,44 +1418,9 @@ get_kernel_arguments(const char* xml_data, size_t xml_size, const std::string& k
     if (xml_kernel.second.get<std::string>("<xmlattr>.name") != kname)
       continue;
 
-    auto pwmap = get_portname_width_map(xml_kernel.second);
-
-    for (auto& xml_arg : xml_kernel.second) {
-      if (xml_arg.first != "arg")
-        continue;
-
-      std::string id = xml_arg.second.get<std::string>("<xmlattr>.id");
-      size_t index = id.empty() ? kernel_argument::no_index : convert(id);
-
-      std::string port = xml_arg.second.get<std::string>("<xmlattr>.port", "no-port");
-      auto itr = pwmap.find(port);
-      size_t pwidth = (itr != pwmap.end()) ? (*itr).second : 0;
-
-      args.emplace_back(kernel_argument{
-          xml_arg.second.get<std::string>("<xmlattr>.name")
-         ,xml_arg.second.get<std::string>("<xmlattr>.type", "no-type")
-         ,std::move(port)
-         ,pwidth
-         ,index
-         ,convert(xml_arg.second.get<std::string>("<xmlattr>.offset"))
-         ,convert(xml_arg.second.get<std::string>("<xmlattr>.size"))
-         ,convert(xml_arg.second.get<std::string>("<xmlattr>.hostSize"))
-         ,0  // fa_desc_offset post computed if necessary
-         ,kernel_argument::argtype(xml_arg.second.get<size_t>("<xmlattr>.addressQualifier"))
-         ,kernel_argument::direction(kernel_argument::direction::input)
-      });
-    }
-
-    // stable sort to preserve order of multi-component arguments
-    // for example global_size, local_size, etc.
-    std::stable_sort(args.begin(), args.end(), [](auto& a1, auto& a2) { return a1.index < a2.index; });
-
-    // merge args with same index
-    merge_args(args);
-
-    break;
+    return parse_kernel_arguments(xml_kernel.second);
   }
-  return args;
+  return {};
 }
 
 std::vector<kernel_argument>
@@ -1107,10 +1433,7 @@ get_kernel_arguments(const axlf* top, const std::string& kname)
 kernel_properties
 get_kernel_properties(const char* xml_data, size_t xml_size, const std::string& kname)
 {
-  pt::ptree xml_project;
-  std::stringstream xml_stream;
-  xml_stream.write(xml_data,xml_size);
-  pt::read_xml(xml_stream,xml_project);
+  auto xml_project = read_xml(xml_data, xml_size);
 
   for (auto& xml_kernel : xml_project.get_child("project.platform.device.core")) {
     if (xml_kernel.first != "kernel")
@@ -1118,35 +1441,9 @@ get_kernel_properties(const char* xml_data, size_t xml_size, const std::string&
     if (xml_kernel.second.get<std::string>("<xmlattr>.name") != kname)
       continue;
 
-    // Determine features
-    auto mailbox = convert_to_mailbox_type(xml_kernel.second.get<std::string>("<xmlattr>.mailbox", "none"));
-    if (mailbox == kernel_properties::mailbox_type::none)
-      mailbox = get_mailbox_from_ini(kname);
-    auto restart = convert(xml_kernel.second.get<std::string>("<xmlattr>.countedAutoRestart", "0"));
-    if (restart == 0)
-      restart = get_restart_from_ini(kname);
-    auto sw_reset = to_bool(xml_kernel.second.get<std::string>("<xmlattr>.swReset", "false"));
-    if (!sw_reset)
-      sw_reset = get_sw_reset_from_ini(kname);
-
-    auto functional = get_functional(xml_kernel.second, "extended-data");
-    auto kernel_id = get_kernel_id(xml_kernel.second, "extended-data");
-
-    return kernel_properties
-      { kname
-      , to_kernel_type(xml_kernel.second.get<std::string>("<xmlattr>.type", "pl"))
-      , restart
-      , mailbox
-      , get_address_range(xml_kernel.second)
-      , sw_reset
-      , functional
-      , kernel_id
-
-      , convert(xml_kernel.second.get<std::string>("<xmlattr>.workGroupSize", "0"))
-      , get_xyz(xml_kernel.second, "compileWorkGroupSize")
-      , get_xyz(xml_kernel.second, "maxWorkGroupSize")
-      , get_stringtable(xml_kernel.second) };
-
+    auto props = parse_kernel_properties(xml_kernel.second, kname);
+    amend_kernel_properties(props);
+    return props;
   }
 
   return kernel_properties{};
@@ -1159,50 +1456,77 @@ get_kernel_properties(const axlf* top, const std::string& kname)
   return get_kernel_properties(xml.first, xml.second, kname);
 }
 
-std::vector<std::string>
-get_kernel_names(const char *xml_data, size_t xml_size)
+xml_metadata
+get_xml_metadata(const char* xml_data, size_t xml_size)
 {
-  std::vector<std::string> names;
-
-  pt::ptree xml_project;
-  std::stringstream xml_stream;
-  xml_stream.write(xml_data,xml_size);
-  pt::read_xml(xml_stream,xml_project);
+  auto md = parse_xml_metadata(xml_data, xml_size);
+  for (auto& kernel : md.kernels)
+    amend_kernel_properties(kernel.properties);
+  return md;
+}
 
-  for (auto& xml_kernel : xml_project.get_child("project.platform.device.core")) {
-    if (xml_kernel.first != "kernel")
-      continue;
+std::shared_ptr<const xml_metadata>
+get_xml_metadata(const axlf* top)
+{
+  auto xml = get_xml_section(top);
+  auto hash = metadata_cache::fnv1a(xml.first, xml.second);
+  auto key = xrt::uuid(top->m_header.uuid).to_string()
+    + "-" + (boost::format("%016x") % hash).str();
+
+  static std::mutex mutex;
+  static std::map<std::string, std::shared_ptr<const xml_metadata>> cache;
+  std::lock_guard lk(mutex);
+  if (auto itr = cache.find(key); itr != cache.end())
+    return (*itr).second;
+
+  std::optional<xml_metadata> md;
+  std::filesystem::path path;
+  if (auto dir = xrt_core::config::get_xclbin_metadata_cache(); !dir.empty()) {
+    path = std::filesystem::path(dir) / (key + ".bin");
+    md = metadata_cache::load(path, hash, xml.second);
+  }
 
-    names.push_back(xml_kernel.second.get<std::string>("<xmlattr>.name"));
+  if (!md) {
+    md = parse_xml_metadata(xml.first, xml.second);
+    if (!path.empty())
+      metadata_cache::store(path, metadata_cache::serialize(*md, hash, xml.second));
   }
 
-  return names;
+  for (auto& kernel : md->kernels)
+    amend_kernel_properties(kernel.properties);
+
+  auto value = std::make_shared<const xml_metadata>(std::move(*md));
+  cache.emplace(std::move(key), value);
+  return value;
 }
 
-std::vector<kernel_object>
-get_kernels(const char* xml_data, size_t xml_size)
+static std::vector<kernel_object>
+to_kernel_objects(const xml_metadata& md)
 {
   std::vector<kernel_object> kernels;
-
-  auto knames = get_kernel_names(xml_data, xml_size);
-  for (auto& kname : get_kernel_names(xml_data, xml_size)) {
-    auto kprop = get_kernel_properties(xml_data, xml_size, kname);
+  kernels.reserve(md.kernels.size());
+  for (auto& kernel : md.kernels) {
     kernels.emplace_back(kernel_object{
-        kname
-       ,get_kernel_arguments(xml_data, xml_size, kname)
-       ,kprop.address_range
-       ,kprop.sw_reset
+        kernel.properties.name
+       ,kernel.args
+       ,kernel.properties.address_range
+       ,kernel.properties.sw_reset
     });
   }
 
   return kernels;
 }
 
+std::vector<kernel_object>
+get_kernels(const char* xml_data, size_t xml_size)
+{
+  return to_kernel_objects(get_xml_metadata(xml_data, xml_size));
+}
+
 std::vector<kernel_object>
 get_kernels(const axlf* top)
 {
-  auto xml = get_xml_section(top);
-  return get_kernels(xml.first, xml.second);
+  return to_kernel_objects(*get_xml_metadata(top));
 }
 
 // AIE only xclbin has LOAD_AIE action mask
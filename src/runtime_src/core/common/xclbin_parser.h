@@ -12,6 +12,7 @@
 #include <array>
 #include <limits>
 #include <map>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -69,6 +70,25 @@ struct kernel_object
   bool sw_reset;
 };
 
+// struct xml_metadata - meta data extracted from EMBEDDED_METADATA
+//
+// All kernel properties and arguments along with project and device
+// name, extracted in one pass over the XML meta data.  Kernel
+// properties are amended with xrt.ini overrides same as
+// get_kernel_properties().
+struct xml_metadata
+{
+  struct kernel
+  {
+    kernel_properties properties;
+    std::vector<kernel_argument> args;
+  };
+
+  std::string project_name;
+  std::string fpga_device_name;
+  std::vector<kernel> kernels;
+};
+
 // struct softkernel_object - wrapper for a soft kernel object
 //
 // @ninst: number of instances
@@ -378,6 +398,33 @@ XRT_CORE_COMMON_EXPORT
 std::vector<kernel_object>
 get_kernels(const axlf* top);
 
+/**
+ * get_xml_metadata() - Get all meta data from XML meta data
+ *
+ * @xml_data: XML metadata from xclbin
+ * @xml_size: Size of XML metadata from xclbin
+ * Return: Meta data of all kernels, parsed in one pass
+ */
+XRT_CORE_COMMON_EXPORT
+xml_metadata
+get_xml_metadata(const char* xml_data, size_t xml_size);
+
+/**
+ * get_xml_metadata() - Get all meta data from XML meta data
+ *
+ * @top : Full axlf
+ * Return: Meta data of all kernels
+ *
+ * The meta data is memoized per process keyed by xclbin uuid and
+ * hash of the XML meta data, such that the XML of an xclbin is
+ * parsed once per process.  If xrt.ini Runtime.xclbin_metadata_cache
+ * is a directory, the meta data is also cached on disk and shared
+ * between processes.  Throws if the xclbin has no XML meta data.
+ */
+XRT_CORE_COMMON_EXPORT
+std::shared_ptr<const xml_metadata>
+get_xml_metadata(const axlf* top);
+
 /**
  * is_aie_only() - check if xclbin passed is aie only xclbin
  */
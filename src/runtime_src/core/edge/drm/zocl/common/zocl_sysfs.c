@@ -37,6 +37,24 @@ kds_echo_store(struct device *dev, struct device_attribute *da,
 }
 static DEVICE_ATTR(kds_echo, 0644, kds_echo_show, kds_echo_store);
 
+static ssize_t
+kds_cu_policy_show(struct device *dev, struct device_attribute *attr, char *buf)
+{
+	struct drm_zocl_dev *zdev = dev_get_drvdata(dev);
+
+	return show_kds_cu_policy(&zdev->kds, buf);
+}
+
+static ssize_t
+kds_cu_policy_store(struct device *dev, struct device_attribute *da,
+		    const char *buf, size_t count)
+{
+	struct drm_zocl_dev *zdev = dev_get_drvdata(dev);
+
+	return store_kds_cu_policy(&zdev->kds, buf, count);
+}
+static DEVICE_ATTR(kds_cu_policy, 0644, kds_cu_policy_show, kds_cu_policy_store);
+
 static ssize_t
 kds_stat_show(struct device *dev, struct device_attribute *attr, char *buf)
 {
@@ -415,6 +433,7 @@ static struct attribute *zocl_attrs[] = {
 	&dev_attr_kds_numcus.attr,
 	&dev_attr_kds_xrt_version.attr,
 	&dev_attr_kds_echo.attr,
+	&dev_attr_kds_cu_policy.attr,
 	&dev_attr_kds_stat.attr,
 	&dev_attr_kds_interval.attr,
 	&dev_attr_memstat.attr,
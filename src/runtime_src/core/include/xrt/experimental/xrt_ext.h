@@ -231,6 +231,141 @@ public:
   /// @endcond
 };
 
+/// @cond
+class bo_pool_impl;
+/// @endcond
+
+/*!
+ * @class bo_pool
+ *
+ * @brief Pool of sub-buffers carved from large buffer objects
+ *
+ * @details
+ * A buffer pool reserves a few large buffer objects (arenas) per
+ * memory group and hands out sub-buffers of these arenas.  Allocation
+ * and release of a pooled buffer does not call into the driver once
+ * the arenas are reserved, which makes the pool suitable for
+ * applications that allocate and free many small buffers.
+ *
+ * Requested sizes are rounded up to a power of two size class
+ * starting at 4KB.  A released buffer is returned to the free list of
+ * its size class and reused by a later allocation of the same class.
+ * Requests larger than the largest size class (1/16 of the arena
+ * size) are allocated as regular buffer objects.
+ *
+ * An arena without allocated buffers is released when another arena
+ * in the same memory group is also unused, ``trim()`` releases all
+ * unused arenas.
+ *
+ * The returned buffers are regular xrt::bo sub-buffer objects with
+ * the flags of the pool.  A buffer can outlive the pool, in which
+ * case its memory is released with the arena when the last buffer in
+ * the arena is destroyed.
+ *
+ * The pool is thread safe.
+ */
+class bo_pool : public xrt::detail::pimpl<bo_pool_impl>
+{
+public:
+  /**
+   * @struct stats - pool statistics
+   *
+   * @var arenas
+   *  Number of arenas currently reserved
+   * @var reserved_bytes
+   *  Total size of arenas currently reserved
+   * @var used_bytes
+   *  Bytes currently handed out in sub-buffers, rounded to size class
+   * @var allocs
+   *  Number of buffers allocated from pool
+   * @var reuses
+   *  Number of allocations served from a free list
+   * @var fallback_allocs
+   *  Number of allocations too large for the pool
+   * @var arena_allocs
+   *  Number of arenas allocated
+   * @var arena_frees
+   *  Number of arenas released
+   */
+  struct stats
+  {
+    size_t arenas = 0;
+    size_t reserved_bytes = 0;
+    size_t used_bytes = 0;
+    uint64_t allocs = 0;
+    uint64_t reuses = 0;
+    uint64_t fallback_allocs = 0;
+    uint64_t arena_allocs = 0;
+    uint64_t arena_frees = 0;
+  };
+
+  static constexpr size_t default_arena_size = 64 * 1024 * 1024; // NOLINT
+
+  /**
+   * bo_pool() - Constructor for empty pool
+   */
+  bo_pool() = default;
+
+  /**
+   * bo_pool() - Constructor for pool of device buffers
+   *
+   * @param device
+   *  The device on which to allocate the arenas
+   * @param flags
+   *  Flags for all buffers allocated from the pool
+   * @param arena_size
+   *  Size of each arena, a power of two of at least 64KB
+   */
+  XRT_API_EXPORT
+  bo_pool(const xrt::device& device, xrt::bo::flags flags = xrt::bo::flags::normal,
+          size_t arena_size = default_arena_size);
+
+  /**
+   * bo_pool() - Constructor for pool of hardware context buffers
+   *
+   * @param hwctx
+   *  The hardware context in which to allocate the arenas
+   * @param flags
+   *  Flags for all buffers allocated from the pool
+   * @param arena_size
+   *  Size of each arena, a power of two of at least 64KB
+   */
+  XRT_API_EXPORT
+  bo_pool(const xrt::hw_context& hwctx, xrt::bo::flags flags = xrt::bo::flags::normal,
+          size_t arena_size = default_arena_size);
+
+  /**
+   * alloc() - Allocate a buffer from the pool
+   *
+   * @param sz
+   *  Size of buffer
+   * @param grp
+   *  Memory group in which to allocate the buffer
+   * @return
+   *  Sub-buffer of an arena, or a regular buffer object if the
+   *  size is larger than the largest size class
+   */
+  XRT_API_EXPORT
+  xrt::bo
+  alloc(size_t sz, xrt::memory_group grp = 0);
+
+  /**
+   * get_stats() - Get current pool statistics
+   */
+  XRT_API_EXPORT
+  stats
+  get_stats() const;
+
+  /**
+   * trim() - Release all arenas without allocated buffers
+   *
+   * @return
+   *  Number of bytes released
+   */
+  XRT_API_EXPORT
+  size_t
+  trim();
+};
 
 class kernel : public xrt::kernel
 {
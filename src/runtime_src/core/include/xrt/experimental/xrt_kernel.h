@@ -118,6 +118,32 @@ public:
   explicit
   runlist(const xrt::hw_context& hwctx);
 
+  /**
+   * runlist - Constructor for pipelined runlist
+   *
+   * @param hwctx
+   *  Hardware context of run objects added to the list
+   * @param depth
+   *  Number of executions of the runlist that can be in flight
+   *
+   * A pipelined runlist can be executed again while up to depth - 1
+   * prior executions are still running, such that the device does
+   * not idle between back-to-back executions.  Each execution uses
+   * its own copy of the run object command buffers, which is taken
+   * when execute() is called.  Each call to wait(), poll(), or
+   * state() applies to the oldest running execution, and
+   * executions complete in the order they were submitted.
+   *
+   * Run object arguments must not be changed while an execution
+   * that uses them is running.  Adding run objects and reset()
+   * require that no executions are running.
+   *
+   * A depth of 1 is the same as a runlist constructed without a
+   * depth.
+   */
+  XRT_API_EXPORT
+  runlist(const xrt::hw_context& hwctx, size_t depth);
+
   /**
    * runlist - Destructor
    *
@@ -182,7 +208,8 @@ public:
    *
    * Executing an empty runlist is a no-op.
    *
-   * Throws if runlist is already executing.
+   * Throws if runlist is already executing, or for a pipelined
+   * runlist if depth number of executions are already running.
    */
   XRT_API_EXPORT
   void
@@ -223,6 +250,25 @@ public:
     wait(std::chrono::milliseconds(0));
   }
 
+  /**
+   * wait() - Wait for the runlist to complete using specified wait mode
+   *
+   * @param timeout
+   *  Timeout for wait.  A value of 0, implies block until all run
+   *  objects have completed successfully.
+   * @param mode
+   *  How to wait for completion, see ``xrt::run::wait_mode``
+   * @return
+   *  std::cv_status::no_timeout if list has completed execution of
+   *  all run objects, std::cv_status::timeout if the timeout expired
+   *  prior to all run objects completing.
+   *
+   * Same as ``wait(timeout)`` except for how the calling thread waits.
+   */
+  XRT_API_EXPORT
+  std::cv_status
+  wait(const std::chrono::milliseconds& timeout, xrt::run::wait_mode mode) const;
+
   /**
    * state() - Check the current state of a runlist object
    *
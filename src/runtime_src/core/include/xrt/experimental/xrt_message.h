@@ -33,6 +33,13 @@
  *                   Application Event Log under source "AMD_XRT"
  *   - ``<path>``  : write to a file at the given path (all platforms)
  *
+ * With ``Runtime.runtime_log_async=true``, console and file messages
+ * are queued per thread and written by a background thread.  If a
+ * thread's queue (``Runtime.runtime_log_async_ring`` messages) is full,
+ * messages are dropped and the number of dropped messages is logged.
+ * Messages of level error or worse are never dropped and are written
+ * along with all queued messages before logging returns.
+ *
  * The APIs in this file allow host application to use the same
  * message dispatch mechanism as XRT is configured to use.
  */
@@ -21,8 +21,9 @@ namespace xrt {
  *
  * Used for sequencing operations in order of enqueuing.
  *
- * A queue has exactly one consumer which is a separate thread created
- * when the queue is constructed.
+ * By default a queue has exactly one consumer which is a separate
+ * thread created when the queue is constructed.  Alternatively
+ * many queues can share the worker threads of an executor.
  *
  * When an opeation is enqueued on the queue an event is returned to
  * the caller.  This event can be enqueued in a different queue, which
@@ -30,9 +31,11 @@ namespace xrt {
  * with the event.
  */
 class queue_impl;
+class executor_impl;
 class queue
 {
   friend class queue_impl;
+  friend class executor_impl;
 
   // class task - type-erased callable operation
   //
@@ -165,6 +168,54 @@ public:
     }
   };
 
+  /**
+   * enum class priority - Scheduling priority of a queue
+   *
+   * Applies to queues that share an executor.  When several queues
+   * have ready tasks, the executor runs tasks from higher priority
+   * queues first.  Queues with a dedicated thread ignore priority.
+   */
+  enum class priority { low, normal, high };
+
+  /**
+   * class executor - Pool of worker threads shared by queues
+   *
+   * An executor runs the tasks of many queues on a fixed number of
+   * worker threads.  Tasks within one queue still execute in order
+   * of enqueuing, one at a time, but tasks from different queues
+   * execute concurrently on different workers.  Idle workers steal
+   * ready queues from busy workers.
+   *
+   * A task that blocks on an event from another queue occupies its
+   * worker while blocked.  The executor must have more workers than
+   * the number of queues that can be blocked at the same time.
+   *
+   * The executor is kept alive by the queues that use it.
+   */
+  class executor
+  {
+    friend class queue;
+    std::shared_ptr<executor_impl> m_impl;
+
+  public:
+    /**
+     * executor() - Constructor for executor object
+     *
+     * @param threads
+     *   Number of worker threads, 0 for hardware concurrency
+     * @param batch
+     *   Max number of ready tasks a worker drains from a queue
+     *   each time it picks up the queue
+     *
+     * A batch larger than one reduces scheduling overhead for queues
+     * with many small tasks, at the expense of fairness between
+     * queues.
+     */
+    XRT_API_EXPORT
+    explicit
+    executor(unsigned int threads = 0, unsigned int batch = 1);
+  };
+
 private:
   // Add task to queue
   XRT_API_EXPORT
@@ -180,6 +231,19 @@ public:
   XRT_API_EXPORT
   queue();
 
+  /**
+   * queue() - Constructor for queue object using shared workers
+   *
+   * @param exec
+   *   Executor whose worker threads execute the tasks of this queue
+   * @param prio
+   *   Priority of this queue relative to other queues of the executor
+   *
+   * The queue does not create a thread of its own.
+   */
+  XRT_API_EXPORT
+  queue(const executor& exec, priority prio = priority::normal);
+
   /**
    * enqueue() - Enqueue a callable
    *
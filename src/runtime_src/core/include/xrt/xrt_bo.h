@@ -9,6 +9,7 @@
 #include "xrt/detail/pimpl.h"
 
 #ifdef __cplusplus
+# include <future>
 # include <memory>
 # include <type_traits>
 #endif
@@ -96,9 +97,38 @@ public:
       : detail::pimpl<async_handle_impl>(std::move(handle))
     {}
 
+    /**
+     * wait() - Wait for the operation to complete
+     *
+     * Throws if the operation failed.
+     */
     XCL_DRIVER_DLLESPEC
     void
     wait();
+
+    /**
+     * ready() - Check if the operation has completed
+     *
+     * @return
+     *  True if the operation has completed and wait() will not block
+     */
+    XCL_DRIVER_DLLESPEC
+    bool
+    ready() const;
+
+    /**
+     * get_future() - Future that waits for the operation
+     *
+     * @return
+     *  Future for completion of the operation
+     *
+     * The future can be enqueued in an xrt::queue such that
+     * subsequently enqueued tasks execute after the operation has
+     * completed.  Errors are rethrown by ``get()``.
+     */
+    XCL_DRIVER_DLLESPEC
+    std::shared_future<void>
+    get_future() const;
   };
 
 public:
@@ -564,6 +594,10 @@ public:
    *
    * Asynchronously transfer specified size bytes of buffer
    * starting at specified offset.
+   *
+   * The transfer is split into chunks that are synced concurrently
+   * over the DMA channels of the device.  The buffer must not be
+   * modified by host until the returned handle is waited on.
    */
   XCL_DRIVER_DLLESPEC
   async_handle
@@ -391,6 +391,40 @@ public:
     wait2(std::chrono::milliseconds{0});
   }
 
+  /**
+   * enum wait_mode - How a wait call waits for run completion
+   *
+   * @var ini
+   *  Use the mode configured in xrt.ini ``Runtime.wait_mode``
+   * @var block
+   *  Block in the driver until the run completes
+   * @var hybrid
+   *  Spin on the run state for a budget derived from observed
+   *  completion times of the kernel, then poll, then block.
+   *  Reduces wait latency for short running kernels at the cost
+   *  of CPU cycles.
+   */
+  enum class wait_mode { ini, block, hybrid };
+
+  /**
+   * wait2() - Wait for run completion using specified wait mode
+   *
+   * @param timeout
+   *  Timeout for wait (0 means block until run completes)
+   * @param mode
+   *  How to wait for completion
+   * @return
+   *  std::cv_status::no_timeout when command completes successfully.
+   *  std::cv_status::timeout when wait timed out without command
+   *  completing.
+   *
+   * Same as ``wait2(timeout)`` except for how the calling thread
+   * waits.  Managed runs (runs with callbacks) always block.
+   */
+  XRT_API_EXPORT
+  std::cv_status
+  wait2(const std::chrono::milliseconds& timeout, wait_mode mode) const;
+
   /**
    * state() - Check the current state of a run object
    *
@@ -100,6 +100,9 @@ namespace xclswemuhal2
     bUnified = _unified;
     bXPR = _xpr;
     mIsKdsSwEmu = (xclemulation::is_sw_emulation()) ? xrt_core::config::get_flag_kds_sw_emu() : false;
+    // The device memory file is offset by the device address only when
+    // the whole device memory is one file
+    mSharedMemory = xrt_core::config::get_flag_sw_emu_shared_memory() && !std::getenv("VITIS_SW_EMU_DISABLE_SINGLE_MMAP");
   }
 
   size_t SwEmuShim::alloc_void(size_t new_size)
@@ -1511,7 +1514,9 @@ namespace xclswemuhal2
       mLogStream << __func__ << ", " << std::this_thread::get_id() << ", zeroCopy: " << zeroCopy << std::endl;
 
     std::string sFileName("");
-    xobj->base = xclAllocDeviceBuffer2(size, XCL_MEM_DEVICE_RAM, ddr, zeroCopy, sFileName);
+    // With shared memory all BOs are allocated in the device memory file
+    // such that their data can be copied without RPC
+    xobj->base = xclAllocDeviceBuffer2(size, XCL_MEM_DEVICE_RAM, ddr, zeroCopy || mSharedMemory, sFileName);
     xobj->filename = sFileName;
     xobj->size = size;
     xobj->userptr = NULL;
@@ -1944,15 +1949,25 @@ namespace xclswemuhal2
     }
 
     int returnVal = 0;
-    if (dir == XCL_BO_SYNC_BO_TO_DEVICE)
+    void *buffer = bo->userptr ? bo->userptr : bo->buf;
+    if (auto devmem = getSharedMemory(bo); devmem && size + offset <= bo->size)
+    {
+      // Host mapped zero copy BOs are the device memory, nothing to sync
+      if (buffer && devmem != buffer)
+      {
+        if (dir == XCL_BO_SYNC_BO_TO_DEVICE)
+          std::memcpy(static_cast<char *>(devmem) + offset, static_cast<char *>(buffer) + offset, size);
+        else
+          std::memcpy(static_cast<char *>(buffer) + offset, static_cast<char *>(devmem) + offset, size);
+      }
+    }
+    else if (dir == XCL_BO_SYNC_BO_TO_DEVICE)
     {
-      void *buffer = bo->userptr ? bo->userptr : bo->buf;
       if (xclCopyBufferHost2Device(bo->base, buffer, size, offset) != size)
         returnVal = EIO;
     }
     else
     {
-      void *buffer = bo->userptr ? bo->userptr : bo->buf;
       if (xclCopyBufferDevice2Host(buffer, bo->base, size, offset) != size)
         returnVal = EIO;
     }
@@ -1978,6 +1993,7 @@ namespace xclswemuhal2
 
     if (bo)
     {
+      releaseSharedMemory(bo);
       xclFreeDeviceBuffer(bo->base);
       mXoclObjMap.erase(it);
     }
@@ -1985,6 +2001,51 @@ namespace xclswemuhal2
   }
   /***************************************************************************************/
 
+  /******************************** shared memory ****************************************/
+  // Host address of the device memory of a BO in the device memory file
+  // shared with the device process, or nullptr if the BO data must be
+  // transferred over RPC.  The mapping is created on first use and kept
+  // until the BO is freed.
+  void *SwEmuShim::getSharedMemory(xclemulation::drm_xocl_bo *bo)
+  {
+    if (!mSharedMemory || bo->filename.empty())
+      return nullptr;
+
+    // A host mapped zero copy BO is already mapped to its device memory
+    if (xclemulation::is_zero_copy(bo) && bo->buf)
+      return bo->buf;
+
+    auto itr = mSharedMemoryMap.find(bo);
+    if (itr != mSharedMemoryMap.end())
+      return static_cast<char *>(itr->second.first) + (bo->base % getpagesize());
+
+    int fd = open(bo->filename.c_str(), O_RDWR);
+    if (fd == -1)
+      return nullptr;
+
+    uint64_t pageoffset = bo->base % getpagesize();
+    size_t length = bo->size + pageoffset;
+    void *data = mmap(0, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, bo->base - pageoffset);
+    close(fd);
+    if (data == MAP_FAILED)
+      return nullptr;
+
+    DEBUG_MSGS("%s, %d(sFileName: %s bo->base: %lx data: %p)\n", __func__, __LINE__, bo->filename.c_str(), bo->base, data);
+    mSharedMemoryMap[bo] = std::make_pair(data, length);
+    return static_cast<char *>(data) + pageoffset;
+  }
+
+  void SwEmuShim::releaseSharedMemory(xclemulation::drm_xocl_bo *bo)
+  {
+    auto itr = mSharedMemoryMap.find(bo);
+    if (itr == mSharedMemoryMap.end())
+      return;
+
+    munmap(itr->second.first, itr->second.second);
+    mSharedMemoryMap.erase(itr);
+  }
+  /***************************************************************************************/
+
   /******************************** xclWriteBO *******************************************/
   size_t SwEmuShim::xclWriteBO(unsigned int boHandle, const void *src, size_t size, size_t seek)
   {
@@ -1998,7 +2059,9 @@ namespace xclswemuhal2
       return -1;
     }
     size_t returnVal = 0;
-    if (xclCopyBufferHost2Device(bo->base, src, size, seek) != size)
+    if (auto devmem = getSharedMemory(bo); devmem && size + seek <= bo->size)
+      std::memcpy(static_cast<char *>(devmem) + seek, static_cast<const char *>(src) + seek, size);
+    else if (xclCopyBufferHost2Device(bo->base, src, size, seek) != size)
       returnVal = EIO;
 
     PRINTENDFUNC;
@@ -2019,7 +2082,9 @@ namespace xclswemuhal2
       return -1;
     }
     size_t returnVal = 0;
-    if (xclCopyBufferDevice2Host(dst, bo->base, size, skip) != size)
+    if (auto devmem = getSharedMemory(bo); devmem && size + skip <= bo->size)
+      std::memcpy(static_cast<char *>(dst) + skip, static_cast<char *>(devmem) + skip, size);
+    else if (xclCopyBufferDevice2Host(dst, bo->base, size, skip) != size)
       returnVal = EIO;
 
     PRINTENDFUNC;
@@ -422,6 +422,8 @@ namespace xclswemuhal2
     static int xclLogMsg(xclDeviceHandle handle, xrtLogMsgLevel level, const char *tag, const char *format, va_list args1);
 
     xclemulation::drm_xocl_bo *xclGetBoByHandle(unsigned int boHandle);
+    void *getSharedMemory(xclemulation::drm_xocl_bo *bo);
+    void releaseSharedMemory(xclemulation::drm_xocl_bo *bo);
     inline unsigned short xocl_ddr_channel_count();
     inline unsigned long long xocl_ddr_channel_size();
     // HAL2 RELATED member functions end
@@ -851,6 +853,10 @@ namespace xclswemuhal2
     exec_core *mCore;
     SWScheduler *mSWSch;
     bool mIsKdsSwEmu;
+    // BO data is copied through the shared device memory file
+    bool mSharedMemory;
+    // Host mapping of the device memory of BOs, address and length
+    std::map<xclemulation::drm_xocl_bo *, std::pair<void *, size_t>> mSharedMemoryMap;
     std::atomic<bool> mIsDeviceProcessStarted;
   };
 
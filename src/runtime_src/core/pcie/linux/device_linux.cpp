@@ -1609,6 +1609,7 @@ reset(query::reset_type& key) const
 {
   std::string err;
   get_dev()->sysfs_put(key.get_subdev(), key.get_entry(), err, key.get_value());
+  invalidate_query_cache(true);
   if (!err.empty())
     throw error("reset failed");
 }
@@ -1649,6 +1650,7 @@ xclmgmt_load_xclbin(span<char> buffer) const
     xrt_core::send_exception_message(e.what(), "Failed to open device");
   }
 
+  invalidate_query_cache(false);
   if (ret)
     throw error(ret, "Failed to download xclbin");
 }
@@ -1658,6 +1660,7 @@ device_linux::
 device_shutdown() const {
   auto mgmt_dev = get_dev();
   // hot reset pcie device
+  invalidate_query_cache(true);
   if (xrt_core::pci::shutdown(mgmt_dev))
     throw xrt_core::error("Hot resetting pci device failed.");
 }
@@ -0,0 +1,189 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+/*
+ * In this file, we provide the epoll based event loop for all daemons.
+ */
+
+#include <sys/epoll.h>
+#include <syslog.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+#include <string>
+
+#include "event_loop.h"
+
+static const size_t defaultWorkers = 4;
+static const int maxEvents = 64;
+
+EventLoop::EventLoop(size_t workers)
+{
+    epfd = epoll_create1(EPOLL_CLOEXEC);
+    if (epfd < 0)
+        throw std::runtime_error(std::string("failed to create epoll fd: ") + strerror(errno));
+
+    if (workers == 0)
+        workers = 1;
+    for (size_t i = 0; i < workers; i++)
+        threads.emplace_back(&EventLoop::worker, this);
+}
+
+EventLoop::~EventLoop()
+{
+    {
+        std::lock_guard<std::mutex> l(lock);
+        stopping = true;
+    }
+    workCv.notify_all();
+    for (auto& t : threads)
+        t.join();
+    close(epfd);
+}
+
+int EventLoop::add(int fd, fdHandler handler)
+{
+    struct epoll_event ev = {};
+    ev.events = EPOLLIN | EPOLLONESHOT;
+    ev.data.fd = fd;
+
+    std::lock_guard<std::mutex> l(lock);
+    if (epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+        syslog(LOG_ERR, "failed to add fd %d to epoll: %m", fd);
+        return -errno;
+    }
+    handlers[fd] = std::move(handler);
+    return 0;
+}
+
+int EventLoop::rearm(int fd)
+{
+    struct epoll_event ev = {};
+    ev.events = EPOLLIN | EPOLLONESHOT;
+    ev.data.fd = fd;
+
+    std::lock_guard<std::mutex> l(lock);
+    if (handlers.find(fd) == handlers.end())
+        return -ENOENT;
+    if (epoll_ctl(epfd, EPOLL_CTL_MOD, fd, &ev) < 0) {
+        syslog(LOG_ERR, "failed to rearm fd %d in epoll: %m", fd);
+        return -errno;
+    }
+    return 0;
+}
+
+int EventLoop::remove(int fd)
+{
+    std::lock_guard<std::mutex> l(lock);
+    if (handlers.erase(fd) == 0)
+        return -ENOENT;
+    if (epoll_ctl(epfd, EPOLL_CTL_DEL, fd, nullptr) < 0)
+        return -errno;
+    return 0;
+}
+
+void EventLoop::submit(int key, std::function<void()> work)
+{
+    std::lock_guard<std::mutex> l(lock);
+    auto& s = strands[key];
+    s.work.push_back(std::move(work));
+    pending++;
+    if (!s.busy) {
+        s.busy = true;
+        ready.push(key);
+        workCv.notify_one();
+    }
+}
+
+int EventLoop::poll(long timeout)
+{
+    struct epoll_event events[maxEvents];
+
+    int n = epoll_wait(epfd, events, maxEvents, static_cast<int>(timeout));
+    if (n < 0) {
+        if (errno == EINTR) // signal, let caller check for quit
+            return 0;
+        syslog(LOG_ERR, "failed to epoll_wait: %m");
+        return -errno;
+    }
+
+    for (int i = 0; i < n; i++) {
+        fdHandler handler;
+        {
+            std::lock_guard<std::mutex> l(lock);
+            auto it = handlers.find(events[i].data.fd);
+            if (it == handlers.end()) // removed after it was reported ready
+                continue;
+            handler = it->second;
+        }
+        handler(events[i].events);
+    }
+    return n;
+}
+
+void EventLoop::drain()
+{
+    std::unique_lock<std::mutex> l(lock);
+    idleCv.wait(l, [this] { return pending == 0; });
+}
+
+/*
+ * Run one work item of the next ready key at a time. A key with more work
+ * is put back at the end of the ready queue, so a busy device does not
+ * starve other devices when there are fewer workers than devices.
+ */
+void EventLoop::worker()
+{
+    std::unique_lock<std::mutex> l(lock);
+    for ( ;; ) {
+        workCv.wait(l, [this] { return stopping || !ready.empty(); });
+        if (ready.empty())
+            break;
+
+        int key = ready.front();
+        ready.pop();
+        auto& s = strands[key];
+        auto work = std::move(s.work.front());
+        s.work.pop_front();
+
+        l.unlock();
+        try {
+            work();
+        } catch (std::exception& e) {
+            syslog(LOG_ERR, "event loop work failed: %s", e.what());
+        }
+        l.lock();
+
+        if (s.work.empty()) {
+            s.busy = false;
+        } else {
+            ready.push(key);
+            workCv.notify_one();
+        }
+        if (--pending == 0)
+            idleCv.notify_all();
+    }
+}
+
+size_t eventLoopWorkers(int argc, char *argv[])
+{
+    const std::string opt("--epoll");
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg(argv[i]);
+        if (arg == opt)
+            return defaultWorkers;
+        if (arg.compare(0, opt.size() + 1, opt + "=") == 0) {
+            try {
+                size_t n = std::stoul(arg.substr(opt.size() + 1));
+                return n ? n : defaultWorkers;
+            } catch (std::exception&) {
+                syslog(LOG_ERR, "bad %s, using %zu workers", arg.c_str(), defaultWorkers);
+                return defaultWorkers;
+            }
+        }
+    }
+    return 0;
+}
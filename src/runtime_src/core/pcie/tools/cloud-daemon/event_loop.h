@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+/*
+ * epoll based event loop shared by the daemons.
+ *
+ * One thread polls all registered fds and dispatches ready fds to their
+ * handlers. Handlers are expected to be quick, anything which may block,
+ * eg. reading a msg or calling into a plugin, is submitted to a bounded
+ * pool of worker threads. Work is submitted against a key (a device) and
+ * work for the same key is run in order, one at a time, so the per device
+ * state does not need locking and msgs on the same channel never interleave.
+ *
+ * fds are registered one-shot. After a ready fd is dispatched it is not
+ * polled again until it is rearmed, typically by the worker once the msg
+ * on the fd has been consumed.
+ */
+
+#ifndef EVENT_LOOP_H
+#define EVENT_LOOP_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+class EventLoop
+{
+public:
+    // Called on the loop thread with the epoll events of the ready fd.
+    using fdHandler = std::function<void(uint32_t events)>;
+
+    explicit EventLoop(size_t workers);
+    ~EventLoop();
+
+    // Register fd for input, the fd is one-shot (see rearm()).
+    int add(int fd, fdHandler handler);
+    // Enable polling of fd again after it was dispatched.
+    int rearm(int fd);
+    // Unregister fd, the fd is not closed.
+    int remove(int fd);
+
+    // Run work on the worker pool after all work submitted against key.
+    void submit(int key, std::function<void()> work);
+
+    // Wait up to timeout ms for ready fds and dispatch them. Returns the
+    // number of fds dispatched, 0 on timeout or interrupt, or -errno.
+    int poll(long timeout);
+
+    // Block until all submitted work has run.
+    void drain();
+
+    size_t workers() const { return threads.size(); }
+
+private:
+    struct strand {
+        std::deque<std::function<void()>> work;
+        bool busy = false;
+    };
+
+    int epfd = -1;
+    std::mutex lock;
+    std::condition_variable workCv;
+    std::condition_variable idleCv;
+    std::map<int, fdHandler> handlers;
+    std::map<int, strand> strands;
+    std::queue<int> ready;
+    size_t pending = 0;
+    bool stopping = false;
+    std::vector<std::thread> threads;
+
+    void worker();
+
+    EventLoop(const EventLoop&) = delete;
+    EventLoop& operator=(const EventLoop&) = delete;
+};
+
+// Number of event loop workers requested on the daemon command line with
+// --epoll[=<workers>], 0 to run the daemon with threads per device.
+size_t eventLoopWorkers(int argc, char *argv[]);
+
+#endif // EVENT_LOOP_H
@@ -39,6 +39,7 @@
 #include "pciefunc.h"
 #include "sw_msg.h"
 #include "common.h"
+#include "event_loop.h"
 #include "mpd_plugin.h"
 
 enum Hotplug_state {
@@ -63,8 +64,10 @@ udev_monitor* mpd_hotplug_monitor;
 class Mpd : public Common
 {
 public:
-    Mpd(const std::string name, const std::string plugin_path, bool for_user) :
-        Common(name, plugin_path, for_user), plugin_init(nullptr), plugin_fini(nullptr)
+    Mpd(const std::string name, const std::string plugin_path, bool for_user,
+        size_t workers) :
+        Common(name, plugin_path, for_user), plugin_init(nullptr), plugin_fini(nullptr),
+        workers(workers)
     {
     }
 
@@ -75,6 +78,9 @@ public:
     void start();
     void run();
     void stop();
+    static bool mpd_open(pcieFunc& dev, size_t index, int& mbxfd, int& msdfd,
+        msgHandler& cb);
+    static void mpd_close(const pcieFunc& dev, size_t index, int mbxfd, int msdfd);
     static void mpd_getMsg(size_t index);
     static void mpd_handleMsg(size_t index);
     static int localMsgHandler(const pcieFunc& dev,
@@ -89,6 +95,9 @@ public:
     std::map<std::string, std::thread> threads_handleMsg;
 
 private:
+    size_t workers;
+    void run_event_loop();
+    void udev_event(const std::function<void(const std::string&)>& close_mailbox);
     void update_profile_subdev_to_container(const std::string &sysfs_name,
         const std::string &subdev_name,
         const std::string &suffix);
@@ -259,6 +268,59 @@ void Mpd::extract_sysfs_name_and_subdev_name(const std::string &devpath,
     }
 }
 
+/*
+ * Receive one udev event and track the mailbox state of the fpga it is for.
+ * close_mailbox is called when the mailbox of the fpga is removed, it must
+ * stop serving the mailbox before returning.
+ */
+void Mpd::udev_event(const std::function<void(const std::string&)>& close_mailbox)
+{
+    std::string sysfs_name = "";
+    udev_device* udev_dev = udev_monitor_receive_device(mpd_hotplug_monitor);
+    if (!udev_dev)
+        return;
+    const char *subsystem = udev_device_get_subsystem(udev_dev);
+    if (!subsystem || strcmp(subsystem, "xrt_user")) {
+        udev_device_unref(udev_dev);
+        return;
+    }
+    const char *devpath = udev_device_get_devpath(udev_dev);
+    if (!devpath) {
+        udev_device_unref(udev_dev);
+        return;
+    }
+    std::string pathStr = devpath;
+    std::string subdev = "";
+    extract_sysfs_name_and_subdev_name(pathStr, sysfs_name, subdev);
+    if (subdev.empty() || sysfs_name.empty()) {
+        udev_device_unref(udev_dev);
+        return;
+    }
+
+    const char *action = udev_device_get_action(udev_dev);
+    if (action && strcmp(action, "remove") == 0) {
+        if (subdev.find("mailbox.u") != std::string::npos) {
+            state_machine[sysfs_name] = MAILBOX_REMOVED;
+            threads_handling[sysfs_name] = false;
+            close_mailbox(sysfs_name);
+            syslog(LOG_INFO, "udev: %s %s. Close mailbox", action, devpath);
+        } else {
+            syslog(LOG_INFO, "udev: %s %s of %s", action, subdev.c_str(), devpath);
+            update_profile_subdev_to_container(sysfs_name, subdev, "deny");
+        }
+    } else if (action && strcmp(action, "add") == 0 ) {
+        if (subdev.find("mailbox.u") != std::string::npos &&
+            state_machine[sysfs_name] == MAILBOX_REMOVED) {
+            state_machine[sysfs_name] = MAILBOX_ADDED;
+            syslog(LOG_INFO, "udev: %s %s. Open mailbox", action, devpath);
+        } else if (subdev.find("mailbox.u") == std::string::npos) {
+            syslog(LOG_INFO, "udev: %s %s of %s", action, subdev.c_str(), devpath);
+            update_profile_subdev_to_container(sysfs_name, subdev, "allow");
+        }
+    }
+    udev_device_unref(udev_dev);
+}
+
 void Mpd::start()
 {
     mpd_hotplug = udev_new();
@@ -315,6 +377,11 @@ void Mpd::run()
         state_machine[sysfs_name] = MAILBOX_ADDED;
     }
 
+    if (workers) {
+        run_event_loop();
+        return;
+    }
+
     int udev_fd = udev_monitor_get_fd(mpd_hotplug_monitor);
     do
     {
@@ -345,63 +412,21 @@ void Mpd::run()
         }
 
 
-        std::string sysfs_name = "";
         int ret = waitForMsg(udev_fd, 3);
-        if (ret) { //timeout
+        if (ret) //timeout
             continue;
-        } else { //udev events
-            udev_device* udev_dev = udev_monitor_receive_device(mpd_hotplug_monitor);
-            if (!udev_dev)
-                continue;
-            const char *subsystem = udev_device_get_subsystem(udev_dev);
-            if (!subsystem || strcmp(subsystem, "xrt_user")) {
-                udev_device_unref(udev_dev);
-                continue;
-            }
-            const char *devpath = udev_device_get_devpath(udev_dev);
-            if (!devpath) {
-                udev_device_unref(udev_dev);
-                continue;
-            }
-            std::string pathStr = devpath;
-            std::string subdev = "";
-            extract_sysfs_name_and_subdev_name(pathStr, sysfs_name, subdev);
-            if (subdev.empty() || sysfs_name.empty()) {
-                udev_device_unref(udev_dev);
-                continue;
-            }
 
-            const char *action = udev_device_get_action(udev_dev);
-            if (action && strcmp(action, "remove") == 0) {
-                if (subdev.find("mailbox.u") != std::string::npos) {
-                    state_machine[sysfs_name] = MAILBOX_REMOVED;
-                    threads_handling[sysfs_name] = false;
-                    if (threads_getMsg.find(sysfs_name) != threads_getMsg.end()) {
-                        threads_getMsg[sysfs_name].join();
-                        threads_getMsg.erase(sysfs_name);
-                    }
-                    if (threads_handleMsg.find(sysfs_name) != threads_handleMsg.end()) {
-                        threads_handleMsg[sysfs_name].join();
-                        threads_handleMsg.erase(sysfs_name);
-                    }
-                    syslog(LOG_INFO, "udev: %s %s. Close mailbox", action, devpath);
-                } else {
-                    syslog(LOG_INFO, "udev: %s %s of %s", action, subdev.c_str(), devpath);
-                    update_profile_subdev_to_container(sysfs_name, subdev, "deny");
-                }
-            } else if (action && strcmp(action, "add") == 0 ) {
-                if (subdev.find("mailbox.u") != std::string::npos &&
-                    state_machine[sysfs_name] == MAILBOX_REMOVED) {
-                    state_machine[sysfs_name] = MAILBOX_ADDED;
-                    syslog(LOG_INFO, "udev: %s %s. Open mailbox", action, devpath);
-                } else if (subdev.find("mailbox.u") == std::string::npos) {
-                    syslog(LOG_INFO, "udev: %s %s of %s", action, subdev.c_str(), devpath);
-                    update_profile_subdev_to_container(sysfs_name, subdev, "allow");
-                }
+        //udev events
+        udev_event([this] (const std::string& sysfs_name) {
+            if (threads_getMsg.find(sysfs_name) != threads_getMsg.end()) {
+                threads_getMsg[sysfs_name].join();
+                threads_getMsg.erase(sysfs_name);
             }
-            udev_device_unref(udev_dev);
-        }
-
+            if (threads_handleMsg.find(sysfs_name) != threads_handleMsg.end()) {
+                threads_handleMsg[sysfs_name].join();
+                threads_handleMsg.erase(sysfs_name);
+            }
+        });
     } while (!quit);
 }
 
@@ -668,18 +693,16 @@ int Mpd::localMsgHandler(const pcieFunc& dev, std::unique_ptr<sw_msg>& orig,
     return FOR_LOCAL;
 }
 
-// Client of MPD getting msg. Will quit on any error from either local mailbox or socket fd.
-// No retry is ever conducted.
-void Mpd::mpd_getMsg(size_t index)
+/*
+ * Connect the fpga to its msd, or get the remote fd from the plugin, and
+ * open the mailbox. Returns false if the fpga can't be served.
+ */
+bool Mpd::mpd_open(pcieFunc& dev, size_t index, int& mbxfd, int& msdfd,
+    msgHandler& cb)
 {
     std::string sysfs_name = xrt_core::pci::get_dev(index, true)->m_sysfs_name;
-    std::shared_ptr<Msgq<queue_msg>> msgq = threads_msgq[sysfs_name];
-    int msdfd = -1, mbxfd = -1;
-    int ret = 0;
     std::string ip;
-    msgHandler cb = nullptr;
-
-    pcieFunc dev(index);
+    int ret = 0;
 
     /*
      * If there is user plugin, then we assume the users either don't want to
@@ -691,23 +714,20 @@ void Mpd::mpd_getMsg(size_t index)
         ret = (*plugin_cbs.get_remote_msd_fd)(dev.getIndex(), &msdfd);
         if (ret) {
             dev.log(LOG_ERR, "failed to get remote fd in plugin, mpd_getMsg thread for %s exit!!", sysfs_name.c_str());
-            threads_handling[sysfs_name] = false;
-            return;
+            return false;
         }
         cb = Mpd::localMsgHandler;
     } else {
         if (!dev.loadConf()) {
             dev.log(LOG_ERR, "loadConf() failed, mpd_getMsg thread for %s exit!!", sysfs_name.c_str());
-            threads_handling[sysfs_name] = false;
-            return;
+            return false;
         }
 
         ip = getIP(dev.getHost());
         if (ip.empty()) {
             dev.log(LOG_ERR, "Can't find out IP from host: %s, mpd_getMsg thread for %s exit!!",
                     dev.getHost().c_str(), sysfs_name.c_str());
-            threads_handling[sysfs_name] = false;
-            return;
+            return false;
         }
 
         dev.log(LOG_INFO, "peer msd ip=%s, port=%d, id=0x%x",
@@ -715,8 +735,7 @@ void Mpd::mpd_getMsg(size_t index)
 
         if ((msdfd = connectMsd(dev, ip, dev.getPort(), dev.getId())) < 0) {
             dev.log(LOG_ERR, "Unable to connect to msd, mpd_getMsg thread for %s exit!!", sysfs_name.c_str());
-            threads_handling[sysfs_name] = false;
-            return;
+            return false;
         }
     }
 
@@ -724,8 +743,7 @@ void Mpd::mpd_getMsg(size_t index)
     if (mbxfd == -1) {
         dev.log(LOG_ERR, "Unable to get mailbox fd, mpd_getMsg thread for %s exit!!",
                 sysfs_name.c_str());
-        threads_handling[sysfs_name] = false;
-        return;
+        return false;
     }
 
    /*
@@ -744,6 +762,38 @@ void Mpd::mpd_getMsg(size_t index)
         if (ret)
             dev.log(LOG_ERR, "failed to mark mgmt as online");
     }
+    return true;
+}
+
+void Mpd::mpd_close(const pcieFunc& dev, size_t index, int mbxfd, int msdfd)
+{
+    //notify mailbox driver the daemon is offline
+    if (plugin_cbs.mb_notify) {
+        int ret = (*plugin_cbs.mb_notify)(index, mbxfd, false);
+        if (ret)
+            dev.log(LOG_ERR, "failed to mark mgmt as offline");
+    }
+
+    if (msdfd > 0)
+        close(msdfd);
+}
+
+// Client of MPD getting msg. Will quit on any error from either local mailbox or socket fd.
+// No retry is ever conducted.
+void Mpd::mpd_getMsg(size_t index)
+{
+    std::string sysfs_name = xrt_core::pci::get_dev(index, true)->m_sysfs_name;
+    std::shared_ptr<Msgq<queue_msg>> msgq = threads_msgq[sysfs_name];
+    int msdfd = -1, mbxfd = -1;
+    int ret = 0;
+    msgHandler cb = nullptr;
+
+    pcieFunc dev(index);
+
+    if (!mpd_open(dev, index, mbxfd, msdfd, cb)) {
+        threads_handling[sysfs_name] = false;
+        return;
+    }
 
     struct queue_msg msg = {
         .localFd = mbxfd,
@@ -794,15 +844,7 @@ void Mpd::mpd_getMsg(size_t index)
 
     threads_handling[sysfs_name] = false;
 
-    //notify mailbox driver the daemon is offline
-    if (plugin_cbs.mb_notify) {
-        ret = (*plugin_cbs.mb_notify)(index, mbxfd, false);
-        if (ret)
-            dev.log(LOG_ERR, "failed to mark mgmt as offline");
-    }
-
-    if (msdfd > 0)
-        close(msdfd);
+    mpd_close(dev, index, mbxfd, msdfd);
 
     dev.log(LOG_INFO, "mpd_getMsg thread for %s exit!!",
 	xrt_core::pci::get_dev(index)->m_sysfs_name.c_str());
@@ -833,6 +875,172 @@ void Mpd::mpd_handleMsg(size_t index)
 	xrt_core::pci::get_dev(index)->m_sysfs_name.c_str());
 }
 
+/*
+ * Event loop serving the mailbox of all fpgas from one thread, selected
+ * with --epoll. It is the same as the thread pair per fpga, but the fds of
+ * all fpgas and the udev monitor are polled together and the msgs are read
+ * and handled on a bounded pool of workers.
+ *
+ * Each fpga has two strands of work on the pool, one reads msgs and one
+ * handles them, so as with the thread pair, a long running request such
+ * as an xclbin download doesn't stop the next msg from being read.
+ *
+ * Per fpga state machine, on top of MAILBOX_ADDED/MAILBOX_REMOVED:
+ *
+ *   idle:     not served, becomes opening when the mailbox is added.
+ *   opening:  connecting to msd and opening mailbox on the handle strand.
+ *   active:   mailbox and msd fd are polled. A ready fd reads a msg on the
+ *             read strand, queues it on the handle strand and is rearmed.
+ *   closing:  on any error or mailbox removal the fds are no longer polled,
+ *             pending msgs are dropped and the mailbox is closed on the
+ *             handle strand. No retry is conducted until mailbox is added.
+ *
+ * Every open starts a new session, work queued for an earlier session is
+ * dropped.
+ */
+struct mpdBoard {
+    std::unique_ptr<pcieFunc> dev;
+    int mbxfd = -1;
+    int msdfd = -1;
+    msgHandler cb = nullptr;
+    bool started = false; // loop thread only
+    std::atomic<bool> active{false};
+    std::atomic<unsigned> session{0};
+};
+
+void Mpd::run_event_loop()
+{
+    EventLoop loop(workers);
+    std::vector<mpdBoard> boards(total);
+    std::vector<std::string> names(total);
+    auto readKey = [](size_t i) { return static_cast<int>(2 * i); };
+    auto handleKey = [](size_t i) { return static_cast<int>(2 * i + 1); };
+
+    for (size_t i = 0; i < total; i++)
+        names[i] = xrt_core::pci::get_dev(i, true)->m_sysfs_name;
+
+    syslog(LOG_INFO, "serving %zu fpgas from event loop with %zu workers",
+        total, loop.workers());
+
+    // On read strand, stop polling fds of session s and close the mailbox.
+    std::function<void(size_t, unsigned)> closeBoard = [&](size_t i, unsigned s) {
+        mpdBoard& b = boards[i];
+        if (!b.active || b.session != s)
+            return;
+        b.active = false;
+        threads_handling[names[i]] = false;
+        loop.remove(b.mbxfd);
+        loop.remove(b.msdfd);
+        loop.submit(handleKey(i), [&b, &names, i] {
+            mpd_close(*b.dev, i, b.mbxfd, b.msdfd);
+            b.dev->log(LOG_INFO, "mpd event loop for %s closed", names[i].c_str());
+            b.dev.reset();
+            b.mbxfd = b.msdfd = -1;
+        });
+    };
+
+    // On loop thread, fd of session s is ready.
+    auto onReady = [&](size_t i, int fd, unsigned s) {
+        return [&, i, fd, s](uint32_t) {
+            loop.submit(readKey(i), [&, i, fd, s] {
+                mpdBoard& b = boards[i];
+                if (!b.active || b.session != s)
+                    return;
+
+                auto msg = std::make_shared<queue_msg>();
+                msg->localFd = b.mbxfd;
+                msg->remoteFd = b.msdfd;
+                msg->cb = b.cb;
+                if (fd == b.mbxfd) {
+                    msg->type = LOCAL_MSG;
+                    msg->data = getLocalMsg(*b.dev, b.mbxfd);
+                } else {
+                    msg->type = REMOTE_MSG;
+                    msg->data = getRemoteMsg(*b.dev, b.msdfd);
+                }
+                if (msg->data == nullptr) {
+                    closeBoard(i, s);
+                    return;
+                }
+
+                loop.submit(handleKey(i), [&, i, s, msg] {
+                    mpdBoard& b = boards[i];
+                    if (!b.active || b.session != s)
+                        return;
+                    if (handleMsg(*b.dev, *msg) != 0)
+                        loop.submit(readKey(i), [&closeBoard, i, s] { closeBoard(i, s); });
+                });
+                loop.rearm(fd);
+            });
+        };
+    };
+
+    // On handle strand, connect to msd and open the mailbox.
+    auto openBoard = [&](size_t i) {
+        mpdBoard& b = boards[i];
+        if (!threads_handling[names[i]]) // removed before it was opened
+            return;
+
+        b.dev = std::make_unique<pcieFunc>(i);
+        b.cb = nullptr;
+        if (!mpd_open(*b.dev, i, b.mbxfd, b.msdfd, b.cb)) {
+            threads_handling[names[i]] = false;
+            b.dev.reset();
+            b.mbxfd = b.msdfd = -1;
+            return;
+        }
+
+        unsigned s = ++b.session;
+        b.active = true;
+        loop.add(b.mbxfd, onReady(i, b.mbxfd, s));
+        loop.add(b.msdfd, onReady(i, b.msdfd, s));
+
+        // Mailbox removed while opening, see closeMailbox
+        if (!threads_handling[names[i]])
+            loop.submit(readKey(i), [&closeBoard, i, s] { closeBoard(i, s); });
+    };
+
+    auto closeMailbox = [&](const std::string& sysfs_name) {
+        for (size_t i = 0; i < total; i++) {
+            if (names[i] != sysfs_name)
+                continue;
+            boards[i].started = false;
+            unsigned s = boards[i].session;
+            loop.submit(readKey(i), [&closeBoard, i, s] { closeBoard(i, s); });
+        }
+    };
+
+    int udev_fd = udev_monitor_get_fd(mpd_hotplug_monitor);
+    loop.add(udev_fd, [&](uint32_t) {
+        udev_event(closeMailbox);
+        loop.rearm(udev_fd);
+    });
+
+    if (total == 0)
+        syslog(LOG_INFO, "no device found");
+    do
+    {
+        for (size_t i = 0; i < total; i++) {
+            if (state_machine[names[i]] != MAILBOX_ADDED || boards[i].started)
+                continue;
+            boards[i].started = true;
+            threads_handling[names[i]] = true;
+            syslog(LOG_INFO, "open mailbox of %s in event loop", names[i].c_str());
+            loop.submit(handleKey(i), [&openBoard, i] { openBoard(i); });
+        }
+
+        if (loop.poll(3000) < 0)
+            break;
+    } while (!quit);
+
+    loop.remove(udev_fd);
+    for (size_t i = 0; i < total; i++) {
+        unsigned s = boards[i].session;
+        loop.submit(readKey(i), [&closeBoard, i, s] { closeBoard(i, s); });
+    }
+    loop.drain();
+}
+
 /*
  * 'kill -15' is sent. or 'crtl c' on the terminal for debug.
  * so far 'kill -9' is not handled.
@@ -845,12 +1053,12 @@ static void signalHandler(int signum)
     }
 }
 
-int main(void)
+int main(int argc, char *argv[])
 {
     signal(SIGINT, signalHandler);
     signal(SIGTERM, signalHandler);
     try {
-        Mpd mpd("mpd", plugin_path, true);
+        Mpd mpd("mpd", plugin_path, true, eventLoopWorkers(argc, argv));
         mpd.preStart();
         mpd.start();
         mpd.run();
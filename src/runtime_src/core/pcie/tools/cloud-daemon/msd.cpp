@@ -27,6 +27,7 @@
 #include <fstream>
 #include <vector>
 #include <thread>
+#include <memory>
 #include <cstdlib>
 #include <csignal>
 #include <cstring>
@@ -36,6 +37,7 @@
 #include "pciefunc.h"
 #include "sw_msg.h"
 #include "common.h"
+#include "event_loop.h"
 #include "msd_plugin.h"
 #include "xrt/detail/xclbin.h"
 #include "core/pcie/driver/linux/include/mgmt-ioctl.h"
@@ -58,8 +60,10 @@ static const std::string plugin_path(MSD_PLUGIN_PATH);
 class Msd : public Common
 {
 public:
-    Msd(const std::string name, const std::string plugin_path, bool for_user) :
-        Common(name, plugin_path, for_user), plugin_init(nullptr), plugin_fini(nullptr)
+    Msd(const std::string name, const std::string plugin_path, bool for_user,
+        size_t workers) :
+        Common(name, plugin_path, for_user), plugin_init(nullptr), plugin_fini(nullptr),
+        workers(workers)
     {
     }
 
@@ -74,7 +78,11 @@ public:
     static void createSocket(const pcieFunc& dev, int& sockfd, uint16_t& port);
     static int verifyMpd(const pcieFunc& dev, int mpdfd, int id);
     static int connectMpd(const pcieFunc& dev, int sockfd, int id, int& mpdfd);
+    static bool msd_setup(pcieFunc& dev, const std::string& host, int& mbxfd,
+        int& sockfd);
+    static int msd_processMsg(const pcieFunc& dev, int fd, int mbxfd, int mpdfd);
     static void msd_thread(size_t index, std::string host);
+    static void msd_event_loop(size_t workers, size_t total, std::string host);
     static int remoteMsgHandler(const pcieFunc& dev, std::unique_ptr<sw_msg>& orig,
         std::unique_ptr<sw_msg>& processed);
     static int download_xclbin(const pcieFunc& dev, char *xclbin, uint32_t slot_id = 0);
@@ -84,6 +92,7 @@ public:
     std::vector<std::thread> threads;
 
 private:
+    size_t workers;
 };
 
 
@@ -111,9 +120,18 @@ void Msd::run()
         return;
     }
 
-    // Fire one thread for each board.
     if (total == 0)
         syslog(LOG_INFO, "no device found");
+
+    // Serve all boards from one event loop thread if asked to.
+    if (workers) {
+        syslog(LOG_INFO, "serving %zu boards from event loop with %zu workers",
+            total, workers);
+        threads.emplace_back(Msd::msd_event_loop, workers, total, host);
+        return;
+    }
+
+    // Fire one thread for each board.
     for (size_t i = 0; i < total; i++)
         threads.emplace_back(Msd::msd_thread, i, host);
 }
@@ -329,36 +347,74 @@ int Msd::remoteMsgHandler(const pcieFunc& dev, std::unique_ptr<sw_msg>& orig,
     return pass;
 }
 
-// Server serving MPD. Any error from socket fd, re-accept, don't quit.
-// Will quit on any error from local mailbox fd.
-void Msd::msd_thread(size_t index, std::string host)
+/*
+ * Open mailbox and the socket mpd connects to, and publish host and port of
+ * the socket in config of the board.
+ */
+bool Msd::msd_setup(pcieFunc& dev, const std::string& host, int& mbxfd,
+    int& sockfd)
 {
     uint16_t port;
-    int sockfd = -1, mpdfd = -1, mbxfd = -1;
-    int retfd[2];
-    int ret;
-    const int interval = 2;
-
-    pcieFunc dev(index, false);
 
     mbxfd = dev.getMailbox();
     if (mbxfd == -1)
-        goto done;
+        return false;
 
     // Create socket and obtain port.
     port = dev.getPort();
     createSocket(dev, sockfd, port);
     if (sockfd < 0 || port == 0)
-        goto done;
+        return false;
 
     // Update config, if the existing one is not the same.
     (void) dev.loadConf();
     if (host != dev.getHost() || port != dev.getPort() ||
         chanSwitch != dev.getSwitch()) {
         if (dev.updateConf(host, port, chanSwitch) != 0)
-            goto done;
+            return false;
+    }
+    return true;
+}
+
+/*
+ * Read msg arrived on fd, which is either the mailbox or the mpd socket,
+ * and pass it on. Non-zero return means the connection to mpd was lost.
+ */
+int Msd::msd_processMsg(const pcieFunc& dev, int fd, int mbxfd, int mpdfd)
+{
+    struct queue_msg msg = {0};
+    if (fd == mbxfd) {
+        msg.localFd = mbxfd;
+        msg.remoteFd = -1;
+        msg.type = LOCAL_MSG;
+        msg.data = std::move(getLocalMsg(dev, mbxfd));
+    } else if (fd == mpdfd) {
+        msg.localFd = -1;
+        msg.remoteFd = mpdfd;
+        msg.type = REMOTE_MSG;
+        msg.data = std::move(getRemoteMsg(dev, mpdfd));
+        msg.cb = Msd::remoteMsgHandler;
+    } else {
+        return 0;
     }
 
+    return handleMsg(dev, msg);
+}
+
+// Server serving MPD. Any error from socket fd, re-accept, don't quit.
+// Will quit on any error from local mailbox fd.
+void Msd::msd_thread(size_t index, std::string host)
+{
+    int sockfd = -1, mpdfd = -1, mbxfd = -1;
+    int retfd[2];
+    int ret;
+    const int interval = 2;
+
+    pcieFunc dev(index, false);
+
+    if (!msd_setup(dev, host, mbxfd, sockfd))
+        goto done;
+
     while (!quit) {
         // Connect to mpd.
         if (mpdfd == -1) {
@@ -384,23 +440,7 @@ void Msd::msd_thread(size_t index, std::string host)
 
         // Process msg.
         for (int i = 0; i < 2; i++) {
-            struct queue_msg msg = {0};
-            if (retfd[i] == mbxfd) {
-                msg.localFd = mbxfd;
-                msg.remoteFd = -1;
-                msg.type = LOCAL_MSG;
-                msg.data = std::move(getLocalMsg(dev, mbxfd));
-            } else if (retfd[i] == mpdfd) {
-                msg.localFd = -1;
-                msg.remoteFd = mpdfd;
-                msg.type = REMOTE_MSG;
-                msg.data = std::move(getRemoteMsg(dev, mpdfd));
-                msg.cb = Msd::remoteMsgHandler;
-            } else {
-                continue;
-            }
-
-            ret = handleMsg(dev, msg);
+            ret = msd_processMsg(dev, retfd[i], mbxfd, mpdfd);
             if (ret) { // Socket connection was lost, retry
                 if (mpdfd >= 0)
                     close(mpdfd);
@@ -418,6 +458,91 @@ done:
     	close(sockfd);
 }
 
+/*
+ * Event loop serving MPD of all boards. Per board state machine:
+ *
+ *   LISTENING:  only the listening socket is polled, a ready socket
+ *               accepts and verifies mpd on the board's worker strand.
+ *   CONNECTED:  mailbox and mpd socket are polled, a ready fd reads and
+ *               handles one msg on the strand and is rearmed after.
+ *               Any error drops the mpd connection and goes back to
+ *               LISTENING, same as msd_thread.
+ *
+ * All work of one board runs in order on its strand, so the board state
+ * is only touched by one worker at a time and msgs never interleave.
+ */
+struct msdBoard {
+    std::unique_ptr<pcieFunc> dev;
+    int mbxfd = -1;
+    int sockfd = -1;
+    int mpdfd = -1;
+};
+
+static void msd_disconnect(EventLoop& loop, msdBoard& b)
+{
+    loop.remove(b.mbxfd);
+    loop.remove(b.mpdfd);
+    close(b.mpdfd);
+    b.mpdfd = -1;
+    loop.rearm(b.sockfd);
+}
+
+void Msd::msd_event_loop(size_t workers, size_t total, std::string host)
+{
+    const int interval = 2;
+    EventLoop loop(workers);
+    std::vector<msdBoard> boards(total);
+
+    for (size_t i = 0; i < total; i++) {
+        msdBoard& b = boards[i];
+        int key = static_cast<int>(i);
+        b.dev = std::make_unique<pcieFunc>(i, false);
+        if (!msd_setup(*b.dev, host, b.mbxfd, b.sockfd))
+            continue;
+
+        auto onMsg = [&loop, &b, key](int fd) {
+            return [&loop, &b, key, fd](uint32_t) {
+                loop.submit(key, [&loop, &b, fd] {
+                    if (b.mpdfd < 0 || (fd != b.mbxfd && fd != b.mpdfd))
+                        return; // connection dropped while queued
+                    if (msd_processMsg(*b.dev, fd, b.mbxfd, b.mpdfd))
+                        msd_disconnect(loop, b);
+                    else
+                        loop.rearm(fd);
+                });
+            };
+        };
+
+        loop.add(b.sockfd, [&loop, &b, key, onMsg](uint32_t) {
+            loop.submit(key, [&loop, &b, onMsg] {
+                if (connectMpd(*b.dev, b.sockfd, b.dev->getId(), b.mpdfd)) {
+                    b.mpdfd = -1;
+                    loop.rearm(b.sockfd); // MPD is not ready yet, retry.
+                    return;
+                }
+                loop.add(b.mbxfd, onMsg(b.mbxfd));
+                loop.add(b.mpdfd, onMsg(b.mpdfd));
+            });
+        });
+    }
+
+    while (!quit) {
+        if (loop.poll(interval * 1000) < 0)
+            break;
+    }
+    loop.drain();
+
+    for (auto& b : boards) {
+        if (!b.dev)
+            continue;
+        b.dev->updateConf("", 0, 0); // Restore default config.
+        if (b.mpdfd >= 0)
+            close(b.mpdfd);
+        if (b.sockfd >= 0)
+            close(b.sockfd);
+    }
+}
+
 /*
  * daemon will gracefully exit(eg notify mailbox driver) when
  * 'kill -15' is sent. or 'crtl c' on the terminal for debug.
@@ -431,13 +556,13 @@ static void signalHandler(int signum)
     }
 }
 
-int main(void)
+int main(int argc, char *argv[])
 {
     signal(SIGINT, signalHandler);
     signal(SIGTERM, signalHandler);
 
     try {
-        Msd msd("msd", plugin_path, false);
+        Msd msd("msd", plugin_path, false, eventLoopWorkers(argc, argv));
         msd.preStart();
         msd.start();
         msd.run();
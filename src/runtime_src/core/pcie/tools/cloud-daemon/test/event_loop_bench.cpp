@@ -0,0 +1,282 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+// Latency of mailbox msgs served by the daemon event loop
+//
+// Each device is a socketpair, one end stands in for the mailbox of the
+// device and the other end is served by the daemon.  A client thread per
+// device sends msgs on the device end and waits for the echo, measuring
+// the round trip.  The daemon end is served once with a thread per device
+// blocking in select() as mpd/msd do by default, and once by an EventLoop
+// with a bounded pool of workers as with --epoll.  Serving a msg can be
+// made to take some time to model a plugin call.
+//
+// The device count is doubled up to the max and the average and 99th
+// percentile round trip is reported for each count and mode.
+//
+// % cmake -B build
+// % cmake --build build
+//
+// % event_loop_bench [--devices <max>] [--msgs <number>] [--workers <number>] [--work <us>]
+
+#include "event_loop.h"
+
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using clock_type = std::chrono::steady_clock;
+
+static void
+usage()
+{
+  std::cout << "usage: event_loop_bench [options]\n\n";
+  std::cout << "  [--devices <max>]: max number of devices (default: 64)\n";
+  std::cout << "  [--msgs <number>]: msgs per device (default: 1000)\n";
+  std::cout << "  [--workers <number>]: event loop workers (default: 4)\n";
+  std::cout << "  [--work <us>]: time to serve one msg (default: 0)\n";
+}
+
+struct msg
+{
+  uint64_t seq;
+  uint64_t device;
+};
+
+struct device
+{
+  int fds[2] = {-1, -1}; // [0] device end, [1] daemon end
+
+  device()
+  {
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) < 0)
+      throw std::runtime_error(std::string("socketpair: ") + strerror(errno));
+  }
+
+  ~device()
+  {
+    close(fds[0]);
+    close(fds[1]);
+  }
+};
+
+static bool
+read_msg(int fd, msg& m)
+{
+  return recv(fd, &m, sizeof(m), MSG_WAITALL) == sizeof(m);
+}
+
+static bool
+write_msg(int fd, const msg& m)
+{
+  return send(fd, &m, sizeof(m), MSG_NOSIGNAL) == sizeof(m);
+}
+
+// Serve one msg on daemon end of device, echo it back
+static bool
+serve(int fd, long work)
+{
+  msg m;
+  if (!read_msg(fd, m))
+    return false;
+  if (work)
+    std::this_thread::sleep_for(std::chrono::microseconds(work));
+  return write_msg(fd, m);
+}
+
+// Thread per device blocking in select, as the daemons default to
+static void
+serve_threads(std::vector<std::unique_ptr<device>>& devices, long work,
+              const std::atomic<bool>& quit)
+{
+  std::vector<std::thread> threads;
+  for (auto& d : devices) {
+    int fd = d->fds[1];
+    threads.emplace_back([fd, work, &quit] {
+      while (!quit) {
+        fd_set fds;
+        FD_ZERO(&fds);
+        FD_SET(fd, &fds);
+        struct timeval timeout = { 0, 100000 };
+        if (select(fd + 1, &fds, nullptr, nullptr, &timeout) <= 0)
+          continue;
+        if (!serve(fd, work))
+          break;
+      }
+    });
+  }
+  for (auto& t : threads)
+    t.join();
+}
+
+// One event loop serving all devices
+static void
+serve_event_loop(std::vector<std::unique_ptr<device>>& devices, size_t workers,
+                 long work, const std::atomic<bool>& quit)
+{
+  EventLoop loop(workers);
+  for (size_t i = 0; i < devices.size(); ++i) {
+    int fd = devices[i]->fds[1];
+    int key = static_cast<int>(i);
+    loop.add(fd, [&loop, fd, key, work](uint32_t) {
+      loop.submit(key, [&loop, fd, work] {
+        if (serve(fd, work))
+          loop.rearm(fd);
+      });
+    });
+  }
+
+  while (!quit) {
+    if (loop.poll(100) < 0)
+      throw std::runtime_error("event loop poll failed");
+  }
+  loop.drain();
+}
+
+struct result
+{
+  double avg_us = 0;
+  double p99_us = 0;
+};
+
+static result
+run(size_t count, size_t msgs, size_t workers, long work, bool event_loop)
+{
+  std::vector<std::unique_ptr<device>> devices;
+  for (size_t i = 0; i < count; ++i)
+    devices.emplace_back(std::make_unique<device>());
+
+  std::atomic<bool> quit{false};
+  std::thread daemon([&] {
+    if (event_loop)
+      serve_event_loop(devices, workers, work, quit);
+    else
+      serve_threads(devices, work, quit);
+  });
+
+  std::vector<std::vector<double>> latencies(count);
+  std::vector<std::string> errors(count);
+  std::vector<std::thread> clients;
+  for (size_t i = 0; i < count; ++i) {
+    clients.emplace_back([&, i] {
+      int fd = devices[i]->fds[0];
+      auto& lat = latencies[i];
+      lat.reserve(msgs);
+      for (uint64_t seq = 0; seq < msgs; ++seq) {
+        msg m {seq, i};
+        auto start = clock_type::now();
+        if (!write_msg(fd, m) || !read_msg(fd, m)) {
+          errors[i] = "device " + std::to_string(i) + " lost connection";
+          return;
+        }
+        auto end = clock_type::now();
+        if (m.seq != seq || m.device != i) {
+          errors[i] = "device " + std::to_string(i) + " got wrong msg";
+          return;
+        }
+        lat.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+      }
+    });
+  }
+  for (auto& t : clients)
+    t.join();
+
+  quit = true;
+  daemon.join();
+
+  for (auto& e : errors)
+    if (!e.empty())
+      throw std::runtime_error(e);
+
+  std::vector<double> all;
+  for (auto& l : latencies)
+    all.insert(all.end(), l.begin(), l.end());
+  std::sort(all.begin(), all.end());
+
+  result r;
+  for (auto v : all)
+    r.avg_us += v;
+  r.avg_us /= all.size();
+  r.p99_us = all[std::min(all.size() - 1, all.size() * 99 / 100)];
+  return r;
+}
+
+static int
+run(int argc, char** argv)
+{
+  std::vector<std::string> args(argv+1,argv+argc);
+
+  size_t max_devices = 64;
+  size_t msgs = 1000;
+  size_t workers = 4;
+  long work = 0;
+
+  std::string cur;
+  for (auto& arg : args) {
+    if (arg == "-h") {
+      usage();
+      return 1;
+    }
+
+    if (arg[0] == '-') {
+      cur = arg;
+      continue;
+    }
+
+    if (cur == "--devices")
+      max_devices = std::stoul(arg);
+    else if (cur == "--msgs")
+      msgs = std::stoul(arg);
+    else if (cur == "--workers")
+      workers = std::stoul(arg);
+    else if (cur == "--work")
+      work = std::stol(arg);
+    else
+      throw std::runtime_error("bad argument '" + cur + " " + arg + "'");
+  }
+
+  if (!max_devices || !msgs)
+    throw std::runtime_error("FAILED_TEST\nNumber of devices and msgs must be positive");
+
+  std::cout << "msgs: " << msgs << " workers: " << workers << " work: " << work << " us\n";
+  std::cout << "devices  threads avg/p99 (us)  event loop avg/p99 (us)\n";
+  for (size_t count = 1; count <= max_devices; count *= 2) {
+    auto threads = run(count, msgs, workers, work, false);
+    auto loop = run(count, msgs, workers, work, true);
+    std::cout << count << "  "
+              << threads.avg_us << "/" << threads.p99_us << "  "
+              << loop.avg_us << "/" << loop.p99_us << "\n";
+  }
+
+  std::cout << "TEST PASSED\n";
+  return 0;
+}
+
+int
+main(int argc, char* argv[])
+{
+  try {
+    return run(argc,argv);
+  }
+  catch (const std::exception& ex) {
+    std::cout << "TEST FAILED: " << ex.what() << "\n";
+  }
+  catch (...) {
+    std::cout << "TEST FAILED\n";
+  }
+
+  return 1;
+}
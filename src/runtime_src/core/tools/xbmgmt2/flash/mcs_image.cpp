@@ -0,0 +1,198 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+#include "mcs_image.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <string>
+
+/*
+ * Value of hex digit, or -1 if not a hex digit.
+ */
+static inline int hexValue(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    return -1;
+}
+
+/*
+ * Decode hex digits of line [pos, pos + 2 * len) into bytes, returns false
+ * if the line is too short or has a non hex digit.
+ */
+static inline bool hexBytes(const std::string& line, size_t pos, unsigned int len,
+    unsigned char *buf)
+{
+    if (line.size() < pos + 2 * len)
+        return false;
+
+    for (unsigned int i = 0; i < len; i++) {
+        int hi = hexValue(line[pos + 2 * i]);
+        int lo = hexValue(line[pos + 2 * i + 1]);
+        if (hi < 0 || lo < 0)
+            return false;
+        buf[i] = static_cast<unsigned char>((hi << 4) | lo);
+    }
+    return true;
+}
+
+int mcsImage::parse(std::istream& mcsStream)
+{
+    mSegments.clear();
+    mSectors.clear();
+    mFirstEla = UINT_MAX;
+
+    // Record is ':' len(1) address(2) type(1) data(len) checksum(1)
+    unsigned char rec[5 + 255];
+    std::string line;
+    unsigned int ela = UINT_MAX;
+    bool elaData = false; // data record seen since last ela record
+    bool done = false;
+
+    while (!done && std::getline(mcsStream, line)) {
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+        if (line.empty())
+            continue;
+
+        // Every line should start with ":"
+        if (line[0] != ':' || !hexBytes(line, 1, 4, rec) ||
+            !hexBytes(line, 9, rec[0], rec + 4)) {
+            std::cout << "Found invalid MCS line: " << line << std::endl;
+            return -EINVAL;
+        }
+
+        unsigned int len = rec[0];
+        unsigned int offset = (rec[1] << 8) | rec[2];
+        unsigned int type = rec[3];
+        const unsigned char *data = rec + 4;
+
+        switch (type) {
+        case 0: {
+            // For xilinx mcs files data length should be 16 for all records
+            // except for the last one which can be smaller
+            if (len > 16) {
+                std::cout << "Found invalid MCS line: " << line << std::endl;
+                return -EINVAL;
+            }
+            if (ela == UINT_MAX) {
+                std::cout << "MCS missing page starting address" << std::endl;
+                return -EINVAL;
+            }
+
+            unsigned int addr = ela | offset;
+            bool contiguous = !mSegments.empty() &&
+                mSegments.back().start + mSegments.back().data.size() == addr;
+            if (!contiguous) {
+                if (elaData) {
+                    std::cout << "MCS page offset is not contiguous, got 0x"
+                        << std::hex << offset << std::dec << std::endl;
+                    return -EINVAL;
+                }
+                // First data of page not following previous page starts a new segment
+                mSegments.push_back({addr, {}});
+            }
+            mSegments.back().data.insert(mSegments.back().data.end(), data, data + len);
+            elaData = true;
+            break;
+        }
+        case 1:
+            done = true;
+            break;
+        case 4:
+            // For xilinx mcs files extended address can only be 2 bytes
+            if (len != 2 || offset != 0) {
+                std::cout << "Found invalid MCS line: " << line << std::endl;
+                return -EINVAL;
+            }
+            ela = ((data[0] << 8) | data[1]) << 16;
+            if (mFirstEla == UINT_MAX)
+                mFirstEla = ela;
+            elaData = false;
+            break;
+        default:
+            // Xilinx mcs files should not contain other types
+            std::cout << "Found invalid MCS line: " << line << std::endl;
+            return -EINVAL;
+        }
+    }
+
+    if (mSegments.empty()) {
+        std::cout << "MCS contains no data" << std::endl;
+        return -EINVAL;
+    }
+
+    std::sort(mSegments.begin(), mSegments.end(),
+        [](const segment& a, const segment& b) { return a.start < b.start; });
+    for (size_t i = 1; i < mSegments.size(); i++) {
+        if (mSegments[i - 1].start + mSegments[i - 1].data.size() > mSegments[i].start) {
+            std::cout << "MCS data overlaps at 0x" << std::hex << mSegments[i].start
+                << std::dec << std::endl;
+            return -EINVAL;
+        }
+    }
+
+    hashSectors();
+    return 0;
+}
+
+unsigned int mcsImage::startAddress() const
+{
+    return mSegments.empty() ? 0 : mSegments.front().start;
+}
+
+size_t mcsImage::size() const
+{
+    size_t sz = 0;
+    for (auto& s : mSegments)
+        sz += s.data.size();
+    return sz;
+}
+
+void mcsImage::read(unsigned int addr, unsigned char *buf, size_t len) const
+{
+    std::memset(buf, 0xFF, len);
+
+    // First segment ending after addr
+    auto it = std::upper_bound(mSegments.begin(), mSegments.end(), addr,
+        [](unsigned int a, const segment& s) { return a < s.start + s.data.size(); });
+    for (; it != mSegments.end() && it->start < addr + len; ++it) {
+        size_t from = std::max<size_t>(addr, it->start);
+        size_t to = std::min<size_t>(addr + len, it->start + it->data.size());
+        std::memcpy(buf + (from - addr), it->data.data() + (from - it->start), to - from);
+    }
+}
+
+// 64-bit FNV-1a
+uint64_t mcsImage::hash(const unsigned char *buf, size_t len)
+{
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < len; i++) {
+        h ^= buf[i];
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+void mcsImage::hashSectors()
+{
+    std::vector<unsigned char> buf(SECTOR_SIZE);
+
+    for (auto& s : mSegments) {
+        unsigned int first = s.start & ~(SECTOR_SIZE - 1);
+        unsigned int end = static_cast<unsigned int>(s.start + s.data.size());
+        for (unsigned int addr = first; addr < end; addr += SECTOR_SIZE) {
+            // Sector shared with previous segment is already hashed
+            if (!mSectors.empty() && mSectors.back().address == addr)
+                continue;
+            read(addr, buf.data(), buf.size());
+            mSectors.push_back({addr, hash(buf.data(), buf.size())});
+        }
+    }
+}
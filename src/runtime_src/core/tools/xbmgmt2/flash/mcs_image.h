@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+#ifndef _MCS_IMAGE_H_
+#define _MCS_IMAGE_H_
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+/*
+ * Binary image of an MCS (Intel HEX) flash file.
+ *
+ * The MCS text is decoded in one pass into segments of contiguous data,
+ * consecutive extended linear address records with contiguous data are
+ * merged into one segment. Each 4KB flash sector overlapped by the image
+ * is hashed as it reads from flash once programmed, i.e. with bytes not
+ * covered by the image left erased (0xFF), so a sector read back from
+ * flash which differs from the image is found without a byte compare. A
+ * matching hash is not proof, matching sectors are still compared.
+ */
+class mcsImage
+{
+public:
+    static const unsigned int SECTOR_SIZE = 0x1000;
+
+    struct segment {
+        unsigned int start;
+        std::vector<unsigned char> data;
+    };
+
+    struct sector {
+        unsigned int address;
+        uint64_t hash;
+    };
+
+    // Decode the MCS stream, returns 0 or -EINVAL on malformed MCS data.
+    int parse(std::istream& mcsStream);
+
+    const std::vector<segment>& segments() const { return mSegments; }
+    const std::vector<sector>& sectors() const { return mSectors; }
+
+    // Flash address of first byte in image.
+    unsigned int startAddress() const;
+    // Image is a golden image, its first extended linear address is 0.
+    bool isGolden() const { return mFirstEla == 0; }
+    // Bytes of data in image.
+    size_t size() const;
+
+    // Copy image bytes [addr, addr + len) to buf, bytes not in image read as 0xFF.
+    void read(unsigned int addr, unsigned char *buf, size_t len) const;
+
+    // Hash of a sector worth of flash content.
+    static uint64_t hash(const unsigned char *buf, size_t len);
+
+private:
+    std::vector<segment> mSegments;
+    std::vector<sector> mSectors;
+    unsigned int mFirstEla = 0;
+
+    void hashSectors();
+};
+
+#endif
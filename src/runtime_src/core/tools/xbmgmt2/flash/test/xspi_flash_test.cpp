@@ -0,0 +1,246 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+// Flash MCS images through XSPI_Flasher onto a mock AXI Quad SPI controller
+//
+// A random bitstream is written out as MCS text behind the default
+// bitstream guard address, so the flasher also sets and clears the guard.
+// The image is flashed in full onto blank flash, then again with
+// FLASH_DIFFERENTIAL set, first unchanged and then with a number of 4KB
+// sectors modified.  After each run the content of the mock flash is
+// checked against the image and the erases, page programs and estimated
+// time on a card are reported.  Differential runs must erase only the
+// modified sectors (plus the guard) and be faster than the full run.
+//
+// % cmake -B build
+// % cmake --build build
+//
+// % xspi_flash_test [--size <MB>] [--changes <sectors>]
+
+#include "xspi_mock.h"
+#include "xspi.h"
+#include "mcs_image.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using clock_type = std::chrono::steady_clock;
+
+static const unsigned int bitstream_address = 0x01002000;
+static const unsigned int guard_size = 0x1000;
+
+static void
+usage()
+{
+  std::cout << "usage: xspi_flash_test [options]\n\n";
+  std::cout << "  [--size <MB>]: size of bitstream (default: 4)\n";
+  std::cout << "  [--changes <sectors>]: 4KB sectors modified between runs (default: 16)\n";
+}
+
+static void
+mcs_record(std::ostream& os, unsigned int type, unsigned int offset,
+           const unsigned char* data, unsigned int len)
+{
+  char buf[16];
+  unsigned int sum = len + (offset >> 8) + (offset & 0xff) + type;
+  std::snprintf(buf, sizeof(buf), ":%02X%04X%02X", len, offset, type);
+  os << buf;
+  for (unsigned int i = 0; i < len; ++i) {
+    std::snprintf(buf, sizeof(buf), "%02X", data[i]);
+    os << buf;
+    sum += data[i];
+  }
+  std::snprintf(buf, sizeof(buf), "%02X\r\n", (0x100 - (sum & 0xff)) & 0xff);
+  os << buf;
+}
+
+// MCS text of data at address, 16 bytes per data record
+static std::string
+to_mcs(const std::vector<unsigned char>& data, unsigned int address)
+{
+  std::ostringstream os;
+  unsigned int ela = UINT32_MAX;
+  for (size_t i = 0; i < data.size(); i += 16) {
+    unsigned int addr = address + static_cast<unsigned int>(i);
+    if ((addr >> 16) != ela) {
+      ela = addr >> 16;
+      unsigned char e[2] = { static_cast<unsigned char>(ela >> 8), static_cast<unsigned char>(ela) };
+      mcs_record(os, 4, 0, e, 2);
+    }
+    unsigned int len = static_cast<unsigned int>(std::min<size_t>(16, data.size() - i));
+    mcs_record(os, 0, addr & 0xffff, data.data() + i, len);
+  }
+  mcs_record(os, 1, 0, nullptr, 0);
+  return os.str();
+}
+
+struct result
+{
+  XSPI_MockRegisters::stats stats;
+  double wall_s = 0;
+};
+
+static result
+flash(const std::shared_ptr<XSPI_MockRegisters>& mock, const std::string& mcs,
+      const std::vector<unsigned char>& data, bool differential)
+{
+#ifdef _WIN32
+  _putenv_s("FLASH_DIFFERENTIAL", differential ? "1" : "");
+#else
+  if (differential)
+    setenv("FLASH_DIFFERENTIAL", "1", 1);
+  else
+    unsetenv("FLASH_DIFFERENTIAL");
+#endif
+
+  mock->resetStats();
+  auto start = clock_type::now();
+  {
+    XSPI_Flasher flasher(mock);
+    std::istringstream mcs_stream(mcs);
+    std::istringstream stripped;
+    if (flasher.xclUpgradeFirmware1(mcs_stream, stripped))
+      throw std::runtime_error("flashing failed");
+  }
+  auto end = clock_type::now();
+
+  // Bitstream is shifted behind the guard, guard is cleared
+  auto& mem = mock->flash(0);
+  for (size_t i = 0; i < data.size(); ++i) {
+    if (mem[bitstream_address + guard_size + i] != data[i]) {
+      std::ostringstream err;
+      err << "flash differs from image at 0x" << std::hex << (bitstream_address + guard_size + i);
+      throw std::runtime_error(err.str());
+    }
+  }
+  for (size_t i = 0; i < guard_size; ++i)
+    if (mem[bitstream_address + i] != 0xff)
+      throw std::runtime_error("bitstream guard not cleared");
+
+  result r;
+  r.stats = mock->getStats();
+  r.wall_s = std::chrono::duration<double>(end - start).count();
+  return r;
+}
+
+static void
+report(const std::string& name, const result& r)
+{
+  std::cout << name << ": erases " << r.stats.erases
+            << " page programs " << r.stats.pagePrograms
+            << " register accesses " << (r.stats.regReads + r.stats.regWrites)
+            << " est. card time " << r.stats.us / 1e6 << " s"
+            << " (mock " << r.wall_s << " s)\n";
+}
+
+static int
+run(int argc, char** argv)
+{
+  std::vector<std::string> args(argv+1,argv+argc);
+
+  size_t size_mb = 4;
+  size_t changes = 16;
+
+  std::string cur;
+  for (auto& arg : args) {
+    if (arg == "-h") {
+      usage();
+      return 1;
+    }
+
+    if (arg[0] == '-') {
+      cur = arg;
+      continue;
+    }
+
+    if (cur == "--size")
+      size_mb = std::stoul(arg);
+    else if (cur == "--changes")
+      changes = std::stoul(arg);
+    else
+      throw std::runtime_error("bad argument '" + cur + " " + arg + "'");
+  }
+
+  if (!size_mb || size_mb > 32)
+    throw std::runtime_error("Size must be between 1 and 32 MB");
+
+  std::mt19937 rng(42);
+  std::vector<unsigned char> data(size_mb << 20);
+  for (auto& b : data)
+    b = static_cast<unsigned char>(rng());
+  // Leave some erased pages in the image
+  std::fill(data.begin() + 0x3000, data.begin() + 0x4000, 0xff);
+
+  // Decode
+  auto mcs = to_mcs(data, bitstream_address);
+  mcsImage image;
+  std::istringstream mcs_stream(mcs);
+  auto start = clock_type::now();
+  if (image.parse(mcs_stream))
+    throw std::runtime_error("failed to decode MCS");
+  auto decode_s = std::chrono::duration<double>(clock_type::now() - start).count();
+  if (image.segments().size() != 1 || image.startAddress() != bitstream_address ||
+      image.segments().front().data != data)
+    throw std::runtime_error("decoded image differs from bitstream");
+  std::cout << "decoded " << mcs.size() << " bytes of MCS in " << decode_s << " s, "
+            << image.sectors().size() << " sectors\n";
+
+  auto mock = std::make_shared<XSPI_MockRegisters>();
+
+  auto full = flash(mock, mcs, data, false);
+  report("full", full);
+
+  auto same = flash(mock, mcs, data, true);
+  report("differential, unchanged", same);
+  // Only the guard sector is erased, to set and to clear it
+  if (same.stats.erases != 2)
+    throw std::runtime_error("unchanged image erased sectors");
+
+  std::set<size_t> modified;
+  size_t sectors = data.size() / mcsImage::SECTOR_SIZE;
+  while (modified.size() < std::min(changes, sectors))
+    modified.insert(rng() % sectors);
+  for (auto s : modified)
+    data[s * mcsImage::SECTOR_SIZE + rng() % mcsImage::SECTOR_SIZE] ^= 0x5a;
+  mcs = to_mcs(data, bitstream_address);
+
+  auto diff = flash(mock, mcs, data, true);
+  report("differential, " + std::to_string(modified.size()) + " sectors changed", diff);
+  if (diff.stats.erases != modified.size() + 2)
+    throw std::runtime_error("differential flash erased unchanged sectors");
+
+  std::cout << "speedup unchanged: " << full.stats.us / same.stats.us
+            << "x, changed: " << full.stats.us / diff.stats.us << "x\n";
+  if (diff.stats.us >= full.stats.us)
+    throw std::runtime_error("differential flash is not faster");
+
+  std::cout << "TEST PASSED\n";
+  return 0;
+}
+
+int
+main(int argc, char* argv[])
+{
+  try {
+    return run(argc,argv);
+  }
+  catch (const std::exception& ex) {
+    std::cout << "TEST FAILED: " << ex.what() << "\n";
+  }
+  catch (...) {
+    std::cout << "TEST FAILED\n";
+  }
+
+  return 1;
+}
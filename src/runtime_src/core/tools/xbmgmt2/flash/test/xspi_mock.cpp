@@ -0,0 +1,320 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+#include "xspi_mock.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+// Controller registers and bits, as in the AXI Quad SPI product guide
+#define XSP_SRR_OFFSET          0x40
+#define XSP_CR_OFFSET           0x60
+#define XSP_SR_OFFSET           0x64
+#define XSP_DTR_OFFSET          0x68
+#define XSP_DRR_OFFSET          0x6C
+#define XSP_SSR_OFFSET          0x70
+#define XSP_TFO_OFFSET          0x74
+#define XSP_RFO_OFFSET          0x78
+
+#define XSP_SRR_RESET_MASK         0x0000000A
+#define XSP_CR_ENABLE_MASK         0x00000002
+#define XSP_CR_MASTER_MODE_MASK    0x00000004
+#define XSP_CR_TXFIFO_RESET_MASK   0x00000020
+#define XSP_CR_RXFIFO_RESET_MASK   0x00000040
+#define XSP_CR_MANUAL_SS_MASK      0x00000080
+#define XSP_CR_TRANS_INHIBIT_MASK  0x00000100
+#define XSP_SR_RX_EMPTY_MASK       0x00000001
+#define XSP_SR_RX_FULL_MASK        0x00000002
+#define XSP_SR_TX_EMPTY_MASK       0x00000004
+#define XSP_SR_TX_FULL_MASK        0x00000008
+
+#define CR_RESET_STATE  (XSP_CR_TRANS_INHIBIT_MASK | XSP_CR_MANUAL_SS_MASK)
+#define SSR_RESET_STATE 0xFFFFFFFF
+
+// Flash commands
+#define COMMAND_PAGE_PROGRAM        0x02
+#define COMMAND_RANDOM_READ         0x03
+#define COMMAND_STATUSREG_READ      0x05
+#define COMMAND_FAST_READ           0x0B
+#define COMMAND_4KB_SUBSECTOR_ERASE 0x20
+#define COMMAND_QUAD_WRITE          0x32
+#define COMMAND_DUAL_READ           0x3B
+#define COMMAND_32KB_SUBSECTOR_ERASE 0x52
+#define COMMAND_QUAD_READ           0x6B
+#define COMMAND_FLAG_STATUSREG_READ 0x70
+#define COMMAND_IDCODE_READ         0x9F
+#define COMMAND_EXTENDED_ADDRESS_REG_WRITE 0xC5
+#define COMMAND_BULK_ERASE          0xC7
+#define COMMAND_EXTENDED_ADDRESS_REG_READ  0xC8
+#define COMMAND_SECTOR_ERASE        0xD8
+
+#define MICRON_VENDOR_ID   0x20
+#define FLASH_PAGE_SIZE    256
+#define ADDRESS_BYTES      3
+
+// Dummy bytes between address and data of a read command
+static unsigned int readDummyBytes(unsigned char cmd)
+{
+    switch (cmd) {
+    case COMMAND_RANDOM_READ:
+        return 0;
+    case COMMAND_FAST_READ:
+        return 1;
+    case COMMAND_DUAL_READ:
+        return 2;
+    case COMMAND_QUAD_READ:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+static bool isRead(unsigned char cmd)
+{
+    return cmd == COMMAND_RANDOM_READ || cmd == COMMAND_FAST_READ ||
+        cmd == COMMAND_DUAL_READ || cmd == COMMAND_QUAD_READ;
+}
+
+XSPI_MockRegisters::XSPI_MockRegisters(unsigned int chips, unsigned int sectors16M,
+    size_t fifoDepth) : mChips(chips), mFifoDepth(fifoDepth), mCr(CR_RESET_STATE),
+    mSsr(SSR_RESET_STATE)
+{
+    unsigned char capacity = 0;
+    switch (sectors16M) {
+    case 1: capacity = 0x18; break;
+    case 2: capacity = 0x19; break;
+    case 4: capacity = 0x20; break;
+    case 8: capacity = 0x21; break;
+    case 16: capacity = 0x22; break;
+    default:
+        throw std::invalid_argument("flash size must be 1, 2, 4, 8 or 16 x 16MB");
+    }
+
+    for (auto& c : mChips) {
+        c.mem.assign(static_cast<size_t>(sectors16M) << 24, 0xFF);
+        c.idCapacity = capacity;
+    }
+    reset();
+}
+
+void XSPI_MockRegisters::reset()
+{
+    mTx.clear();
+    mRx.clear();
+    mCr = CR_RESET_STATE;
+    setSlaveSelect(SSR_RESET_STATE);
+}
+
+unsigned int XSPI_MockRegisters::readReg(unsigned int offset)
+{
+    mStats.regReads++;
+    mStats.us += mTiming.regRead;
+
+    switch (offset) {
+    case XSP_CR_OFFSET:
+        return mCr;
+    case XSP_SR_OFFSET: {
+        unsigned int sr = 0;
+        if (mRx.empty())
+            sr |= XSP_SR_RX_EMPTY_MASK;
+        if (mRx.size() >= mFifoDepth)
+            sr |= XSP_SR_RX_FULL_MASK;
+        if (mTx.empty())
+            sr |= XSP_SR_TX_EMPTY_MASK;
+        if (mTx.size() >= mFifoDepth)
+            sr |= XSP_SR_TX_FULL_MASK;
+        return sr;
+    }
+    case XSP_DRR_OFFSET: {
+        if (mRx.empty())
+            return 0;
+        unsigned char b = mRx.front();
+        mRx.pop_front();
+        return b;
+    }
+    case XSP_SSR_OFFSET:
+        return mSsr;
+    case XSP_TFO_OFFSET:
+        return mTx.empty() ? 0 : static_cast<unsigned int>(mTx.size() - 1);
+    case XSP_RFO_OFFSET:
+        return mRx.empty() ? 0 : static_cast<unsigned int>(mRx.size() - 1);
+    default:
+        return 0;
+    }
+}
+
+void XSPI_MockRegisters::writeReg(unsigned int offset, unsigned int value)
+{
+    mStats.regWrites++;
+    mStats.us += mTiming.regWrite;
+
+    switch (offset) {
+    case XSP_SRR_OFFSET:
+        if (value == XSP_SRR_RESET_MASK)
+            reset();
+        break;
+    case XSP_CR_OFFSET:
+        // fifo resets are self clearing
+        if (value & XSP_CR_TXFIFO_RESET_MASK)
+            mTx.clear();
+        if (value & XSP_CR_RXFIFO_RESET_MASK)
+            mRx.clear();
+        mCr = value & ~(XSP_CR_TXFIFO_RESET_MASK | XSP_CR_RXFIFO_RESET_MASK);
+        transfer();
+        break;
+    case XSP_DTR_OFFSET:
+        if (mTx.size() < mFifoDepth)
+            mTx.push_back(static_cast<unsigned char>(value));
+        transfer();
+        break;
+    case XSP_SSR_OFFSET:
+        setSlaveSelect(value);
+        transfer();
+        break;
+    default:
+        break;
+    }
+}
+
+/*
+ * Slave select is active low, a chip executes its command when deselected.
+ */
+void XSPI_MockRegisters::setSlaveSelect(unsigned int value)
+{
+    for (size_t i = 0; i < mChips.size(); i++) {
+        bool wasSelected = (mSsr & (1u << i)) == 0;
+        bool selected = (value & (1u << i)) == 0;
+        if (wasSelected && !selected)
+            mChips[i].end(mStats, mTiming);
+        if (!wasSelected && selected)
+            mChips[i].cmd.clear();
+    }
+    mSsr = value;
+}
+
+/*
+ * Shift tx fifo out to selected chips unless transaction is inhibited.
+ */
+void XSPI_MockRegisters::transfer()
+{
+    if (mCr & XSP_CR_TRANS_INHIBIT_MASK)
+        return;
+    if ((mCr & (XSP_CR_ENABLE_MASK | XSP_CR_MASTER_MODE_MASK)) !=
+        (XSP_CR_ENABLE_MASK | XSP_CR_MASTER_MODE_MASK))
+        return;
+
+    while (!mTx.empty()) {
+        unsigned char in = mTx.front();
+        unsigned char out = 0xFF;
+        mTx.pop_front();
+        for (size_t i = 0; i < mChips.size(); i++) {
+            if ((mSsr & (1u << i)) == 0)
+                out = mChips[i].shift(in, mStats);
+        }
+        mRx.push_back(out);
+    }
+}
+
+unsigned int XSPI_MockRegisters::chip::address() const
+{
+    // 24 bit address, upper bits from extended address register
+    unsigned int addr = (cmd[1] << 16) | (cmd[2] << 8) | cmd[3];
+    return (static_cast<unsigned int>(extAddr) << 24) | addr;
+}
+
+unsigned char XSPI_MockRegisters::chip::shift(unsigned char in, stats& st)
+{
+    cmd.push_back(in);
+    size_t pos = cmd.size() - 1;
+    if (pos == 0)
+        return 0xFF;
+
+    switch (cmd[0]) {
+    case COMMAND_IDCODE_READ: {
+        const unsigned char id[] = { MICRON_VENDOR_ID, 0xBA, idCapacity, 0x10 };
+        return pos <= sizeof(id) ? id[pos - 1] : 0;
+    }
+    case COMMAND_STATUSREG_READ:
+        // Never busy, commands complete when deselected
+        return 0;
+    case COMMAND_FLAG_STATUSREG_READ:
+        return 0x80;
+    case COMMAND_EXTENDED_ADDRESS_REG_READ:
+        return extAddr;
+    default:
+        break;
+    }
+
+    if (isRead(cmd[0])) {
+        size_t first = 1 + ADDRESS_BYTES + readDummyBytes(cmd[0]);
+        if (pos < first)
+            return 0xFF;
+        size_t addr = address() + (pos - first);
+        st.bytesRead++;
+        return addr < mem.size() ? mem[addr] : 0xFF;
+    }
+    return 0xFF;
+}
+
+void XSPI_MockRegisters::chip::end(stats& st, const timing& t)
+{
+    if (cmd.empty())
+        return;
+
+    size_t eraseSize = 0;
+    double eraseTime = 0;
+
+    switch (cmd[0]) {
+    case COMMAND_EXTENDED_ADDRESS_REG_WRITE:
+        if (cmd.size() > 1)
+            extAddr = cmd[1];
+        break;
+    case COMMAND_4KB_SUBSECTOR_ERASE:
+        eraseSize = 0x1000;
+        eraseTime = t.erase4K;
+        break;
+    case COMMAND_32KB_SUBSECTOR_ERASE:
+        eraseSize = 0x8000;
+        eraseTime = t.erase32K;
+        break;
+    case COMMAND_SECTOR_ERASE:
+        eraseSize = 0x10000;
+        eraseTime = t.erase64K;
+        break;
+    case COMMAND_BULK_ERASE:
+        std::fill(mem.begin(), mem.end(), 0xFF);
+        st.erases++;
+        st.erasedBytes += mem.size();
+        st.us += t.eraseChip;
+        break;
+    case COMMAND_PAGE_PROGRAM:
+    case COMMAND_QUAD_WRITE: {
+        if (cmd.size() <= 1 + ADDRESS_BYTES)
+            break;
+        unsigned int addr = address();
+        size_t page = addr & ~(FLASH_PAGE_SIZE - 1);
+        if (page >= mem.size())
+            break;
+        // Program can only clear bits, address wraps within page
+        for (size_t i = 1 + ADDRESS_BYTES; i < cmd.size(); i++) {
+            size_t off = (addr + i - 1 - ADDRESS_BYTES) & (FLASH_PAGE_SIZE - 1);
+            mem[page + off] &= cmd[i];
+        }
+        st.pagePrograms++;
+        st.us += t.pageProgram;
+        break;
+    }
+    default:
+        break;
+    }
+
+    if (eraseSize && cmd.size() > ADDRESS_BYTES) {
+        size_t addr = address() & ~(eraseSize - 1);
+        if (addr < mem.size()) {
+            std::fill(mem.begin() + addr, mem.begin() + std::min(addr + eraseSize, mem.size()), 0xFF);
+            st.erases++;
+            st.erasedBytes += eraseSize;
+            st.us += eraseTime;
+        }
+    }
+    cmd.clear();
+}
@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+#ifndef _XSPI_MOCK_H_
+#define _XSPI_MOCK_H_
+
+#include "xspi.h"
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+/*
+ * Mock of the AXI Quad SPI controller with NOR flash chips behind it.
+ *
+ * The controller models the registers XSPI_Flasher uses: software reset,
+ * control (fifo resets, transaction inhibit), status (fifo empty/full),
+ * tx/rx fifos and manual slave select. Bytes in the tx fifo are shifted
+ * out to the selected chip once the transaction is no longer inhibited,
+ * the byte shifted back is pushed to the rx fifo.
+ *
+ * A chip collects the bytes of a command while selected and executes the
+ * command when deselected, as a Micron serial NOR flash: read id, status
+ * and flag status, extended address register, erase of 4KB, 32KB, 64KB
+ * and whole chip, page program and reads. Erase sets bytes to 0xFF, page
+ * program can only clear bits and wraps within its 256 byte page.
+ *
+ * Register accesses, erases and page programs are counted and weighed by
+ * typical durations to estimate how long flashing takes on a card.
+ */
+class XSPI_MockRegisters : public XSPI_Registers
+{
+public:
+    // Typical durations in us
+    struct timing {
+        double regRead = 1.0;       // non posted MMIO read over PCIe
+        double regWrite = 0.25;     // posted MMIO write
+        double erase4K = 50000;
+        double erase32K = 100000;
+        double erase64K = 150000;
+        double eraseChip = 150000000;
+        double pageProgram = 120;
+    };
+
+    struct stats {
+        uint64_t regReads = 0;
+        uint64_t regWrites = 0;
+        uint64_t erases = 0;        // erase commands
+        uint64_t erasedBytes = 0;
+        uint64_t pagePrograms = 0;
+        uint64_t bytesRead = 0;     // data bytes read from flash
+        double us = 0;              // estimated time on a card
+    };
+
+    // Chips of sectors16M x 16MB, the id code encodes the size.
+    XSPI_MockRegisters(unsigned int chips = 1, unsigned int sectors16M = 4,
+        size_t fifoDepth = 256);
+
+    unsigned int readReg(unsigned int offset) override;
+    void writeReg(unsigned int offset, unsigned int value) override;
+
+    // Flash content of chip
+    std::vector<unsigned char>& flash(unsigned int chip) { return mChips[chip].mem; }
+
+    const stats& getStats() const { return mStats; }
+    void resetStats() { mStats = stats(); }
+    timing& getTiming() { return mTiming; }
+
+private:
+    struct chip {
+        std::vector<unsigned char> mem;
+        unsigned char idCapacity = 0;
+        unsigned char extAddr = 0;
+        std::vector<unsigned char> cmd;     // bytes of current command
+
+        unsigned char shift(unsigned char in, stats& st);
+        void end(stats& st, const timing& t);
+        unsigned int address() const;
+    };
+
+    std::vector<chip> mChips;
+    size_t mFifoDepth;
+    std::deque<unsigned char> mTx;
+    std::deque<unsigned char> mRx;
+    unsigned int mCr;
+    unsigned int mSsr;
+    stats mStats;
+    timing mTiming;
+
+    void reset();
+    void setSlaveSelect(unsigned int value);
+    void transfer();
+};
+
+#endif
@@ -14,6 +14,7 @@
 #include <vector>
 #include <limits>
 #include <array>
+#include <algorithm>
 #include <fcntl.h>
 
 
@@ -295,18 +296,43 @@ XSPI_Flasher::~XSPI_Flasher()
         std::fclose(mFlashDev);
 }
 
-XSPI_Flasher::XSPI_Flasher(std::shared_ptr<xrt_core::device> dev)
+/*
+ * Controller registers on the flash BAR of the device.
+ */
+class deviceRegisters : public XSPI_Registers
 {
-    mDev = dev;
+    std::shared_ptr<xrt_core::device> mDev;
+    unsigned long long flash_base;
 
-    std::string err;
-    flash_base = 0;
-    try {
-        flash_base = xrt_core::device_query<xrt_core::query::flash_bar_offset>(mDev.get());
+public:
+    deviceRegisters(std::shared_ptr<xrt_core::device> dev) : mDev(dev), flash_base(0)
+    {
+        try {
+            flash_base = xrt_core::device_query<xrt_core::query::flash_bar_offset>(mDev.get());
+        }
+        catch (...) {}
+        if (flash_base == 0)
+            flash_base = FLASH_BASE;
     }
-    catch (...) {}
-    if (flash_base == 0)
-        flash_base = FLASH_BASE;
+
+    unsigned int readReg(unsigned int RegOffset) override
+    {
+        unsigned int value = 0;
+        mDev->read(flash_base + RegOffset, &value, 4);
+        return value;
+    }
+
+    void writeReg(unsigned int RegOffset, unsigned int value) override
+    {
+        mDev->write(flash_base + RegOffset, &value, 4);
+    }
+};
+
+XSPI_Flasher::XSPI_Flasher(std::shared_ptr<xrt_core::device> dev)
+{
+    mDev = dev;
+    mRegs = std::make_shared<deviceRegisters>(dev);
+    mDifferential = std::getenv("FLASH_DIFFERENTIAL") != NULL;
 
     mFlashDev = nullptr;
 #ifdef __linux__
@@ -320,7 +346,17 @@ XSPI_Flasher::XSPI_Flasher(std::shared_ptr<xrt_core::device> dev)
 #endif
 }
 
+XSPI_Flasher::XSPI_Flasher(std::shared_ptr<XSPI_Registers> regs)
+{
+    mRegs = regs;
+    mDifferential = std::getenv("FLASH_DIFFERENTIAL") != NULL;
+    mFlashDev = nullptr;
+}
+
 static bool isDualQSPI(xrt_core::device *dev) {
+    // No device when flashing through mock registers, single flash
+    if (!dev)
+        return false;
     auto deviceID = xrt_core::device_query<xrt_core::query::pcie_device>(dev);
     return (deviceID == 0xE987 || deviceID == 0x6987 || deviceID == 0xD030 ||
             deviceID == 0xF987);
@@ -545,7 +581,7 @@ int XSPI_Flasher::xclUpgradeFirmware1(std::istream& mcsStream1, std::istream& st
         return status;
 
     //Get bitstream start location
-    bitstream_start_loc = recordList.front().mStartAddress;
+    bitstream_start_loc = mImage.startAddress();
 
     //Write bitstream guard if MCS file is not at address 0
     if(bitstream_start_loc != 0) {
@@ -561,7 +597,7 @@ int XSPI_Flasher::xclUpgradeFirmware1(std::istream& mcsStream1, std::istream& st
         throw xrt_core::error("Unable to prepare the flash chip");
 
     //Program MCS file
-    status = programXSpi(mcsStream1, bitstream_shift_addr);
+    status = programXSpi(bitstream_shift_addr);
     if(status)
         return status;
 
@@ -596,7 +632,7 @@ int XSPI_Flasher::xclUpgradeFirmware2(std::istream& mcsStream1, std::istream& mc
         return status;
 
     //Get bitstream start location
-    bitstream_start_loc = recordList.front().mStartAddress;
+    bitstream_start_loc = mImage.startAddress();
 
     //Write bitstream guard if MCS file is not at address 0
     if(bitstream_start_loc != 0) {
@@ -615,7 +651,7 @@ int XSPI_Flasher::xclUpgradeFirmware2(std::istream& mcsStream1, std::istream& mc
         return -EINVAL;
     }
     //Program first MCS file
-    status = programXSpi(mcsStream1, bitstream_shift_addr);
+    status = programXSpi(bitstream_shift_addr);
     if(status)
         return status;
 
@@ -631,7 +667,7 @@ int XSPI_Flasher::xclUpgradeFirmware2(std::istream& mcsStream1, std::istream& mc
         return -EINVAL;
     }
     //Program second MCS file
-    status = programXSpi(mcsStream2, bitstream_shift_addr);
+    status = programXSpi(bitstream_shift_addr);
     if(status)
         return status;
 
@@ -650,104 +686,24 @@ int XSPI_Flasher::xclUpgradeFirmware2(std::istream& mcsStream1, std::istream& mc
 
 int XSPI_Flasher::parseMCS(std::istream& mcsStream) {
     clearBuffers();
-    recordList.clear();
-
-    std::string startAddress;
-    ELARecord record;
-    bool endRecordFound = false;
 
-    while (!mcsStream.eof() && !endRecordFound) {
-        std::string line;
-        std::getline(mcsStream, line);
-        if (line.size() == 0) {
-            continue;
-        }
-        if (line[0] != ':') {
-            return -EINVAL;
-        }
-        const unsigned int dataLen = std::stoi(line.substr(1, 2), 0 , 16);
-        const unsigned int address = std::stoi(line.substr(3, 4), 0, 16);
-        const unsigned int recordType = std::stoi(line.substr(7, 2), 0 , 16);
-        switch (recordType) {
-        case 0x00:
-        {
-            if (dataLen > 16) {
-                // For xilinx mcs files data length should be 16 for all records
-                // except for the last one which can be smaller
-                return -EINVAL;
-            }
-            if (address != (record.mDataCount+(record.mStartAddress & 0xFFFF))) {
-                if(record.mDataCount == 0) {
-                    //First entry only.
-                    assert(record.mStartAddress != 0);
-                    assert(record.mEndAddress != 0);
-                    record.mStartAddress += address;
-                    record.mEndAddress += address;
-                }else {
-                    std::cout << "Address is not contiguous ! " << std::endl;
-                    return -EINVAL;
-                }
-            }
-            //if ( ((record.mEndAddress-record.mStartAddress)& 0xFFFF) != address) {
-              //  return -EINVAL;
-            //}
-            record.mDataCount += dataLen;
-            record.mEndAddress += dataLen;
-            break;
-        }
-        case 0x01:
-        {
-            if (startAddress.size() == 0) {
-                break;
-            }
-            recordList.push_back(record);
-            endRecordFound = true;
-            break;
-        }
-        case 0x02:
-        {
-            assert(0);
-            break;
-        }
-        case 0x04:
-        {
-            if (address != 0x0) {
-                return -EINVAL;
-            }
-            if (dataLen != 2) {
-                return -EINVAL;
-            }
-            std::string newAddress = line.substr(9, dataLen * 2);
-            if (startAddress.size()) {
-                // Finish the old record
-                recordList.push_back(record);
-            }
-            // Start a new record
-            record.mStartAddress = std::stoi(newAddress, 0 , 16);
-            record.mStartAddress <<= 16;
-            record.mDataPos = mcsStream.tellg();
-            record.mEndAddress = record.mStartAddress;
-            record.mDataCount = 0;
-            startAddress = newAddress;
-        }
-        }
-    }
+    int ret = mImage.parse(mcsStream);
+    if (ret)
+        return ret;
 
-    mcsStream.seekg(0);
-    std::cout << boost::format("%-8s : %s %s %s\n") % "INFO" % "Found" % recordList.size() % "ELA records";
+    std::cout << boost::format("%-8s : %s %s %s\n") % "INFO" % "Found" % mImage.segments().size() % "contiguous segments";
+    std::cout << boost::format("%-8s : %s %s %s\n") % "INFO" % "Decoded" % mImage.size() % "bytes";
     return 0;
 }
 
 unsigned int XSPI_Flasher::readReg(unsigned int RegOffset)
 {
-    unsigned int value = 0;
-    mDev->read(flash_base + RegOffset, &value, 4);
-    return value;
+    return mRegs->readReg(RegOffset);
 }
 
 int XSPI_Flasher::writeReg(unsigned int RegOffset, unsigned int value)
 {
-    mDev->write(flash_base + RegOffset, &value, 4);
+    mRegs->writeReg(RegOffset, value);
     return 0;
 }
 
@@ -1522,190 +1478,84 @@ bool XSPI_Flasher::prepareXSpi(uint8_t slave_sel)
     return true;
 }
 
-int XSPI_Flasher::programRecord(std::istream& mcsStream, const ELARecord& record) {
-
-#if defined(_debug)
-    std::cout << "Programming block (" << std::hex << record.mStartAddress << ", " << record.mEndAddress << std::dec << ")" << std::endl;
-#endif
-
-    assert(mcsStream.tellg() < record.mDataPos);
-    mcsStream.seekg(record.mDataPos, std::ios_base::beg);
-    unsigned char* buffer = &WriteBuffer[READ_WRITE_EXTRA_BYTES];
-    int bufferIndex = 0;
-    int pageIndex = 0;
-    std::string prevLine("");
-    for (unsigned int index = record.mDataCount; index > 0;) {
-        std::string line;
-        std::getline(mcsStream, line);
-        if(TEST_MODE)
-            std::cout << line << std::endl;
-        const unsigned int dataLen = std::stoi(line.substr(1, 2), 0 , 16);
-        index -= dataLen;
-        const unsigned int recordType = std::stoi(line.substr(7, 2), 0 , 16);
-        if (recordType != 0x00) {
-            continue;
-        }
-        const std::string data = line.substr(9, dataLen * 2);
-        // Write in byte swapped order
-        for (unsigned int i = 0; i < data.length(); i += 2) {
-            unsigned int value = std::stoi(data.substr(i, 2), 0, 16);
-            buffer[bufferIndex++] = (unsigned char)value;
-            assert(bufferIndex <= WRITE_DATA_SIZE);
-
-#if 0
-            //To enable byte swapping uncomment this.
-            //      if ((bufferIndex % 4) == 0) {
-            //        bufferIndex += 4;
-            //      }
-            //      assert(bufferIndex <= WRITE_DATA_SIZE);
-            //      unsigned value = std::stoi(data.substr(i, 2), 0, 16);
-            //      if(TEST_MODE)
-            //        std::cout << data.substr(i, 2);
-            //      buffer[--bufferIndex] = (unsigned char)value;
-            //      if ((bufferIndex % 4) == 0) {
-            //        bufferIndex += 4;
-            //      }
-#endif
-            if (bufferIndex == WRITE_DATA_SIZE) {
-                break;
-            }
-        }
-
-        if(TEST_MODE)
-            std::cout << std::endl;
-
-#if 0
-        //Uncomment if byte swapping enabled.
-
-        //account for the last line
-        //which can have say 14 bytes instead of 16
-        if((bufferIndex %4)!= 0) {
-            while ((bufferIndex %4)!= 0) {
-                unsigned char fillValue = 0xFF;
-                buffer[--bufferIndex] = fillValue;
-            }
-            bufferIndex += 4;
-        }
-
-        assert((bufferIndex % 4) == 0);
-#endif
-
-        assert(bufferIndex <= WRITE_DATA_SIZE);
-        if (bufferIndex == WRITE_DATA_SIZE) {
-#if defined(_debug)
-            std::cout << "writing page " << pageIndex << std::endl;
-#endif
-            const unsigned int address = std::stoi(line.substr(3, 4), 0, 16);
-            if(TEST_MODE) {
-                std::cout << (address + dataLen) << " " << (pageIndex +1)*WRITE_DATA_SIZE << std::endl;
-                std::cout << record.mStartAddress << " " << record.mStartAddress + pageIndex*PAGE_SIZE;
-                std::cout << " " << address << std::endl;
-            } else {
-                if(!writePage(record.mStartAddress + pageIndex*WRITE_DATA_SIZE))
-                    return -ENXIO;
-                clearBuffers();
-                {
-                    //debug stuff
-#if defined(_debug)
-                    if(pageIndex == 0) {
-                        if(!readPage(record.mStartAddress + pageIndex*WRITE_DATA_SIZE))
-                            return -ENXIO;
-                        clearBuffers();
-                    }
-#endif
-                }
-            }
-            pageIndex++;
-            delay(std::chrono::microseconds(20));
-            bufferIndex = 0;
-        }
-        prevLine = line;
+/*
+ * Read one 4KB sector back from flash, page by page.
+ */
+bool XSPI_Flasher::readSector(unsigned int addr, unsigned char *buf)
+{
+    // Data follows command, address and dummy bytes of quad read
+    const unsigned int dataOffset = READ_WRITE_EXTRA_BYTES + QUAD_READ_DUMMY_BYTES;
 
+    for (unsigned int i = 0; i < mcsImage::SECTOR_SIZE; i += READ_DATA_SIZE) {
+        if (!readPage(addr + i, COMMAND_QUAD_READ))
+            return false;
+        memcpy(buf + i, &ReadBuffer[dataOffset], READ_DATA_SIZE);
+        clearBuffers();
     }
-    if (bufferIndex) {
-        //Write the last page
-        if(TEST_MODE) {
-            std::cout << "writing final page " << pageIndex << std::endl;
-            std::cout << bufferIndex << std::endl;
-            std::cout << prevLine << std::endl;
-        }
-
-        const unsigned int address = std::stoi(prevLine.substr(3, 4), 0, 16);
-        const unsigned int dataLen = std::stoi(prevLine.substr(1, 2), 0 , 16);
-
-        if(TEST_MODE)
-            std::cout << address % WRITE_DATA_SIZE << " " << dataLen << std::endl;
-
-        //assert( (address % WRITE_DATA_SIZE + dataLen) == bufferIndex);
-
-        if(!TEST_MODE) {
+    return true;
+}
 
-            //Fill unused half page to FF
-            for(unsigned int i = bufferIndex; i < WRITE_DATA_SIZE; ++i) {
-                buffer[i] = 0xff;
+int XSPI_Flasher::programXSpi(uint32_t bitstream_shift_addr)
+{
+    const auto& sectors = mImage.sectors();
+    std::vector<bool> dirty(sectors.size(), true);
+    unsigned int numDirty = static_cast<unsigned int>(sectors.size());
+    unsigned char sector[mcsImage::SECTOR_SIZE];
+    unsigned char image[mcsImage::SECTOR_SIZE];
+
+    //Shifting by bitstream guard keeps sectors aligned
+    assert((bitstream_shift_addr % mcsImage::SECTOR_SIZE) == 0);
+
+    //Skip sectors already holding the image, flash reads faster than it erases
+    if (mDifferential) {
+        XBU::ProgressBar compare_flash("Comparing flash", numDirty, XBU::is_escape_codes_disabled(), std::cout);
+        numDirty = 0;
+        for (size_t i = 0; i < sectors.size(); i++) {
+            compare_flash.update(static_cast<unsigned int>(i + 1));
+            if (!readSector(sectors[i].address + bitstream_shift_addr, sector)) {
+                compare_flash.finish(false, "Failed to read subsector!");
+                return -EINVAL;
             }
-
-            if(!writePage(record.mStartAddress + pageIndex*WRITE_DATA_SIZE))
-                return -ENXIO;
-            delay(std::chrono::microseconds(20));
-            clearBuffers();
-            {
-                //debug stuff
-#if defined(_debug)
-                if(!readPage(record.mStartAddress + pageIndex*WRITE_DATA_SIZE))
-                    return -ENXIO;
-                clearBuffers();
-#endif
+            //Hash rejects changed sectors fast, unchanged ones are confirmed byte by byte
+            dirty[i] = mcsImage::hash(sector, sizeof(sector)) != sectors[i].hash;
+            if (!dirty[i]) {
+                mImage.read(sectors[i].address, image, sizeof(image));
+                dirty[i] = memcmp(sector, image, sizeof(sector)) != 0;
             }
+            if (dirty[i])
+                numDirty++;
         }
+        compare_flash.finish(true, "Flash compared");
+        std::cout << boost::format("%-8s : %s %u %s %u %s\n") % "INFO" % "Skipping" % (sectors.size() - numDirty)
+            % "of" % sectors.size() % "unchanged subsectors";
     }
-    return 0;
-}
-
-int XSPI_Flasher::programXSpi(std::istream& mcsStream, uint32_t bitstream_shift_addr)
-{
 
     //Now we can safely erase all subsectors
-    int beatCount = 0;
-    XBU::ProgressBar erase_flash("Erasing flash", static_cast<unsigned int>(recordList.size()), XBU::is_escape_codes_disabled(), std::cout);
-    for (ELARecordList::iterator i = recordList.begin(), e = recordList.end(); i != e; ++i) {
-        beatCount++;
-        // if(beatCount%20==0) {
-            erase_flash.update(beatCount);
-        // }
+    unsigned int beatCount = 0;
+    XBU::ProgressBar erase_flash("Erasing flash", numDirty, XBU::is_escape_codes_disabled(), std::cout);
+    for (size_t i = 0; i < sectors.size(); i++) {
+        if (!dirty[i])
+            continue;
+        erase_flash.update(++beatCount);
 
         //Shift all write addresses below bitstream guard
-        i->mStartAddress += bitstream_shift_addr;
-        i->mEndAddress += bitstream_shift_addr;
-
-        //Erase any subsectors in address range.
-        for(uint32_t j = i->mStartAddress; j < i->mEndAddress; j+=0x1000) {
-            //std::cout << "DEBUG: Erasing subsector @ 0x" << std::hex << j << std::dec << std::endl;
-            if(!sectorErase(j, COMMAND_4KB_SUBSECTOR_ERASE)) {
-                // std::cout << "\nERROR: Failed to erase subsector!" << std::endl;
-                erase_flash.finish(false, "Failed to erase subsector!");
-                return -EINVAL;
-            }
-
-            delay(std::chrono::microseconds(20));
+        if(!sectorErase(sectors[i].address + bitstream_shift_addr, COMMAND_4KB_SUBSECTOR_ERASE)) {
+            erase_flash.finish(false, "Failed to erase subsector!");
+            return -EINVAL;
         }
+
+        delay(std::chrono::microseconds(20));
     }
     erase_flash.finish(true, "Flash erased");
 
     //Next we program flash. Note that bitstream guard is still active
     beatCount = 0;
-    XBU::ProgressBar program_flash("Programming flash", static_cast<unsigned int>(recordList.size()), XBU::is_escape_codes_disabled(), std::cout);
-    for (ELARecordList::iterator i = recordList.begin(), e = recordList.end(); i != e; ++i)
-    {
-        beatCount++;
-        // if(beatCount%20==0) {
-            program_flash.update(beatCount);
-        // }
-
-        if(TEST_MODE) {
-            std::cout << boost::format("%-8s : %s %x\n") % "INFO" % "Start address 0x" % recordList.front().mStartAddress;
-            std::cout << boost::format("%-8s : %s %x\n") % "INFO" % "End address 0x" % recordList.front().mEndAddress;
-        }
+    unsigned char* buffer = &WriteBuffer[READ_WRITE_EXTRA_BYTES];
+    XBU::ProgressBar program_flash("Programming flash", numDirty, XBU::is_escape_codes_disabled(), std::cout);
+    for (size_t i = 0; i < sectors.size(); i++) {
+        if (!dirty[i])
+            continue;
+        program_flash.update(++beatCount);
 
         bool ready = isFlashReady();
         if(!ready){
@@ -1715,12 +1565,20 @@ int XSPI_Flasher::programXSpi(std::istream& mcsStream, uint32_t bitstream_shift_
 
         clearBuffers();
 
-        if (programRecord(mcsStream, *i)) {
-            program_flash.finish(false, "Could not program the block");
-            return -EINVAL;
-        }
+        mImage.read(sectors[i].address, sector, sizeof(sector));
+        for (unsigned int j = 0; j < mcsImage::SECTOR_SIZE; j += WRITE_DATA_SIZE) {
+            //Erased page already reads as 0xFF
+            if (std::all_of(sector + j, sector + j + WRITE_DATA_SIZE, [](unsigned char c) { return c == 0xFF; }))
+                continue;
 
-        delay(std::chrono::microseconds(20));
+            memcpy(buffer, sector + j, WRITE_DATA_SIZE);
+            if(!writePage(sectors[i].address + bitstream_shift_addr + j)) {
+                program_flash.finish(false, "Could not program the block");
+                return -ENXIO;
+            }
+            clearBuffers();
+            delay(std::chrono::microseconds(20));
+        }
     }
     program_flash.finish(true, "Flash programmed");
     return 0;
@@ -1972,210 +1830,56 @@ int XSPI_Flasher::revertToMFG(void)
     return 0;
 }
 
-static int splitMcsLine(std::string& line,
-    unsigned int& type, unsigned int& address, std::vector<unsigned char>& data)
-{
-    int ret = 0;
-
-    // Every line should start with ":"
-    if (line[0] != ':')
-        return -EINVAL;
-
-    unsigned int len = std::stoi(line.substr(1, 2), NULL , 16);
-    type = std::stoi(line.substr(7, 2), NULL , 16);
-    address = std::stoi(line.substr(3, 4), NULL, 16);
-    data.clear();
-
-    switch (type) {
-    case 0:
-        if (len > 16) {
-            // For xilinx mcs files data length should be 16 for all records
-            // except for the last one which can be smaller
-            ret = -EINVAL;
-        } else {
-            unsigned int l = len * 2;
-            std::string d = line.substr(9, len * 2);
-            for (unsigned int i = 0; i < l; i += 2)
-                data.push_back(static_cast<unsigned char>(std::stoi(d.substr(i, 2), NULL, 16)));
-        }
-        break;
-    case 1:
-        break;
-    case 4:
-        if (len != 2) {
-            // For xilinx mcs files extended address can only be 2 bytes
-            ret = -EINVAL;
-        }
-        address = std::stoi(line.substr(9, len * 2), NULL, 16);
-        break;
-    default:
-        // Xilinx mcs files should not contain other types
-        ret = -EINVAL;
-        break;
-    }
-
-    return ret;
-}
-
-static inline unsigned int pageOffset(unsigned int addr)
-{
-    return (addr & 0xffff);
-}
-
-static bool mcsStreamIsGolden(std::istream& mcsStream)
-{
-    std::string line;
-    unsigned int type = 0;
-    unsigned int addr = 0;
-    std::vector<unsigned char> data;
-
-    mcsStream.seekg(0, std::ios_base::beg);
-
-    // Try to find the first address in mcs stream
-    while (!mcsStream.eof() && type != 4) {
-        std::getline(mcsStream, line);
-        if (!line.empty())
-            splitMcsLine(line, type, addr, data);
-    }
-
-    mcsStream.seekg(0, std::ios_base::beg);
-    return addr == 0;
-}
-
-static int mcsStreamToBin(std::istream& mcsStream, unsigned int& currentAddr,
-    std::vector<unsigned char>& buf, unsigned int& nextAddr)
-{
-    bool done = false;
-    size_t cnt = 0;
-
-    buf.clear();
-
-    while (!mcsStream.eof() && !done) {
-        std::string line;
-        unsigned int type;
-        unsigned int addr;
-        std::vector<unsigned char> data;
-
-        std::getline(mcsStream, line);
-        if (line.size() == 0)
-            continue;
-
-        if (splitMcsLine(line, type, addr, data) != 0) {
-            std::cout << "Found invalid MCS line: " << line << std::endl;
-            return -EINVAL;
-        }
-
-        switch (type) {
-        case 0:
-            if (currentAddr == UINT_MAX) {
-                std::cout << "MCS missing page starting address" << std::endl;
-                return -EINVAL;
-            } else if (buf.size() == 0) {
-                // we're the 1st data in this page, updating the current addr
-                assert(pageOffset(currentAddr) == 0);
-                currentAddr |= addr;
-            } else if (pageOffset(currentAddr + static_cast<unsigned int>(buf.size())) != addr) {
-                std::cout << "MCS page offset is not contiguous, expecting 0x"
-                    << std::hex << pageOffset(currentAddr) + buf.size()
-                    << ", but, got 0x" << addr << std::dec << std::endl;
-                return -EINVAL;
-            }
-            // keep adding data to existing buffer
-            buf.insert(buf.end(), data.begin(), data.end());
-            cnt += data.size();
-            break;
-        case 1:
-            // end current buffer and no more
-            nextAddr = UINT_MAX;
-            done = true;
-            break;
-        case 4:
-            addr <<= 16;
-            if (currentAddr == UINT_MAX) {
-                currentAddr = addr; // addr of the very first page
-            } else if (currentAddr + buf.size() != addr) {
-                nextAddr = addr; // start new page
-                done = true;
-            }
-            // otherwise, continue to next page since page is still contiguous
-            break;
-        default:
-            assert(1); // shouldn't be here
-            break;
-        }
-
-        if (cnt >= pagesz) {
-            std::cout << "." << std::flush;
-            cnt = 0;
-        }
-    }
-    if (cnt) // print the last "."
-            std::cout << "." << std::flush;
-    std::cout << std::endl;
-
-    if (buf.size() > UINT_MAX) {
-        std::cout << "MCS bitstream is too large: 0x" << std::hex << buf.size()
-            << std::dec << " bytes" << std::endl;
-        return -EINVAL;
-    }
-
-    return 0;
-}
-
 static int writeBitstream(std::FILE *flashDev, int index, unsigned int addr,
-    std::vector<unsigned char>& buf)
+    const std::vector<unsigned char>& buf, bool differential)
 {
     int ret = 0;
     size_t len = 0;
+    size_t skipped = 0;
+    std::vector<unsigned char> flash;
 
     // Write to flash page by page and print '.' for each write
-    // as progress indicator
+    // as progress indicator, or '-' for a page already on flash
     for (size_t i = 0; ret == 0 && i < buf.size(); i += len) {
         len = pagesz - ((addr + i) % pagesz);
         len = std::min(len, buf.size() - i);
 
+        if (differential) {
+            flash.resize(len);
+            if (readFromFlash(flashDev, index, addr + static_cast<unsigned int>(i), flash.data(), len) == 0 &&
+                std::memcmp(flash.data(), buf.data() + i, len) == 0) {
+                std::cout << "-" << std::flush;
+                skipped += len;
+                continue;
+            }
+        }
+
         std::cout << "." << std::flush;
         ret = writeToFlash(flashDev, index, addr + static_cast<unsigned int>(i), buf.data() + static_cast<unsigned int>(i), len);
     }
     std::cout << std::endl;
+    if (differential)
+        std::cout << "Skipped " << skipped << " bytes already on flash" << std::endl;
     return ret;
 }
 
-static int programXSpiDrv(xrt_core::device *dev, std::FILE *mFlashDev, std::istream& mcsStream,
-    int index, uint32_t addressShift)
+static int programXSpiDrv(xrt_core::device *dev, std::FILE *mFlashDev, const mcsImage& image,
+    int index, uint32_t addressShift, bool differential)
 {
-    // Parse MCS data and write each contiguous chunk to flash.
-    std::vector<unsigned char> buf;
-    unsigned int curAddr = UINT_MAX;
-    unsigned int nextAddr = 0;
-    unsigned int startAddr = 0;
-    int ret;
-    bool store = true;
-
-    while (nextAddr != UINT_MAX) {
-        std::cout << "Extracting bitstream from MCS data:" << std::endl;
-        ret = mcsStreamToBin(mcsStream, curAddr, buf, nextAddr);
-        if (ret)
-            return ret;
-        assert(nextAddr == UINT_MAX || pageOffset(nextAddr) == 0);
-        std::cout << "Extracted " << buf.size() << " bytes from bitstream @0x"
-            << std::hex << curAddr << std::dec << std::endl;
-
-        if (store) {
-          startAddr = curAddr;
-          store = false;
-        }
+    // Write each contiguous segment of MCS data to flash.
+    for (auto& segment : image.segments()) {
+        std::cout << "Extracted " << segment.data.size() << " bytes from bitstream @0x"
+            << std::hex << segment.start << std::dec << std::endl;
 
         std::cout << "Writing bitstream to flash " << index << ":" << std::endl;
-        ret = writeBitstream(mFlashDev, index, curAddr + addressShift, buf);
+        int ret = writeBitstream(mFlashDev, index, segment.start + addressShift, segment.data, differential);
         if (ret)
             return ret;
-        curAddr = nextAddr;
     }
 
     // provide flash controller information to icap controller for webstar flow. Required only for U.2
     try {
-        xrt_core::device_update<xrt_core::query::ic_load_flash_address>(dev, startAddr);
+        xrt_core::device_update<xrt_core::query::ic_load_flash_address>(dev, image.startAddress());
         std::cout << "Successfully programmed flash address into icap controller ip" << std::endl;
     } catch (...) {}
 
@@ -2187,8 +1891,13 @@ int XSPI_Flasher::upgradeFirmware1Drv(std::istream& mcsStream, std::istream& str
     int ret = 0;
     uint32_t bsGuardAddr;
 
-    if (mcsStreamIsGolden(mcsStream))
-        return programXSpiDrv(mDev.get(), mFlashDev, mcsStream, 0, 0);
+    std::cout << "Extracting bitstream from MCS data" << std::endl;
+    ret = mImage.parse(mcsStream);
+    if (ret)
+        return ret;
+
+    if (mImage.isGolden())
+        return programXSpiDrv(mDev.get(), mFlashDev, mImage, 0, 0, mDifferential);
 
     ret = bitstreamGuardAddress(mDev.get(), bsGuardAddr);
     if (ret)
@@ -2211,7 +1920,7 @@ int XSPI_Flasher::upgradeFirmware1Drv(std::istream& mcsStream, std::istream& str
     }
 
     // Write MCS
-    ret = programXSpiDrv(mDev.get(), mFlashDev, mcsStream, 0, bitstreamGuardSize);
+    ret = programXSpiDrv(mDev.get(), mFlashDev, mImage, 0, bitstreamGuardSize, mDifferential);
     if (ret)
         return ret;
 
@@ -2224,12 +1933,21 @@ int XSPI_Flasher::upgradeFirmware2Drv(std::istream& mcsStream0,
 {
     int ret = 0;
     uint32_t bsGuardAddr = 0;
+    mcsImage image1;
+
+    std::cout << "Extracting bitstream from MCS data" << std::endl;
+    ret = mImage.parse(mcsStream0);
+    if (ret)
+        return ret;
+    ret = image1.parse(mcsStream1);
+    if (ret)
+        return ret;
 
-    if (mcsStreamIsGolden(mcsStream0)) {
-        ret = programXSpiDrv(mDev.get(), mFlashDev, mcsStream0, 0, 0);
+    if (mImage.isGolden()) {
+        ret = programXSpiDrv(mDev.get(), mFlashDev, mImage, 0, 0, mDifferential);
         if (ret)
             return ret;
-        return programXSpiDrv(mDev.get(), mFlashDev, mcsStream1, 1, 0);
+        return programXSpiDrv(mDev.get(), mFlashDev, image1, 1, 0, mDifferential);
     }
 
     ret = bitstreamGuardAddress(mDev.get(), bsGuardAddr);
@@ -2253,10 +1971,10 @@ int XSPI_Flasher::upgradeFirmware2Drv(std::istream& mcsStream0,
     }
 
     // Write MCS
-    ret = programXSpiDrv(mDev.get(), mFlashDev, mcsStream0, 0, bitstreamGuardSize);
+    ret = programXSpiDrv(mDev.get(), mFlashDev, mImage, 0, bitstreamGuardSize, mDifferential);
     if (ret)
         return ret;
-    ret = programXSpiDrv(mDev.get(), mFlashDev, mcsStream1, 1, bitstreamGuardSize);
+    ret = programXSpiDrv(mDev.get(), mFlashDev, image1, 1, bitstreamGuardSize, mDifferential);
     if (ret)
         return ret;
 
@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2019 - 2022 Xilinx, Inc
- * Copyright (C) 2022 Advanced Micro Devices, Inc.
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc.
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -17,28 +17,30 @@
 #ifndef _XSPI_H_
 #define _XSPI_H_
 
-#include <list>
 #include <iostream>
 #include "core/common/system.h"
 #include "core/common/device.h"
+#include "mcs_image.h"
 
-class XSPI_Flasher
+/*
+ * Register access to the AXI Quad SPI controller in front of the flash.
+ * The flasher accesses the registers on the flash BAR of the device, a
+ * mock controller can be plugged in to run the flasher without a card.
+ */
+class XSPI_Registers
 {
-  struct ELARecord
-  {
-    unsigned int mStartAddress;
-    unsigned int mEndAddress;
-    unsigned int mDataCount;
-    std::streampos mDataPos;
-
-    ELARecord() : mStartAddress(0), mEndAddress(0), mDataCount(0), mDataPos(0) {}
-  };
-
-  typedef std::list<ELARecord> ELARecordList;
-  ELARecordList recordList;
+ public:
+  virtual ~XSPI_Registers() {}
+  virtual unsigned int readReg(unsigned int offset) = 0;
+  virtual void writeReg(unsigned int offset, unsigned int value) = 0;
+};
 
+class XSPI_Flasher
+{
  public:
   XSPI_Flasher(std::shared_ptr<xrt_core::device> dev);
+  // Flash through given controller registers, there is no device.
+  XSPI_Flasher(std::shared_ptr<XSPI_Registers> regs);
   ~XSPI_Flasher();
   int xclUpgradeFirmware1(std::istream& mcsStream1, std::istream& stripped);
   int xclUpgradeFirmware2(std::istream& mcsStream1, std::istream& mcsStream2, std::istream& stripped);
@@ -46,11 +48,14 @@ class XSPI_Flasher
 
  private:
   std::shared_ptr<xrt_core::device> mDev;
+  std::shared_ptr<XSPI_Registers> mRegs;
   std::FILE *mFlashDev = nullptr;
+  // Only erase and program sectors which differ from the image.
+  bool mDifferential = false;
+  mcsImage mImage;
 
   int parseMCS(std::istream& mcsStream);
 
-  unsigned long long flash_base;
   int xclTestXSpi(int device_index);
   unsigned int readReg(unsigned int offset);
   int writeReg(unsigned int regOffset, unsigned int value);
@@ -66,9 +71,9 @@ class XSPI_Flasher
   bool finalTransfer(uint8_t *sendBufPtr, uint8_t *recvBufPtr, int byteCount);
   bool writePage(unsigned int addr, uint8_t writeCmd = 0xff);
   bool readPage(unsigned int addr, uint8_t readCmd = 0xff);
+  bool readSector(unsigned int addr, unsigned char *buf);
   bool prepareXSpi(uint8_t slave_sel);
-  int programRecord(std::istream& mcsStream, const ELARecord& record);
-  int programXSpi(std::istream& mcsStream, uint32_t bitstream_shift_addr);
+  int programXSpi(uint32_t bitstream_shift_addr);
   bool readRegister(uint8_t commandCode, unsigned int bytes);
   bool writeRegister(uint8_t commandCode, unsigned int value, unsigned int bytes);
   bool setSector(unsigned int address);
@@ -103,27 +103,26 @@ hip_graph_add_memset_node(hipGraph_t g, const hipGraphNode_t *pDependencies,
   throw_invalid_value_if(offset + total_size > hip_mem_dst->get_size(), "dst out of bound.");
   throw_invalid_value_if(total_size % element_size != 0, "Invalid size.");
 
+  auto dev = get_current_device();
+  throw_invalid_device_if(!dev, "empty device for memset node.");
+
   std::shared_ptr<command> hip_cmd;
-  auto element_count = total_size / element_size;
 
-  // Create appropriate command based on element size
+  // Create fill command of the element size
   switch (element_size) {
     case 1: {
-      std::vector<std::uint8_t> host_vec(element_count, static_cast<std::uint8_t>(pMemsetParams->value));
-      hip_cmd = std::make_shared<copy_from_host_buffer_command<std::uint8_t>>(
-        hip_mem_dst, std::move(host_vec), total_size, offset);
+      auto value = static_cast<std::uint8_t>(pMemsetParams->value);
+      hip_cmd = std::make_shared<memset_command>(dev, hip_mem_dst, &value, element_size, total_size, offset);
       break;
     }
     case 2: {
-      std::vector<std::uint16_t> host_vec(element_count, static_cast<std::uint16_t>(pMemsetParams->value));
-      hip_cmd = std::make_shared<copy_from_host_buffer_command<std::uint16_t>>(
-        hip_mem_dst, std::move(host_vec), total_size, offset);
+      auto value = static_cast<std::uint16_t>(pMemsetParams->value);
+      hip_cmd = std::make_shared<memset_command>(dev, hip_mem_dst, &value, element_size, total_size, offset);
       break;
     }
     case 4: {
-      std::vector<std::uint32_t> host_vec(element_count, static_cast<std::uint32_t>(pMemsetParams->value));
-      hip_cmd = std::make_shared<copy_from_host_buffer_command<std::uint32_t>>(
-        hip_mem_dst, std::move(host_vec), total_size, offset);
+      auto value = static_cast<std::uint32_t>(pMemsetParams->value);
+      hip_cmd = std::make_shared<memset_command>(dev, hip_mem_dst, &value, element_size, total_size, offset);
       break;
     }
     default:
@@ -150,7 +149,10 @@ hip_graph_add_memcpy_node_1d(hipGraph_t g, const hipGraphNode_t *pDependencies,
   auto hip_graph = graph_cache.get_or_error(g);
   throw_invalid_resource_if(!hip_graph, "invalid graph passed");
 
-  auto hip_cmd = std::make_shared<memcpy_command>(dst, src, count, kind);
+  auto dev = get_current_device();
+  throw_invalid_device_if(!dev, "empty device for memcpy node.");
+
+  auto hip_cmd = std::make_shared<memcpy_command>(dev, dst, src, count, kind);
   auto node_hdl = hip_graph->add_node(std::make_shared<graph_node>(hip_cmd));
 
   add_node_dependencies(hip_graph, node_hdl, pDependencies, numDependencies);
@@ -4,8 +4,6 @@
 #include <limits>
 #include <string>
 #include "core/common/error.h"
-#include "core/common/memalign.h"
-#include "core/common/unistd.h"
 #include "core/common/utils.h"
 #include "hip/config.h"
 #include "hip/core/device.h"
@@ -232,7 +230,7 @@ namespace xrt::core::hip
     // and stream::m_top_event::m_chain_of_commands of a stream object
     auto s_hdl = hip_stream.get();
     auto cmd_hdl = insert_in_map(command_cache,
-                                 std::make_shared<memcpy_command>(dst, src, size, kind));
+                                 std::make_shared<memcpy_command>(s_hdl->get_device(), dst, src, size, kind));
     s_hdl->enqueue(command_cache.get(cmd_hdl));
   }
 
@@ -251,10 +249,8 @@ namespace xrt::core::hip
                            || size > hip_mem_dst->get_size() - offset,
                            "dst out of bound.");
 
-    auto host_src = xrt_core::aligned_alloc(xrt_core::getpagesize(), size);
-    memset(host_src.get(), value, size);
-
-    hip_mem_dst->write(host_src.get(), size, 0, offset);
+    auto byte = static_cast<unsigned char>(value);
+    hip_mem_dst->fill(&byte, sizeof(byte), size, offset);
   }
 
   static void
@@ -276,7 +272,7 @@ namespace xrt::core::hip
     // ptr to a xrt::core::hip::command object could be shared between global command_cache and stream::m_top_event::m_chain_of_commands of a stream object
     auto s_hdl = hip_stream.get();
     auto cmd_hdl = insert_in_map(command_cache,
-                                 std::make_shared<memcpy_command>(dst, src, size, hipMemcpyHostToDevice));
+                                 std::make_shared<memcpy_command>(s_hdl->get_device(), dst, src, size, hipMemcpyHostToDevice));
     s_hdl->enqueue(command_cache.get(cmd_hdl));
   }
 
@@ -298,9 +294,6 @@ namespace xrt::core::hip
                            "Invalid element type.");
     throw_invalid_value_if(size % element_size != 0, "Invalid size.");
 
-    auto element_count = size / element_size;
-    std::vector<T> host_vec(element_count, value);
-
     auto hip_stream = get_stream(stream);
     throw_invalid_value_if(!hip_stream, "Invalid stream handle.");
 
@@ -309,7 +302,7 @@ namespace xrt::core::hip
     // stream::m_top_event::m_chain_of_commands of a stream object
     auto s_hdl = hip_stream.get();
     auto cmd_hdl = insert_in_map(command_cache,
-       std::make_shared<copy_from_host_buffer_command<T>>(hip_mem_dst, std::move(host_vec), size, offset));
+       std::make_shared<memset_command>(s_hdl->get_device(), hip_mem_dst, &value, element_size, size, offset));
     s_hdl->enqueue(command_cache.get(cmd_hdl));
   }
 
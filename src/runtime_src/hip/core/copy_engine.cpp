@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+#include "copy_engine.h"
+
+namespace xrt::core::hip {
+
+copy_engine::
+copy_engine()
+  : m_thread([this] { run(); })
+{}
+
+copy_engine::
+~copy_engine()
+{
+  {
+    std::lock_guard lk(m_mutex);
+    m_stop = true;
+  }
+  m_work.notify_one();
+  m_thread.join();
+}
+
+void
+copy_engine::
+run()
+{
+  while (true) {
+    std::function<void()> job;
+    {
+      std::unique_lock lk(m_mutex);
+      m_work.wait(lk, [this] { return m_stop || !m_jobs.empty(); });
+      // complete all enqueued jobs before stopping
+      if (m_jobs.empty())
+        return;
+      job = std::move(m_jobs.front());
+      m_jobs.pop_front();
+    }
+    job();
+  }
+}
+
+void
+copy_engine::
+post(std::function<void()> job)
+{
+  {
+    std::lock_guard lk(m_mutex);
+    m_jobs.push_back(std::move(job));
+  }
+  m_work.notify_one();
+}
+
+} // xrt::core::hip
@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+#ifndef xrthip_copy_engine_h
+#define xrthip_copy_engine_h
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+namespace xrt::core::hip {
+
+// copy_engine - executes asynchronous copy and fill commands of a device
+//
+// One thread per device executes the enqueued jobs in order, such that
+// copies are executed in the order they were submitted without
+// creating a thread per command.
+class copy_engine
+{
+  std::mutex m_mutex;
+  std::condition_variable m_work;
+  std::deque<std::function<void()>> m_jobs;
+  bool m_stop = false;
+  std::thread m_thread;
+
+  void
+  run();
+
+  void
+  post(std::function<void()> job);
+
+public:
+  copy_engine();
+  ~copy_engine();
+
+  copy_engine(const copy_engine&) = delete;
+  copy_engine(copy_engine&&) = delete;
+  copy_engine& operator=(const copy_engine&) = delete;
+  copy_engine& operator=(copy_engine&&) = delete;
+
+  // Enqueue a job, the returned future holds the job's return value
+  // or exception
+  template <typename Callable>
+  std::future<std::invoke_result_t<Callable>>
+  enqueue(Callable&& fn)
+  {
+    using result_type = std::invoke_result_t<Callable>;
+    auto task = std::make_shared<std::packaged_task<result_type()>>(std::forward<Callable>(fn));
+    auto future = task->get_future();
+    post([task] { (*task)(); });
+    return future;
+  }
+};
+
+} // xrt::core::hip
+
+#endif
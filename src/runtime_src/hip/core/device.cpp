@@ -11,4 +11,12 @@ device(uint32_t device_id)
   , m_xrt_device{device_id}
   , m_flags{0}
 {}
+
+copy_engine&
+device::
+get_copy_engine()
+{
+  std::call_once(m_copy_engine_init, [this] { m_copy_engine = std::make_unique<copy_engine>(); });
+  return *m_copy_engine;
+}
 }
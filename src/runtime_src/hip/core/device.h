@@ -7,10 +7,13 @@
 #undef max
 #endif
 
+#include "copy_engine.h"
 #include "core/common/api/handle.h"
 #include "xrt/xrt_device.h"
 
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 namespace xrt::core::hip {
@@ -27,6 +30,8 @@ class device
   xrt::device m_xrt_device;
   unsigned int m_flags;
   std::weak_ptr<context> pri_ctx;
+  std::once_flag m_copy_engine_init;
+  std::unique_ptr<copy_engine> m_copy_engine; // created on first use
 
 public:
   device() = default;
@@ -65,6 +70,10 @@ public:
   {
     return pri_ctx.lock(); // may return nullptr
   }
+
+  // Engine executing the asynchronous copies of this device
+  copy_engine&
+  get_copy_engine();
 };
 
 // Global map of devices
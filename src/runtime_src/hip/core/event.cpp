@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright (C) 2024-2025 Advanced Micro Devices, Inc. All rights reserved.
 
+#include <cstring>
 #include <iostream>
 
 #include "event.h"
@@ -396,14 +397,60 @@ bool kernel_start::wait()
 
 bool memcpy_command::submit()
 {
-  m_handle = std::async(std::launch::async, &hipMemcpy, m_dst, m_src, m_size, m_kind);
+  // the job must not reference the command, which can be destroyed
+  // before the job is executed
+  m_handle = m_device->get_copy_engine().enqueue([dst = m_dst, src = m_src, size = m_size, kind = m_kind] {
+    return hipMemcpy(dst, src, size, kind);
+  });
   return true;
 }
 
 bool memcpy_command::wait()
 {
-  m_handle.wait();
-  set_state(state::completed);
+  if (m_handle.valid())
+    set_state(m_handle.get() == hipSuccess ? state::completed : state::error);
+  return true;
+}
+
+memset_command::
+memset_command(device* dev, std::shared_ptr<memory> buf, const void* value, size_t element_size, size_t size, size_t offset)
+  : command(command::type::mem_cpy)
+  , m_device(dev)
+  , m_buffer(std::move(buf))
+  , m_value{}
+  , m_element_size(element_size)
+  , m_size(size)
+  , m_offset(offset)
+{
+  throw_invalid_value_if(element_size > m_value.size(), "Invalid element size.");
+  std::memcpy(m_value.data(), value, element_size);
+}
+
+bool
+memset_command::
+submit()
+{
+  m_handle = m_device->get_copy_engine().enqueue([buffer = m_buffer, value = m_value,
+                                                   element_size = m_element_size, size = m_size, offset = m_offset] {
+    buffer->fill(value.data(), element_size, size, offset);
+  });
+  return true;
+}
+
+bool
+memset_command::
+wait()
+{
+  if (m_handle.valid()) {
+    try {
+      m_handle.get();
+    }
+    catch (...) {
+      set_state(state::error);
+      throw;
+    }
+    set_state(state::completed);
+  }
   return true;
 }
 
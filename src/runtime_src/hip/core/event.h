@@ -11,6 +11,7 @@
 #include "xrt/xrt_bo.h"
 #include "core/common/api/kernel_int.h"
 
+#include <array>
 #include <condition_variable>
 #include <future>
 #include <memory>
@@ -153,54 +154,45 @@ public:
 };
 
 // memcpy command for hipMemcpyAsync
+// The copy is executed by the copy engine of the device.
 class memcpy_command : public command
 {
 public:
-  memcpy_command(void* dst, const void* src, size_t size, hipMemcpyKind kind)
-    : command(command::type::mem_cpy), m_dst(dst), m_src(src), m_size(size), m_kind(kind)
+  memcpy_command(device* dev, void* dst, const void* src, size_t size, hipMemcpyKind kind)
+    : command(command::type::mem_cpy), m_device(dev), m_dst(dst), m_src(src), m_size(size), m_kind(kind)
   {}
   bool submit() override;
   bool wait() override;
 
 protected:
+  device* m_device;
   void* m_dst; 
   const void* m_src; 
   size_t m_size;
   hipMemcpyKind m_kind;
-  std::future<hipError_t> m_handle;
+  std::shared_future<hipError_t> m_handle;
 };
 
-// copy command for copying data from a source only host buffer of type std::vector<uint8|uint16|uint32>
-template<class T>
-class copy_from_host_buffer_command : public command
+// fill command for hipMemsetAsync, fills device memory with a value of
+// 1, 2, or 4 bytes.  The fill is executed by the copy engine of the
+// device and writes the buffer in place without a host copy of the
+// filled range.
+class memset_command : public command
 {
 public:
-  copy_from_host_buffer_command(std::shared_ptr<memory> buf, std::vector<T>&& vec, size_t size, size_t offset)
-    : command(command::type::mem_cpy), buffer(std::move(buf)), host_vec(std::move(vec)), copy_size(size), dev_offset(offset)
-  {
-  }
+  memset_command(device* dev, std::shared_ptr<memory> buf, const void* value, size_t element_size, size_t size, size_t offset);
 
-  bool
-  submit() override
-  {
-    handle = std::async(std::launch::async, &memory::write, buffer, host_vec.data(), copy_size, 0, dev_offset);
-    return true;
-  }
-
-  bool
-  wait() override
-  {
-    handle.wait();
-    set_state(state::completed);
-    return true;
-  }
+  bool submit() override;
+  bool wait() override;
 
 private:
-  std::shared_ptr<memory> buffer; // device buffer
-  std::vector<T> host_vec; // host buffer (source only, not valid as destination)
-  size_t copy_size;
-  size_t dev_offset; // offset for device memory
-  std::future<void> handle;
+  device* m_device;
+  std::shared_ptr<memory> m_buffer; // device buffer
+  std::array<unsigned char, sizeof(uint32_t)> m_value;
+  size_t m_element_size;
+  size_t m_size;
+  size_t m_offset; // offset for device memory
+  std::shared_future<void> m_handle;
 };
 
 class empty_command : public command
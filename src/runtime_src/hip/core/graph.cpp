@@ -8,7 +8,11 @@
 #include "graph.h"
 
 #include <algorithm>
+#include <condition_variable>
+#include <functional>
 #include <iostream>
+#include <thread>
+#include <tuple>
 #include <unordered_set>
 #include <queue>
 
@@ -57,12 +61,98 @@ get_ordered_nodes() const
   return result;
 }
 
+namespace {
+
+// Pool of worker threads executing graph launches.  The threads are
+// created once and shared by all graph_exec objects.  Nodes block a
+// worker while waiting for their command to complete, which for an
+// event wait node may be a node of another launch.  A job is never
+// queued behind blocked workers, the pool grows by a worker when a
+// job is posted while no worker is idle, such that the nodes waited
+// for always run.  Workers are kept once created.
+class worker_pool
+{
+  std::mutex m_mutex;
+  std::condition_variable m_work;
+  std::deque<std::function<void()>> m_jobs;
+  std::vector<std::thread> m_workers;
+  size_t m_idle = 0;  // workers waiting for a job
+  bool m_stop = false;
+
+  void
+  worker()
+  {
+    while (true) {
+      std::function<void()> job;
+      {
+        std::unique_lock lk(m_mutex);
+        ++m_idle;
+        m_work.wait(lk, [this] { return m_stop || !m_jobs.empty(); });
+        --m_idle;
+        if (m_jobs.empty())
+          return;
+        job = std::move(m_jobs.front());
+        m_jobs.pop_front();
+      }
+      job();
+    }
+  }
+
+public:
+  explicit
+  worker_pool(size_t workers)
+  {
+    for (size_t i = 0; i < workers; ++i)
+      m_workers.emplace_back([this] { worker(); });
+  }
+
+  ~worker_pool()
+  {
+    {
+      std::lock_guard lk(m_mutex);
+      m_stop = true;
+    }
+    m_work.notify_all();
+    for (auto& t : m_workers)
+      t.join();
+  }
+
+  worker_pool(const worker_pool&) = delete;
+  worker_pool(worker_pool&&) = delete;
+  worker_pool& operator=(const worker_pool&) = delete;
+  worker_pool& operator=(worker_pool&&) = delete;
+
+  // Post a job, add a worker if all workers are busy, possibly
+  // blocked on commands, and the job would otherwise have to wait
+  void
+  post(std::function<void()> job)
+  {
+    {
+      std::lock_guard lk(m_mutex);
+      m_jobs.push_back(std::move(job));
+      if (m_jobs.size() > m_idle)
+        m_workers.emplace_back([this] { worker(); });
+    }
+    m_work.notify_one();
+  }
+};
+
+worker_pool&
+get_worker_pool()
+{
+  static constexpr size_t min_workers = 4;
+  static worker_pool pool(std::max<size_t>(min_workers, std::thread::hardware_concurrency()));
+  return pool;
+}
+
+} // namespace
+
 static
 std::vector<std::shared_ptr<graph_node>>
-init(const std::shared_ptr<graph>& graph)
+init(const std::shared_ptr<graph>& graph,
+     std::unordered_map<std::shared_ptr<graph_node>, std::shared_ptr<graph_node>>& kernel_to_list_map)
 {
   std::vector<std::shared_ptr<graph_node>> node_list;
-  std::unordered_map<std::shared_ptr<graph_node>, std::shared_ptr<graph_node>> kernel_to_list_map;
 
   for (const auto& node : graph->get_ordered_nodes()) {
     auto cmd_ptr = node->get_cmd();
@@ -133,38 +223,190 @@ init(const std::shared_ptr<graph>& graph)
 
 graph_exec::
 graph_exec(const std::shared_ptr<graph>& graph)
-  : m_node_exec_list(init(graph))
-{}
+{
+  std::unordered_map<std::shared_ptr<graph_node>, std::shared_ptr<graph_node>> kernel_to_list_map;
+  m_node_exec_list = init(graph, kernel_to_list_map);
+
+  // Index of the executed node of every graph node, kernel_start
+  // nodes are executed by their kernel_list_start node
+  const auto num_nodes = m_node_exec_list.size();
+  std::unordered_map<graph_node*, size_t> exec_index;
+  for (size_t idx = 0; idx < num_nodes; ++idx)
+    exec_index[m_node_exec_list[idx].get()] = idx;
+  for (const auto& [kernel_node, list_node] : kernel_to_list_map)
+    exec_index[kernel_node.get()] = exec_index.at(list_node.get());
+
+  m_num_deps.resize(num_nodes, 0);
+  m_children.resize(num_nodes);
+  for (size_t idx = 0; idx < num_nodes; ++idx) {
+    std::vector<size_t> deps;
+    for (const auto& dep : m_node_exec_list[idx]->get_deps_list()) {
+      auto itr = exec_index.find(dep.get());
+      if (itr != exec_index.end() && itr->second != idx)
+        deps.push_back(itr->second);
+    }
+
+    // A kernel_list_start node can depend on the same node through
+    // several of its kernels
+    std::sort(deps.begin(), deps.end());
+    deps.erase(std::unique(deps.begin(), deps.end()), deps.end());
+
+    m_num_deps[idx] = deps.size();
+    for (auto dep : deps)
+      m_children[dep].push_back(idx);
+    if (deps.empty())
+      m_roots.push_back(idx);
+  }
+
+  // Verify every node is reachable from the roots
+  std::vector<size_t> indegree = m_num_deps;
+  std::queue<size_t> q;
+  for (auto root : m_roots)
+    q.push(root);
+  size_t visited = 0;
+  while (!q.empty()) {
+    auto idx = q.front();
+    q.pop();
+    ++visited;
+    for (auto child : m_children[idx])
+      if (--indegree[child] == 0)
+        q.push(child);
+  }
+  if (visited != num_nodes)
+    throw_hip_error(hipErrorGraphExecUpdateFailure, "Cyclic dependency detected in graph nodes");
+
+  m_ready = std::make_unique<std::atomic<size_t>[]>(num_nodes);
+}
 
 void
 graph_exec::
 execute(std::shared_ptr<stream> s)
 {
-  auto future = std::async(std::launch::async, [this, s]() {
-    for (auto& node : m_node_exec_list) {
-      auto cmd = node->get_cmd();
-      const auto cmd_type = cmd->get_type();
-
-      if (cmd_type == command::type::event_record)
-        std::static_pointer_cast<event_record_command>(cmd)->set_stream(s);
-      else if (cmd_type == command::type::event_wait)
-        std::static_pointer_cast<event_wait_command>(cmd)->set_stream(s);
-
-      // Wait for all dependencies to complete before enqueuing this node
-      for (const auto& dep : node->get_deps_list())
-        dep->get_cmd()->wait();
-
-      cmd->set_state(command::state::init);
-      if (cmd_type == command::type::event_record ||
-          cmd_type == command::type::event_wait)
-        cmd->submit();
+  std::promise<void> done;
+  s->add_graph_exec_future(done.get_future());
+
+  std::lock_guard lk(m_mutex);
+  m_pending.emplace_back(std::move(s), std::move(done));
+  if (m_running)
+    return;
+
+  m_running = true;
+  get_worker_pool().post([self = shared_from_this()] { self->start_next(); });
+}
+
+// Start the first pending launch, called by a worker thread
+void
+graph_exec::
+start_next()
+{
+  {
+    std::lock_guard lk(m_mutex);
+    std::tie(m_stream, m_done) = std::move(m_pending.front());
+    m_pending.pop_front();
+  }
+
+  const auto num_nodes = m_node_exec_list.size();
+  for (size_t idx = 0; idx < num_nodes; ++idx)
+    m_ready[idx].store(m_num_deps[idx], std::memory_order_relaxed);
+  m_failed = false;
+  m_error = nullptr;
+  m_remaining = num_nodes;
+
+  if (!num_nodes) {
+    finish();
+    return;
+  }
+
+  // Run the first root in this worker
+  auto& pool = get_worker_pool();
+  for (size_t i = 1; i < m_roots.size(); ++i)
+    pool.post([self = shared_from_this(), idx = m_roots[i]] { self->run_node(idx); });
+  run_node(m_roots.front());
+}
+
+// Run a node and then the nodes that become ready when it completes.
+// Of the ready nodes, one is run by this worker and the others are
+// posted to the pool.
+void
+graph_exec::
+run_node(size_t idx)
+{
+  auto& pool = get_worker_pool();
+  while (true) {
+    // Dependents of a failed node are not run, but are completed
+    // such that the launch completes
+    if (!m_failed) {
+      try {
+        auto cmd = m_node_exec_list[idx]->get_cmd();
+        const auto cmd_type = cmd->get_type();
+
+        if (cmd_type == command::type::event_record)
+          std::static_pointer_cast<event_record_command>(cmd)->set_stream(m_stream);
+        else if (cmd_type == command::type::event_wait)
+          std::static_pointer_cast<event_wait_command>(cmd)->set_stream(m_stream);
+
+        cmd->set_state(command::state::init);
+        if (cmd_type == command::type::event_record ||
+            cmd_type == command::type::event_wait)
+          cmd->submit();
+        else
+          m_stream->enqueue(cmd);
+
+        // Wait for completion before releasing dependent nodes
+        cmd->wait();
+      }
+      catch (...) {
+        std::lock_guard lk(m_mutex);
+        if (!m_failed.exchange(true))
+          m_error = std::current_exception();
+      }
+    }
+
+    size_t next = m_node_exec_list.size();
+    for (auto child : m_children[idx]) {
+      if (--m_ready[child] != 0)
+        continue;
+      if (next == m_node_exec_list.size())
+        next = child;
       else
-        s->enqueue(std::move(cmd));
+        pool.post([self = shared_from_this(), child] { self->run_node(child); });
     }
-  });
 
-  // Store the future in the stream so synchronize() can wait for it
-  s->set_graph_exec_future(std::move(future));
+    if (--m_remaining == 0) {
+      finish();
+      return;
+    }
+
+    if (next == m_node_exec_list.size())
+      return;
+
+    idx = next;
+  }
+}
+
+// Complete current launch and start the next pending launch, if any
+void
+graph_exec::
+finish()
+{
+  auto done = std::move(m_done);
+  auto error = std::exchange(m_error, nullptr);
+  m_stream.reset();
+
+  bool pending = false;
+  {
+    std::lock_guard lk(m_mutex);
+    pending = !m_pending.empty();
+    m_running = pending;
+  }
+
+  if (error)
+    done.set_exception(error);
+  else
+    done.set_value();
+
+  if (pending)
+    get_worker_pool().post([self = shared_from_this()] { self->start_next(); });
 }
 
 // Global map of graph
@@ -8,6 +8,12 @@
 #include "module.h"
 #include "stream.h"
 
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <future>
+#include <mutex>
+
 namespace xrt::core::hip {
 
 // node_handle - opaque graph node handle
@@ -103,15 +109,55 @@ private:
 };
 
 // Represents an executable instance of a HIP graph.
-class graph_exec
+//
+// The execution schedule is computed once when the graph_exec is
+// created.  Each node has the number of nodes it depends on and the
+// list of nodes that depend on it.  A launch is executed by a pool of
+// worker threads shared by all graph_exec objects.  A node is run
+// when all the nodes it depends on have completed, such that
+// independent branches of the graph run concurrently.
+//
+// Launches of the same graph_exec are executed one at a time in
+// launch order since the nodes' commands are reused by each launch.
+class graph_exec : public std::enable_shared_from_this<graph_exec>
 {
 private:
   std::vector<std::shared_ptr<graph_node>> m_node_exec_list;
 
+  // Schedule, indices into m_node_exec_list
+  std::vector<size_t> m_num_deps;              // number of dependencies per node
+  std::vector<std::vector<size_t>> m_children; // nodes depending on node
+  std::vector<size_t> m_roots;                 // nodes without dependencies
+
+  // State of the current launch
+  std::unique_ptr<std::atomic<size_t>[]> m_ready; // remaining dependencies per node
+  std::atomic<size_t> m_remaining {0};            // nodes not yet completed
+  std::atomic<bool> m_failed {false};
+  std::exception_ptr m_error;
+  std::shared_ptr<stream> m_stream;
+  std::promise<void> m_done;
+
+  // Launches waiting for the current launch to complete
+  std::mutex m_mutex;
+  std::deque<std::pair<std::shared_ptr<stream>, std::promise<void>>> m_pending;
+  bool m_running = false;
+
+  void
+  start_next();
+
+  void
+  run_node(size_t idx);
+
+  void
+  finish();
+
 public:
   graph_exec() = default;
   explicit graph_exec(const std::shared_ptr<graph>& graph);
 
+  // Launch the graph in stream s.  The launch is queued to the
+  // worker pool and the function returns immediately.  The stream
+  // waits for completion of the launch when synchronized.
   void execute(std::shared_ptr<stream> s);
 };
 
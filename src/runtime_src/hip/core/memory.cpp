@@ -14,6 +14,9 @@
 #include "hip/hip_runtime_api.h"
 #include "memory.h"
 
+#include <algorithm>
+#include <cstring>
+
 namespace xrt::core::hip
 {
 
@@ -128,6 +131,33 @@ namespace xrt::core::hip
     }
   }
 
+  void
+  memory::fill(const void* pattern, size_t element_size, size_t size, size_t offset)
+  {
+    throw_invalid_value_if(!m_bo, "empty bo to fill.");
+    if (!size)
+      return;
+
+    auto dst = static_cast<unsigned char*>(m_bo.map()) + offset;
+    if (element_size == 1) {
+      std::memset(dst, *static_cast<const unsigned char*>(pattern), size);
+    }
+    else {
+      // Double the filled range with each copy.  The copy size is
+      // limited such that the source of the copy stays in cache.
+      constexpr size_t max_chunk = 64 * 1024;
+      std::memcpy(dst, pattern, element_size);
+      size_t filled = element_size;
+      while (filled < size) {
+        auto chunk = std::min({filled, size - filled, max_chunk});
+        std::memcpy(dst + filled, dst, chunk);
+        filled += chunk;
+      }
+    }
+
+    m_bo.sync(XCL_BO_SYNC_BO_TO_DEVICE, size, offset);
+  }
+
   void
   memory::sync(xclBOSyncDirection direction)
   {
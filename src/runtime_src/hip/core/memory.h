@@ -62,6 +62,12 @@ namespace xrt::core::hip
 
     void
     read(void *dst, size_t size, size_t dst_offset = 0, size_t offset = 0); 
+
+    // Fill size bytes at offset with a pattern of element_size bytes.
+    // The pattern is written in place to the mapped buffer, which is
+    // then synced to device.
+    void
+    fill(const void* pattern, size_t element_size, size_t size, size_t offset = 0);
     
     void
     sync(xclBOSyncDirection);
@@ -154,8 +154,22 @@ synchronize()
   // synchronize among streams in this ctx
   synchronize_streams();
 
-  if (m_graph_exec_future.valid())
-    m_graph_exec_future.wait();
+  // complete graph launches in this stream, a failed launch is
+  // reported after the commands in this stream have completed
+  try {
+    await_graph_exec();
+  }
+  catch (...) {
+    auto error = std::current_exception();
+    try {
+      await_completion();
+    }
+    catch (...) {
+      // command failures are recorded by await_completion, the
+      // graph launch error is reported
+    }
+    std::rethrow_exception(error);
+  }
 
   // complete commands in this stream
   await_completion();
@@ -177,9 +191,53 @@ record_top_event(std::shared_ptr<event> ev)
 
 void
 stream::
-set_graph_exec_future(std::future<void> future)
+add_graph_exec_future(std::future<void> future)
+{
+  std::lock_guard<std::mutex> lk(m_graph_exec_lock);
+
+  // drop completed launches, keep the first error for synchronize()
+  for (auto itr = m_graph_exec_futures.begin(); itr != m_graph_exec_futures.end();) {
+    if (itr->wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+      ++itr;
+      continue;
+    }
+    try {
+      itr->get();
+    }
+    catch (...) {
+      if (!m_graph_exec_error)
+        m_graph_exec_error = std::current_exception();
+    }
+    itr = m_graph_exec_futures.erase(itr);
+  }
+
+  m_graph_exec_futures.push_back(std::move(future));
+}
+
+void
+stream::
+await_graph_exec()
 {
-  m_graph_exec_future = std::move(future);
+  std::list<std::future<void>> futures;
+  std::exception_ptr error;
+  {
+    std::lock_guard<std::mutex> lk(m_graph_exec_lock);
+    futures.swap(m_graph_exec_futures);
+    std::swap(error, m_graph_exec_error);
+  }
+
+  for (auto& future : futures) {
+    try {
+      future.get();
+    }
+    catch (...) {
+      if (!error)
+        error = std::current_exception();
+    }
+  }
+
+  if (error)
+    std::rethrow_exception(error);
 }
 
 void
@@ -5,8 +5,10 @@
 
 #include "context.h"
 
+#include <exception>
 #include <list>
 #include <future>
+#include <mutex>
 
 namespace xrt::core::hip {
 
@@ -23,7 +25,10 @@ class stream
   std::list<std::shared_ptr<command>> m_cmd_queue;
   std::mutex m_cmd_lock;
   std::shared_ptr<event> m_top_event;
-  std::future<void> m_graph_exec_future;
+  // completion of graph launches in this stream
+  std::mutex m_graph_exec_lock;
+  std::list<std::future<void>> m_graph_exec_futures;
+  std::exception_ptr m_graph_exec_error;
 
 public:
   stream() = default;
@@ -77,7 +82,10 @@ public:
   clear_top_event();
 
   void
-  set_graph_exec_future(std::future<void> future);
+  add_graph_exec_future(std::future<void> future);
+
+  void
+  await_graph_exec();
 };
 
 // Global map of streams
@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+// Throughput of stream ordered copies and fills.
+//
+// Enqueues hipMemcpyAsync host to device and device to host copies
+// and hipMemsetD32Async fills of a device buffer in one stream, and
+// reports the throughput of each after the stream is synchronized.
+// The content of the buffer is validated after each phase.
+//
+// % g++ -g -std=c++17 -D__HIP_PLATFORM_AMD__ -I${XILINX_XRT}/include -I../common -L${XILINX_XRT}/lib -o memcpy-stream.exe main.cpp -lxrt_hip
+//
+// % memcpy-stream.exe [size in MB] [repeat]
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "hip/hip_runtime_api.h"
+
+#include "common.h"
+
+namespace {
+
+constexpr size_t default_size_mb = 64;
+constexpr int default_repeat = 20;
+
+void
+report(const char* what, size_t bytes, int repeat, long long delayd)
+{
+  const auto usmulti = static_cast<double>(xrt_hip_test_common::hip_test_timer::unit());
+  const auto total = static_cast<double>(bytes) * repeat;
+  std::cout << what << ": " << repeat << " x " << bytes / xrt_hip_test_common::mega_byte << " MB, "
+            << delayd << " us, "
+            << (total * usmulti) / (static_cast<double>(delayd) * xrt_hip_test_common::mega_byte) << " MB/s, "
+            << delayd / repeat << " us average" << std::endl;
+}
+
+int
+validate(const std::vector<uint32_t>& data, uint32_t seed, bool fill)
+{
+  int errors = 0;
+  for (size_t i = 0; i < data.size(); ++i) {
+    auto expected = fill ? seed : static_cast<uint32_t>(seed + i);
+    if (data[i] != expected && errors++ < 10)
+      std::cout << "data[" << i << "] = " << data[i] << ", expected " << expected << std::endl;
+  }
+  return errors;
+}
+
+int
+mainworker(size_t size_mb, int repeat)
+{
+  xrt_hip_test_common::hip_test_device hdevice;
+  hdevice.show_info(std::cout);
+
+  const size_t bytes = size_mb * xrt_hip_test_common::mega_byte;
+  const size_t count = bytes / sizeof(uint32_t);
+
+  xrt_hip_test_common::hip_test_device_bo<uint32_t> dbuf(count);
+  std::vector<uint32_t> host(count);
+
+  hipStream_t stream = nullptr;
+  xrt_hip_test_common::test_hip_check(hipStreamCreate(&stream));
+
+  xrt_hip_test_common::hip_test_timer timer;
+  int errors = 0;
+
+  // host to device
+  std::iota(host.begin(), host.end(), 0);
+  timer.reset();
+  for (int i = 0; i < repeat; ++i)
+    xrt_hip_test_common::test_hip_check(hipMemcpyAsync(dbuf.get(), host.data(), bytes, hipMemcpyHostToDevice, stream),
+                                        "hipMemcpyAsync");
+  xrt_hip_test_common::test_hip_check(hipStreamSynchronize(stream));
+  report("hipMemcpyAsync H2D", bytes, repeat, timer.stop());
+
+  // device to host
+  std::fill(host.begin(), host.end(), 0);
+  timer.reset();
+  for (int i = 0; i < repeat; ++i)
+    xrt_hip_test_common::test_hip_check(hipMemcpyAsync(host.data(), dbuf.get(), bytes, hipMemcpyDeviceToHost, stream),
+                                        "hipMemcpyAsync");
+  xrt_hip_test_common::test_hip_check(hipStreamSynchronize(stream));
+  report("hipMemcpyAsync D2H", bytes, repeat, timer.stop());
+  errors += validate(host, 0, false);
+
+  // fill, the last fill value is checked
+  timer.reset();
+  for (int i = 0; i < repeat; ++i)
+    xrt_hip_test_common::test_hip_check(hipMemsetD32Async(dbuf.get(), 0xdead0000 + i, count, stream),
+                                        "hipMemsetD32Async");
+  xrt_hip_test_common::test_hip_check(hipStreamSynchronize(stream));
+  report("hipMemsetD32Async", bytes, repeat, timer.stop());
+
+  xrt_hip_test_common::test_hip_check(hipMemcpy(host.data(), dbuf.get(), bytes, hipMemcpyDeviceToHost));
+  errors += validate(host, 0xdead0000 + repeat - 1, true);
+
+  xrt_hip_test_common::test_hip_check(hipStreamDestroy(stream));
+
+  std::cout << (errors ? "FAILED TEST" : "PASSED TEST") << std::endl;
+  return errors ? 1 : 0;
+}
+}
+
+int
+main(int argc, char* argv[])
+{
+  try {
+    size_t size_mb = argc > 1 ? std::stoul(argv[1]) : default_size_mb;
+    int repeat = argc > 2 ? std::stoi(argv[2]) : default_repeat;
+    return mainworker(size_mb, repeat);
+  } catch (std::exception &e) {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+}
@@ -0,0 +1,211 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/****************************************************************
+Test of asynchronous buffer object sync
+
+The test fills a source buffer with a pattern and syncs it to device
+with xrt::bo::async, polling the returned handle for completion while
+the transfer is in progress.  The source buffer is copied on device
+to a destination buffer, which is synced from device asynchronously.
+The verification of the destination buffer is enqueued in an
+xrt::queue after the future of the async handle.
+
+The future of a temporary async handle, which is destroyed before
+the transfer completes, is enqueued to check that the future waits
+for the transfer regardless of the lifetime of the handle.
+
+The async transfers are compared with xrt::bo::sync, the transfer
+rate of each is reported.
+
+The test runs on hardware and in sw_emu.
+
+% g++ -g -std=c++17 -I$XILINX_XRT/include -L$XILINX_XRT/lib -o bo_async.exe bo_async.cpp -lxrt_coreutil -luuid -pthread
+
+% bo_async.exe -k <xclbin> [--size <MB>] [--iterations <number>]
+****************************************************************/
+#include "xrt/xrt_bo.h"
+#include "xrt/xrt_device.h"
+#include "xrt/xrt_hw_context.h"
+#include "xrt/experimental/xrt_queue.h"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+static void
+usage()
+{
+  std::cout << "usage: bo_async.exe [options]\n\n";
+  std::cout << "  -k <bitstream>\n";
+  std::cout << "  -d <bdf | device_index>\n";
+  std::cout << "  [--size <MB>]: buffer object size (default: 64)\n";
+  std::cout << "  [--iterations <number>]: number of round trips (default: 10)\n";
+}
+
+class timer
+{
+  std::chrono::high_resolution_clock::time_point m_start;
+  std::chrono::duration<double> m_elapsed {0};
+public:
+  void start() { m_start = std::chrono::high_resolution_clock::now(); }
+  void stop() { m_elapsed += std::chrono::high_resolution_clock::now() - m_start; }
+  double seconds() const { return m_elapsed.count(); }
+};
+
+static void
+report(const std::string& what, size_t bytes, const timer& t)
+{
+  std::cout << what << ": " << (bytes / t.seconds()) / (1024 * 1024) << " MB/s\n";
+}
+
+static void
+verify(const uint32_t* data, size_t words, uint32_t seed)
+{
+  for (size_t i = 0; i < words; ++i) {
+    if (data[i] != seed + i)
+      throw std::runtime_error("result mismatch at word " + std::to_string(i));
+  }
+}
+
+static void
+run(const xrt::device& device, size_t bytes, size_t iterations)
+{
+  xrt::bo src{device, bytes, xrt::bo::flags::cacheable, 0};
+  xrt::bo dst{device, bytes, xrt::bo::flags::cacheable, 0};
+  auto src_data = src.map<uint32_t*>();
+  auto dst_data = dst.map<uint32_t*>();
+  auto words = bytes / sizeof(uint32_t);
+
+  xrt::queue queue;
+  timer sync, async;
+  size_t polls = 0;
+  for (size_t it = 0; it < iterations; ++it) {
+    auto seed = static_cast<uint32_t>(it);
+
+    // Reference with synchronous sync
+    std::iota(src_data, src_data + words, seed);
+    sync.start();
+    src.sync(XCL_BO_SYNC_BO_TO_DEVICE);
+    dst.copy(src);
+    std::memset(dst_data, 0, bytes);
+    dst.sync(XCL_BO_SYNC_BO_FROM_DEVICE);
+    sync.stop();
+    verify(dst_data, words, seed);
+
+    // Asynchronous sync, poll for completion
+    std::iota(src_data, src_data + words, seed + 1);
+    async.start();
+    auto to_device = src.async(XCL_BO_SYNC_BO_TO_DEVICE);
+    while (!to_device.ready())
+      ++polls;
+    to_device.wait();
+    dst.copy(src);
+    std::memset(dst_data, 0, bytes);
+
+    // Asynchronous sync, verify in queue after completion
+    auto from_device = dst.async(XCL_BO_SYNC_BO_FROM_DEVICE);
+    queue.enqueue(from_device.get_future());
+    auto verified = queue.enqueue([dst_data, words, seed] { verify(dst_data, words, seed + 1); });
+    verified.get();
+    async.stop();
+
+    if (!from_device.ready())
+      throw std::runtime_error("async handle not ready after completion");
+  }
+
+  // Partial async sync of second half of buffer
+  std::iota(src_data, src_data + words, 0);
+  src.async(XCL_BO_SYNC_BO_TO_DEVICE, bytes / 2, bytes / 2).wait();
+  dst.copy(src, bytes / 2, bytes / 2, bytes / 2);
+  std::memset(dst_data, 0, bytes);
+  dst.async(XCL_BO_SYNC_BO_FROM_DEVICE, bytes / 2, bytes / 2).wait();
+  verify(dst_data + words / 2, words / 2, static_cast<uint32_t>(words / 2));
+
+  // Future of a temporary async handle must still wait for the
+  // transfer, the handle is destroyed before the queue waits
+  std::iota(src_data, src_data + words, 2);
+  queue.enqueue(src.async(XCL_BO_SYNC_BO_TO_DEVICE).get_future());
+  queue.enqueue([&src, &dst] { dst.copy(src); });
+  queue.enqueue([dst_data, bytes] { std::memset(dst_data, 0, bytes); });
+  queue.enqueue(dst.async(XCL_BO_SYNC_BO_FROM_DEVICE).get_future());
+  queue.enqueue([dst_data, words] { verify(dst_data, words, 2); }).get();
+
+  // Out of range async must throw
+  try {
+    src.async(XCL_BO_SYNC_BO_TO_DEVICE, bytes, 1);
+    throw std::runtime_error("out of range async did not throw");
+  }
+  catch (const std::system_error&) {
+  }
+
+  auto total = bytes * iterations * 2;
+  report("sync", total, sync);
+  report("async", total, async);
+  std::cout << "polls: " << polls << "\n";
+}
+
+static int
+run(int argc, char** argv)
+{
+  std::vector<std::string> args(argv+1,argv+argc);
+
+  std::string xclbin_fnm;
+  std::string device_id = "0";
+  size_t size_mb = 64;
+  size_t iterations = 10;
+
+  std::string cur;
+  for (auto& arg : args) {
+    if (arg == "-h") {
+      usage();
+      return 1;
+    }
+
+    if (arg[0] == '-') {
+      cur = arg;
+      continue;
+    }
+
+    if (cur == "-k")
+      xclbin_fnm = arg;
+    else if (cur == "-d")
+      device_id = arg;
+    else if (cur == "--size")
+      size_mb = std::stoi(arg);
+    else if (cur == "--iterations")
+      iterations = std::stoi(arg);
+    else
+      throw std::runtime_error("bad argument '" + cur + " " + arg + "'");
+  }
+
+  if (xclbin_fnm.empty())
+    throw std::runtime_error("FAILED_TEST\nNo xclbin specified");
+
+  xrt::device device{device_id};
+  xrt::hw_context ctx{device, device.register_xclbin(xrt::xclbin{xclbin_fnm})};
+
+  run(device, size_mb * 1024 * 1024, iterations);
+
+  std::cout << "TEST PASSED\n";
+  return 0;
+}
+
+int
+main(int argc, char* argv[])
+{
+  try {
+    return run(argc,argv);
+  }
+  catch (const std::exception& ex) {
+    std::cout << "TEST FAILED: " << ex.what() << "\n";
+  }
+  catch (...) {
+    std::cout << "TEST FAILED\n";
+  }
+
+  return 1;
+}
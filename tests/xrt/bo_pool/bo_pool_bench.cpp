@@ -0,0 +1,203 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/****************************************************************
+Benchmark of xrt::ext::bo_pool against plain xrt::bo allocation
+
+The test keeps a working set of live buffers of random sizes and
+repeatedly replaces a random buffer in the working set with a newly
+allocated buffer.  The replacement loop is timed once with buffers
+allocated as plain xrt::bo objects and once with buffers allocated
+from an xrt::ext::bo_pool, and the allocation rate of each is
+reported along with the pool statistics.
+
+An idle arena must be reused by buffers of a size class other than
+the one last allocated from it.
+
+Each buffer is tagged with a pattern when allocated, the pattern is
+verified before the buffer is released to catch overlapping pool
+buffers.
+
+% g++ -g -std=c++17 -I$XILINX_XRT/include -L$XILINX_XRT/lib -o bo_pool_bench.exe bo_pool_bench.cpp -lxrt_coreutil -luuid -pthread
+
+% bo_pool_bench.exe -k <xclbin> [--live <number>] [--iterations <number>] [--max-size <KB>]
+****************************************************************/
+#include "xrt/xrt_bo.h"
+#include "xrt/xrt_device.h"
+#include "xrt/xrt_hw_context.h"
+#include "xrt/experimental/xrt_ext.h"
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+static void
+usage()
+{
+  std::cout << "usage: bo_pool_bench.exe [options]\n\n";
+  std::cout << "  -k <bitstream>\n";
+  std::cout << "  -d <bdf | device_index>\n";
+  std::cout << "  [--live <number>]: number of live buffers (default: 64)\n";
+  std::cout << "  [--iterations <number>]: number of buffer replacements (default: 10000)\n";
+  std::cout << "  [--max-size <KB>]: max buffer size (default: 1024)\n";
+}
+
+using alloc_fn = std::function<xrt::bo(size_t)>;
+
+static void
+tag(xrt::bo& bo, uint32_t value)
+{
+  auto data = bo.map<uint32_t*>();
+  data[0] = value;
+  data[bo.size() / sizeof(uint32_t) - 1] = ~value;
+}
+
+static void
+verify(xrt::bo& bo, uint32_t value)
+{
+  auto data = bo.map<uint32_t*>();
+  if (data[0] != value || data[bo.size() / sizeof(uint32_t) - 1] != ~value)
+    throw std::runtime_error("buffer " + std::to_string(value) + " was overwritten");
+}
+
+// Returns elapsed time in seconds of replacement loop
+static double
+run(const alloc_fn& alloc, size_t live, size_t iterations, size_t max_size)
+{
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<size_t> size_dist(1, max_size / sizeof(uint32_t));
+  std::uniform_int_distribution<size_t> slot_dist(0, live - 1);
+
+  std::vector<xrt::bo> bos(live);
+  std::vector<uint32_t> tags(live);
+  uint32_t next = 0;
+
+  auto start = std::chrono::high_resolution_clock::now();
+  for (size_t i = 0; i < live + iterations; ++i) {
+    auto slot = i < live ? i : slot_dist(gen);
+    if (bos[slot])
+      verify(bos[slot], tags[slot]);
+
+    bos[slot] = xrt::bo{};
+    bos[slot] = alloc(size_dist(gen) * sizeof(uint32_t));
+    tags[slot] = next++;
+    tag(bos[slot], tags[slot]);
+  }
+  bos.clear();
+  auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<double>(end - start).count();
+}
+
+static void
+report(const std::string& what, size_t allocs, double seconds)
+{
+  std::cout << what << ": " << allocs << " allocs in " << seconds * 1000 << " ms, "
+            << (allocs / seconds) << " allocs/s\n";
+}
+
+static int
+run(int argc, char** argv)
+{
+  std::vector<std::string> args(argv+1,argv+argc);
+
+  std::string xclbin_fnm;
+  std::string device_id = "0";
+  size_t live = 64;
+  size_t iterations = 10000;
+  size_t max_size_kb = 1024;
+
+  std::string cur;
+  for (auto& arg : args) {
+    if (arg == "-h") {
+      usage();
+      return 1;
+    }
+
+    if (arg[0] == '-') {
+      cur = arg;
+      continue;
+    }
+
+    if (cur == "-k")
+      xclbin_fnm = arg;
+    else if (cur == "-d")
+      device_id = arg;
+    else if (cur == "--live")
+      live = std::stoi(arg);
+    else if (cur == "--iterations")
+      iterations = std::stoi(arg);
+    else if (cur == "--max-size")
+      max_size_kb = std::stoi(arg);
+    else
+      throw std::runtime_error("bad argument '" + cur + " " + arg + "'");
+  }
+
+  if (xclbin_fnm.empty())
+    throw std::runtime_error("FAILED_TEST\nNo xclbin specified");
+
+  if (!live)
+    throw std::runtime_error("FAILED_TEST\nNumber of live buffers must be positive");
+
+  xrt::device device{device_id};
+  xrt::hw_context ctx{device, device.register_xclbin(xrt::xclbin{xclbin_fnm})};
+  auto max_size = max_size_kb * 1024;
+  auto allocs = live + iterations;
+
+  auto plain = run([&ctx](size_t sz) { return xrt::bo{ctx, sz, xrt::bo::flags::host_only, 0}; },
+                   live, iterations, max_size);
+  report("xrt::bo", allocs, plain);
+
+  xrt::ext::bo_pool pool{ctx, xrt::bo::flags::host_only};
+  auto pooled = run([&pool](size_t sz) { return pool.alloc(sz); }, live, iterations, max_size);
+  report("xrt::ext::bo_pool", allocs, pooled);
+
+  auto stats = pool.get_stats();
+  std::cout << "pool arenas: " << stats.arenas
+            << " reserved: " << stats.reserved_bytes / 1024 << " KB"
+            << " allocs: " << stats.allocs
+            << " reuses: " << stats.reuses
+            << " fallback: " << stats.fallback_allocs
+            << " arena allocs: " << stats.arena_allocs
+            << " arena frees: " << stats.arena_frees << "\n";
+
+  if (stats.used_bytes)
+    throw std::runtime_error("pool reports " + std::to_string(stats.used_bytes) + " bytes in use after release");
+
+  // After a phase of small buffers, large buffers must be carved
+  // from the idle arena rather than from newly reserved arenas
+  for (size_t i = 0; i < live; ++i)
+    pool.alloc(4096);
+  auto arena_allocs = pool.get_stats().arena_allocs;
+  for (size_t i = 0; i < live; ++i)
+    pool.alloc(1024 * 1024);
+  if (pool.get_stats().arena_allocs != arena_allocs)
+    throw std::runtime_error("idle arena not reused across size classes");
+
+  std::cout << "pool trim released: " << pool.trim() / 1024 << " KB\n";
+  if (pool.get_stats().arenas)
+    throw std::runtime_error("pool arenas not released by trim");
+
+  std::cout << "speedup: " << plain / pooled << "x\n";
+  std::cout << "TEST PASSED\n";
+  return 0;
+}
+
+int
+main(int argc, char* argv[])
+{
+  try {
+    return run(argc,argv);
+  }
+  catch (const std::exception& ex) {
+    std::cout << "TEST FAILED: " << ex.what() << "\n";
+  }
+  catch (...) {
+    std::cout << "TEST FAILED\n";
+  }
+
+  return 1;
+}
@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/****************************************************************
+Executor example illustrating use of xrt::queue::executor
+
+Many queues share the worker threads of one executor.  Each queue
+enqueues a sequence of small tasks that record their sequence number.
+The test verifies that tasks within each queue execute in order and
+reports the time to execute all tasks for dedicated queue threads and
+for a shared executor.
+
+The test does not use a device.
+
+% g++ -g -std=c++17 -I$XILINX_XRT/include -L$XILINX_XRT/lib -o executor.exe executor.cpp -lxrt_coreutil -pthread
+
+% executor.exe [--queues <number>] [--tasks <number>] [--threads <number>] [--batch <number>]
+****************************************************************/
+#include "xrt/experimental/xrt_queue.h"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+static void
+usage()
+{
+  std::cout << "usage: executor.exe [options]\n\n";
+  std::cout << "  [--queues <number>]: number of queues (default: 64)\n";
+  std::cout << "  [--tasks <number>]: number of tasks per queue (default: 10000)\n";
+  std::cout << "  [--threads <number>]: number of executor threads (default: hardware concurrency)\n";
+  std::cout << "  [--batch <number>]: max tasks drained per queue pickup (default: 8)\n";
+}
+
+// Per queue record of executed tasks
+struct sequence
+{
+  size_t next = 0;
+  bool in_order = true;
+};
+
+static double
+run(std::vector<std::unique_ptr<xrt::queue>>& queues, size_t tasks)
+{
+  std::vector<sequence> seqs(queues.size());
+  std::vector<xrt::queue::event> last(queues.size());
+
+  auto start = std::chrono::high_resolution_clock::now();
+  for (size_t t = 0; t < tasks; ++t) {
+    for (size_t q = 0; q < queues.size(); ++q) {
+      auto& seq = seqs[q];
+      last[q] = queues[q]->enqueue([&seq, t] {
+        seq.in_order = seq.in_order && seq.next == t;
+        seq.next = t + 1;
+      });
+    }
+  }
+
+  for (auto& ev : last)
+    ev.wait();
+  auto end = std::chrono::high_resolution_clock::now();
+
+  for (size_t q = 0; q < seqs.size(); ++q)
+    if (!seqs[q].in_order || seqs[q].next != tasks)
+      throw std::runtime_error("queue " + std::to_string(q) + " executed tasks out of order");
+
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+static int
+run(int argc, char** argv)
+{
+  std::vector<std::string> args(argv+1,argv+argc);
+
+  size_t num_queues = 64;
+  size_t tasks = 10000;
+  unsigned int threads = 0;
+  unsigned int batch = 8;
+
+  std::string cur;
+  for (auto& arg : args) {
+    if (arg == "-h") {
+      usage();
+      return 1;
+    }
+
+    if (arg[0] == '-') {
+      cur = arg;
+      continue;
+    }
+
+    if (cur == "--queues")
+      num_queues = std::stoi(arg);
+    else if (cur == "--tasks")
+      tasks = std::stoi(arg);
+    else if (cur == "--threads")
+      threads = std::stoi(arg);
+    else if (cur == "--batch")
+      batch = std::stoi(arg);
+    else
+      throw std::runtime_error("bad argument '" + cur + " " + arg + "'");
+  }
+
+  {
+    std::vector<std::unique_ptr<xrt::queue>> queues;
+    for (size_t q = 0; q < num_queues; ++q)
+      queues.push_back(std::make_unique<xrt::queue>());
+
+    std::cout << "dedicated threads: " << run(queues, tasks) << " ms\n";
+  }
+
+  {
+    xrt::queue::executor executor{threads, batch};
+    std::vector<std::unique_ptr<xrt::queue>> queues;
+    for (size_t q = 0; q < num_queues; ++q) {
+      auto prio = (q % 2) ? xrt::queue::priority::high : xrt::queue::priority::normal;
+      queues.push_back(std::make_unique<xrt::queue>(executor, prio));
+    }
+
+    std::cout << "shared executor: " << run(queues, tasks) << " ms\n";
+  }
+
+  std::cout << "TEST PASSED\n";
+  return 0;
+}
+
+int
+main(int argc, char* argv[])
+{
+  try {
+    return run(argc,argv);
+  }
+  catch (const std::exception& ex) {
+    std::cout << "TEST FAILED: " << ex.what() << "\n";
+  }
+  catch (...) {
+    std::cout << "TEST FAILED\n";
+  }
+
+  return 1;
+}
@@ -0,0 +1,188 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/****************************************************************
+Benchmark of application side cost of xrt::message::log
+
+Many threads log messages concurrently and time each call to
+xrt::message::log.  The test reports the mean and percentiles of the
+per message cost seen by the logging threads, and the wall time
+until all messages are logged.
+
+Run once synchronous and once with --async to compare the default
+dispatcher with Runtime.runtime_log_async.  The logging configuration
+is fixed at first use, so one process measures one mode.  With
+--async the test passes when all messages are either in the log
+file or reported as dropped.
+
+The test does not use a device.
+
+% g++ -g -std=c++17 -I$XILINX_XRT/include -L$XILINX_XRT/lib -o log_bench.exe log_bench.cpp -lxrt_coreutil -pthread
+
+% log_bench.exe [--threads <number>] [--messages <number>] [--log <file|console>] [--async] [--ring <number>]
+****************************************************************/
+#include "xrt/experimental/xrt_ini.h"
+#include "xrt/experimental/xrt_message.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+static void
+usage()
+{
+  std::cout << "usage: log_bench.exe [options]\n\n";
+  std::cout << "  [--threads <number>]: number of logging threads (default: 8)\n";
+  std::cout << "  [--messages <number>]: number of messages per thread (default: 100000)\n";
+  std::cout << "  [--log <file|console>]: runtime_log sink (default: log_bench.log)\n";
+  std::cout << "  [--async]: enable Runtime.runtime_log_async\n";
+  std::cout << "  [--ring <number>]: Runtime.runtime_log_async_ring (default: 4096)\n";
+}
+
+// Per thread cost of each log call in nanoseconds
+static std::vector<uint64_t>
+log_messages(size_t thread, size_t messages)
+{
+  std::vector<uint64_t> cost;
+  cost.reserve(messages);
+  auto tag = "log_bench";
+  auto prefix = "thread " + std::to_string(thread) + " message ";
+  std::string msg;
+  for (size_t m = 0; m < messages; ++m) {
+    msg = prefix + std::to_string(m);
+    auto start = std::chrono::steady_clock::now();
+    xrt::message::log(xrt::message::level::info, tag, msg);
+    auto end = std::chrono::steady_clock::now();
+    cost.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+  }
+  return cost;
+}
+
+// Count logged and dropped benchmark messages in log file
+static void
+check_log(const std::string& log, size_t expected)
+{
+  std::ifstream ifs(log);
+  if (!ifs)
+    throw std::runtime_error("failed to open log file '" + log + "'");
+
+  static const std::regex dropped_rx{R"((\d+) messages dropped)"};
+  size_t logged = 0;
+  size_t dropped = 0;
+  std::string line;
+  std::smatch match;
+  while (std::getline(ifs, line)) {
+    if (line.find("[log_bench]") != std::string::npos)
+      ++logged;
+    else if (std::regex_search(line, match, dropped_rx))
+      dropped += std::stoul(match[1]);
+  }
+
+  std::cout << "logged: " << logged << " dropped: " << dropped << "\n";
+  if (logged + dropped != expected)
+    throw std::runtime_error("expected " + std::to_string(expected) + " messages, got "
+                             + std::to_string(logged + dropped));
+}
+
+static int
+run(int argc, char** argv)
+{
+  std::vector<std::string> args(argv+1,argv+argc);
+
+  size_t threads = 8;
+  size_t messages = 100000;
+  std::string log = "log_bench.log";
+  bool async = false;
+  unsigned int ring = 4096;
+
+  std::string cur;
+  for (auto& arg : args) {
+    if (arg == "-h") {
+      usage();
+      return 1;
+    }
+
+    if (arg == "--async") {
+      async = true;
+      continue;
+    }
+
+    if (arg[0] == '-') {
+      cur = arg;
+      continue;
+    }
+
+    if (cur == "--threads")
+      threads = std::stoi(arg);
+    else if (cur == "--messages")
+      messages = std::stoi(arg);
+    else if (cur == "--log")
+      log = arg;
+    else if (cur == "--ring")
+      ring = std::stoi(arg);
+    else
+      throw std::runtime_error("bad argument '" + cur + " " + arg + "'");
+  }
+
+  xrt::ini::set("Runtime.runtime_log", log);
+  xrt::ini::set("Runtime.verbosity", static_cast<unsigned int>(xrt::message::level::info));
+  xrt::ini::set("Runtime.runtime_log_async", async ? "true" : "false");
+  xrt::ini::set("Runtime.runtime_log_async_ring", ring);
+
+  std::vector<std::vector<uint64_t>> costs(threads);
+  std::vector<std::thread> workers;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t t = 0; t < threads; ++t)
+    workers.emplace_back([&costs, t, messages] { costs[t] = log_messages(t, messages); });
+  for (auto& w : workers)
+    w.join();
+  auto end = std::chrono::steady_clock::now();
+
+  std::vector<uint64_t> all;
+  all.reserve(threads * messages);
+  for (auto& c : costs)
+    all.insert(all.end(), c.begin(), c.end());
+  std::sort(all.begin(), all.end());
+
+  double sum = 0;
+  for (auto ns : all)
+    sum += static_cast<double>(ns);
+
+  auto pct = [&all](double p) { return all[std::min(all.size() - 1, static_cast<size_t>(p / 100.0 * all.size()))]; };
+  std::cout << (async ? "async" : "sync") << " threads: " << threads << " messages: " << all.size() << "\n";
+  std::cout << "per message mean: " << sum / all.size() << " ns"
+            << " p50: " << pct(50) << " ns"
+            << " p99: " << pct(99) << " ns"
+            << " p99.9: " << pct(99.9) << " ns"
+            << " max: " << all.back() << " ns\n";
+  std::cout << "wall: " << std::chrono::duration<double, std::milli>(end - start).count() << " ms\n";
+
+  // Errors flush all queued messages before returning
+  xrt::message::log(xrt::message::level::error, "log_bench_done", "done");
+  if (log != "console")
+    check_log(log, threads * messages);
+
+  std::cout << "TEST PASSED\n";
+  return 0;
+}
+
+int
+main(int argc, char* argv[])
+{
+  try {
+    return run(argc,argv);
+  }
+  catch (const std::exception& ex) {
+    std::cout << "TEST FAILED: " << ex.what() << "\n";
+  }
+  catch (...) {
+    std::cout << "TEST FAILED\n";
+  }
+
+  return 1;
+}
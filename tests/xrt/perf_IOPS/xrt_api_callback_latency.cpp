@@ -0,0 +1,173 @@
+/**
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ */
+
+// Measure latency from xrt::run::start() to completion callback for
+// managed (callback mode) command execution.  The test keeps a fixed
+// number of commands in flight; each callback records the latency of
+// its command and restarts it until the requested number of commands
+// have been executed.
+//
+// Run the same binary against two XRT installs to compare command
+// manager implementations.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "xrt/xrt_device.h"
+#include "xrt/xrt_bo.h"
+#include "xrt/xrt_hw_context.h"
+#include "xrt/xrt_kernel.h"
+
+#ifdef _WIN32
+# pragma warning( disable : 4244 )
+#endif
+
+using clock_type = std::chrono::high_resolution_clock;
+
+static void usage()
+{
+  std::cout  << "Usage: test -k <xclbin> [-n <commands>]\n";
+}
+
+namespace {
+
+struct job
+{
+  std::vector<xrt::run> runs;
+  std::vector<clock_type::time_point> started;
+  std::vector<double> latency_us;
+  std::atomic<unsigned int> issued {0};
+  std::atomic<unsigned int> completed {0};
+  unsigned int total = 0;
+  std::mutex mutex;
+  std::condition_variable done;
+};
+
+struct context
+{
+  job* jb;
+  size_t idx;
+};
+
+void
+callback(const void*, ert_cmd_state, void* data)
+{
+  auto now = clock_type::now();
+  auto ctx = static_cast<context*>(data);
+  auto jb = ctx->jb;
+  auto delta = std::chrono::duration<double, std::micro>(now - jb->started[ctx->idx]).count();
+  auto done = jb->completed++;
+  jb->latency_us[done] = delta;
+
+  if (jb->issued++ < jb->total) {
+    jb->started[ctx->idx] = clock_type::now();
+    jb->runs[ctx->idx].start();
+    return;
+  }
+
+  if (done + 1 == jb->total) {
+    std::lock_guard<std::mutex> lk(jb->mutex);
+    jb->done.notify_all();
+  }
+}
+
+void
+report(unsigned int inflight, std::vector<double>& lat, double elapsed_us)
+{
+  std::sort(lat.begin(), lat.end());
+  auto pct = [&lat](double p) { return lat[std::min(lat.size() - 1, static_cast<size_t>(p * lat.size()))]; };
+  auto avg = std::accumulate(lat.begin(), lat.end(), 0.0) / lat.size();
+  std::cout << "In flight: " << std::setw(5) << inflight
+            << " cmds/s: " << std::setw(10) << static_cast<uint64_t>(lat.size() * 1e6 / elapsed_us)
+            << " avg(us): " << std::setw(8) << avg
+            << " p50(us): " << std::setw(8) << pct(0.50)
+            << " p99(us): " << std::setw(8) << pct(0.99)
+            << " max(us): " << std::setw(8) << lat.back()
+            << '\n';
+}
+
+void
+run_test(const xrt::device& device, const xrt::kernel& hello, unsigned int inflight, unsigned int total)
+{
+  job jb;
+  jb.total = total;
+  jb.started.resize(inflight);
+  jb.latency_us.resize(total);
+
+  std::vector<context> ctx(inflight);
+  for (size_t idx = 0; idx < inflight; ++idx) {
+    auto run = xrt::run(hello);
+    run.set_arg(0, xrt::bo(device, 20, hello.group_id(0)));
+    ctx[idx] = {&jb, idx};
+    run.add_callback(ERT_CMD_STATE_COMPLETED, callback, &ctx[idx]);
+    jb.runs.push_back(std::move(run));
+  }
+
+  auto start = clock_type::now();
+  for (size_t idx = 0; idx < inflight && jb.issued++ < total; ++idx) {
+    jb.started[idx] = clock_type::now();
+    jb.runs[idx].start();
+  }
+
+  {
+    std::unique_lock<std::mutex> lk(jb.mutex);
+    jb.done.wait(lk, [&jb] { return jb.completed == jb.total; });
+  }
+  auto elapsed = std::chrono::duration<double, std::micro>(clock_type::now() - start).count();
+
+  // Callbacks may still be returning from the monitor thread
+  for (auto& run : jb.runs)
+    run.wait();
+
+  report(inflight, jb.latency_us, elapsed);
+}
+
+int
+_main(int argc, char* argv[])
+{
+  if (argc < 3 || argv[1] != std::string("-k")) {
+    usage();
+    return 1;
+  }
+
+  std::string xclbin_fn = argv[2];
+  unsigned int total = 100000;
+  if (argc == 5 && argv[3] == std::string("-n"))
+    total = std::stoi(argv[4]);
+
+  auto device = xrt::device(0);
+  auto hwctx = xrt::hw_context(device, device.register_xclbin(xrt::xclbin(xclbin_fn)));
+  auto hello = xrt::kernel(hwctx, "hello");
+
+  for (auto inflight : {1U, 4U, 16U, 64U, 256U, 1024U})
+    run_test(device, hello, std::min(inflight, total), total);
+
+  return 0;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+  try {
+    return _main(argc, argv);
+  }
+  catch (const std::exception& ex) {
+    std::cout << "TEST FAILED: " << ex.what() << std::endl;
+  }
+  catch (...) {
+    std::cout << "TEST FAILED" << std::endl;
+  }
+
+  return 1;
+};
@@ -0,0 +1,193 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/****************************************************************
+Benchmark of buffer object transfer bandwidth
+
+The test allocates a buffer object of specified size, fills it with a
+pattern, syncs it to device, clears the host buffer, and syncs it
+back from device.  The round trip is repeated and the bandwidth of
+each direction is reported along with the bandwidth of xrt::bo::write
+and xrt::bo::read.  The data read back is compared with the pattern.
+
+The test is intended for sw_emu where the transfers by default are
+sent to the device process over RPC in chunks of SW_EMU_PACKET_SIZE
+bytes.  Run once without and once with --shared to compare with
+Emulation.sw_emu_shared_memory, where the data is copied directly to
+and from the device memory file.  Default buffer objects are zero copy
+in sw_emu, their sync is free with --shared, so use --cacheable to
+measure the copy itself.
+
+% g++ -g -std=c++17 -I$XILINX_XRT/include -L$XILINX_XRT/lib -o sync_bench.exe sync_bench.cpp -lxrt_coreutil -luuid -pthread
+
+% XCL_EMULATION_MODE=sw_emu sync_bench.exe -k <xclbin> [--size <MB>] [--iterations <number>] [--cacheable] [--shared]
+****************************************************************/
+#include "xrt/xrt_bo.h"
+#include "xrt/xrt_device.h"
+#include "xrt/xrt_hw_context.h"
+#include "xrt/experimental/xrt_ini.h"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+static void
+usage()
+{
+  std::cout << "usage: sync_bench.exe [options]\n\n";
+  std::cout << "  -k <bitstream>\n";
+  std::cout << "  -d <bdf | device_index>\n";
+  std::cout << "  [--size <MB>]: buffer object size (default: 256)\n";
+  std::cout << "  [--iterations <number>]: number of round trips (default: 10)\n";
+  std::cout << "  [--cacheable]: allocate cacheable buffer object\n";
+  std::cout << "  [--shared]: enable Emulation.sw_emu_shared_memory\n";
+}
+
+class timer
+{
+  std::chrono::high_resolution_clock::time_point m_start;
+  std::chrono::duration<double> m_elapsed {0};
+public:
+  void start() { m_start = std::chrono::high_resolution_clock::now(); }
+  void stop() { m_elapsed += std::chrono::high_resolution_clock::now() - m_start; }
+  double seconds() const { return m_elapsed.count(); }
+};
+
+static void
+report(const std::string& what, size_t bytes, const timer& t)
+{
+  std::cout << what << ": " << (bytes / t.seconds()) / (1024 * 1024) << " MB/s\n";
+}
+
+static void
+verify(const uint32_t* data, size_t words, uint32_t seed)
+{
+  for (size_t i = 0; i < words; ++i) {
+    if (data[i] != seed + i)
+      throw std::runtime_error("result mismatch at word " + std::to_string(i));
+  }
+}
+
+static void
+run(const xrt::device& device, size_t bytes, size_t iterations, bool cacheable)
+{
+  auto flags = cacheable ? xrt::bo::flags::cacheable : xrt::bo::flags::normal;
+  xrt::bo bo{device, bytes, flags, 0};
+  auto data = bo.map<uint32_t*>();
+  auto words = bytes / sizeof(uint32_t);
+  std::vector<uint32_t> host(words);
+
+  timer to_device, from_device, write, read;
+  for (size_t it = 0; it < iterations; ++it) {
+    auto seed = static_cast<uint32_t>(it);
+    std::iota(data, data + words, seed);
+    to_device.start();
+    bo.sync(XCL_BO_SYNC_BO_TO_DEVICE);
+    to_device.stop();
+
+    if (cacheable)
+      std::memset(data, 0, bytes);
+    from_device.start();
+    bo.sync(XCL_BO_SYNC_BO_FROM_DEVICE);
+    from_device.stop();
+    verify(data, words, seed);
+
+    std::iota(host.begin(), host.end(), seed + 1);
+    write.start();
+    bo.write(host.data());
+    write.stop();
+
+    std::fill(host.begin(), host.end(), 0);
+    read.start();
+    bo.read(host.data());
+    read.stop();
+    verify(host.data(), words, seed + 1);
+  }
+
+  auto total = bytes * iterations;
+  report("sync to device", total, to_device);
+  report("sync from device", total, from_device);
+  report("write", total, write);
+  report("read", total, read);
+}
+
+static int
+run(int argc, char** argv)
+{
+  std::vector<std::string> args(argv+1,argv+argc);
+
+  std::string xclbin_fnm;
+  std::string device_id = "0";
+  size_t size_mb = 256;
+  size_t iterations = 10;
+  bool cacheable = false;
+  bool shared = false;
+
+  std::string cur;
+  for (auto& arg : args) {
+    if (arg == "-h") {
+      usage();
+      return 1;
+    }
+
+    if (arg == "--cacheable") {
+      cacheable = true;
+      continue;
+    }
+
+    if (arg == "--shared") {
+      shared = true;
+      continue;
+    }
+
+    if (arg[0] == '-') {
+      cur = arg;
+      continue;
+    }
+
+    if (cur == "-k")
+      xclbin_fnm = arg;
+    else if (cur == "-d")
+      device_id = arg;
+    else if (cur == "--size")
+      size_mb = std::stoi(arg);
+    else if (cur == "--iterations")
+      iterations = std::stoi(arg);
+    else
+      throw std::runtime_error("bad argument '" + cur + " " + arg + "'");
+  }
+
+  if (xclbin_fnm.empty())
+    throw std::runtime_error("FAILED_TEST\nNo xclbin specified");
+
+  xrt::ini::set("Emulation.sw_emu_shared_memory", shared ? "true" : "false");
+
+  xrt::device device{device_id};
+  xrt::hw_context ctx{device, device.register_xclbin(xrt::xclbin{xclbin_fnm})};
+
+  std::cout << (shared ? "shared" : "rpc") << (cacheable ? " cacheable" : "")
+            << " size: " << size_mb << " MB iterations: " << iterations << "\n";
+  run(device, size_mb * 1024 * 1024, iterations, cacheable);
+
+  std::cout << "TEST PASSED\n";
+  return 0;
+}
+
+int
+main(int argc, char* argv[])
+{
+  try {
+    return run(argc,argv);
+  }
+  catch (const std::exception& ex) {
+    std::cout << "TEST FAILED: " << ex.what() << "\n";
+  }
+  catch (...) {
+    std::cout << "TEST FAILED\n";
+  }
+
+  return 1;
+}